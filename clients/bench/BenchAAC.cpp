@@ -0,0 +1,305 @@
+#include "Benchmark.h"
+#include <algorithm>
+#include <cmath>
+#include <stdio.h>
+#include <neaacdec.h>
+
+extern "C" {
+#include "common.h"
+#include "structs.h"
+#include "output.h"
+#include "cfft.h"
+#include "mdct.h"
+#include "filtbank.h"
+#include "syntax.h"
+#include "bits.h"
+#include "huffman.h"
+}
+// common.h defines these as macros
+#undef min
+#undef max
+
+// the ADTS frames of one of the synthetic streams
+struct ADTSFrames
+{
+    std::vector<uint8_t> data;
+    std::vector<std::pair<size_t, size_t> > frames;
+
+    bool load(Benchmark::State& state, const char* name);
+};
+
+bool ADTSFrames::load(Benchmark::State& state, const char* name)
+{
+    data = Benchmark::loadData(name);
+    size_t pos = 0;
+    while (pos + 7 <= data.size()) {
+        const uint8_t* h = data.data() + pos;
+        if (h[0] != 0xff || (h[1] & 0xf0) != 0xf0)
+            break;
+        const size_t length = ((h[3] & 0x3) << 11) | (h[4] << 3) | (h[5] >> 5);
+        if (length < 7 || pos + length > data.size())
+            break;
+        frames.push_back(std::make_pair(pos, length));
+        pos += length;
+    }
+    if (frames.empty()) {
+        state.skip(std::string(name) + " missing or not ADTS");
+        return false;
+    }
+    return true;
+}
+
+class Decoder
+{
+public:
+    Decoder() : mHandle(NeAACDecOpen()) { }
+    ~Decoder() { NeAACDecClose(mHandle); }
+
+    bool init(const ADTSFrames& adts)
+    {
+        unsigned long rate;
+        unsigned char channels;
+        return NeAACDecInit(mHandle, const_cast<uint8_t*>(adts.data.data()), adts.data.size(), &rate, &channels) >= 0;
+    }
+
+    void* decode(const ADTSFrames& adts, size_t frame, NeAACDecFrameInfo* info)
+    {
+        const std::pair<size_t, size_t>& f = adts.frames[frame];
+        return NeAACDecDecode(mHandle, info, const_cast<uint8_t*>(adts.data.data()) + f.first, f.second);
+    }
+
+    NeAACDecStruct* handle() const { return static_cast<NeAACDecStruct*>(mHandle); }
+
+private:
+    NeAACDecHandle mHandle;
+};
+
+// decodes the stream frame by frame, looping back to the start. the
+// decoder state carries over which is what happens on a live stream too
+static void decodeFrames(Benchmark::State& state, const char* name)
+{
+    ADTSFrames adts;
+    if (!adts.load(state, name))
+        return;
+    Decoder decoder;
+    if (!decoder.init(adts)) {
+        state.skip(std::string("unable to init decoder for ") + name);
+        return;
+    }
+    size_t frame = 0;
+    uint64_t bytes = 0, samples = 0;
+    for (auto _ : state) {
+        NeAACDecFrameInfo info;
+        Benchmark::doNotOptimize(decoder.decode(adts, frame, &info));
+        if (info.error) {
+            state.skip(NeAACDecGetErrorMessage(info.error));
+            break;
+        }
+        bytes += info.bytesconsumed;
+        samples += info.samples;
+        if (++frame == adts.frames.size())
+            frame = 0;
+    }
+    state.setBytesProcessed(bytes);
+    state.setItemsProcessed(samples);
+}
+
+static void BM_NeAACDecDecodeLC(Benchmark::State& state)
+{
+    decodeFrames(state, "aac_lc.adts");
+}
+BENCHMARK(BM_NeAACDecDecodeLC);
+
+static void BM_NeAACDecDecodeHE(Benchmark::State& state)
+{
+    decodeFrames(state, "aac_he.adts");
+}
+BENCHMARK(BM_NeAACDecDecodeHE);
+
+// the float to 16 bit conversion at the end of every decode, run on the
+// time domain output of a real frame
+static void BM_ToPCM16(Benchmark::State& state)
+{
+    ADTSFrames adts;
+    if (!adts.load(state, "aac_lc.adts"))
+        return;
+    Decoder decoder;
+    NeAACDecFrameInfo info;
+    if (!decoder.init(adts) || !decoder.decode(adts, 0, &info) || info.error || info.channels != 2) {
+        state.skip("unable to decode aac_lc.adts");
+        return;
+    }
+    NeAACDecStruct* hDecoder = decoder.handle();
+    const uint16_t frameLength = hDecoder->frameLength;
+    std::vector<int16_t> pcm(frameLength * 2);
+    for (auto _ : state) {
+        output_to_PCM(hDecoder, hDecoder->time_out, pcm.data(), 2, frameLength, FAAD_FMT_16BIT);
+        Benchmark::clobberMemory();
+    }
+    state.setBytesProcessed(state.iterations() * pcm.size() * sizeof(int16_t));
+    state.setItemsProcessed(state.iterations() * pcm.size());
+}
+BENCHMARK(BM_ToPCM16);
+
+// the complex FFT under the IMDCT, 512 points for long windows and 64 for
+// short ones, with the SIMD passes and with the plain C ones
+static void cfftBackward(Benchmark::State& state, bool simd)
+{
+    const uint16_t n = state.arg();
+    cfft_info* cfft = cffti(n);
+    if (simd && !cfft->simd) {
+        cfftu(cfft);
+        state.skip("no SIMD passes for this size or build");
+        return;
+    }
+    cfft->simd = simd;
+    std::vector<complex_t> data(n);
+    for (uint16_t i = 0; i < n; ++i) {
+        RE(data[i]) = std::sin(i * .1f);
+        IM(data[i]) = std::cos(i * .3f);
+    }
+    for (auto _ : state) {
+        cfftb(cfft, data.data());
+        Benchmark::clobberMemory();
+    }
+    state.setItemsProcessed(state.iterations() * n);
+    cfftu(cfft);
+}
+
+static void BM_CFFTBackward(Benchmark::State& state)
+{
+    cfftBackward(state, true);
+}
+BENCHMARK(BM_CFFTBackward)->arg(64)->arg(512);
+
+static void BM_CFFTBackwardScalar(Benchmark::State& state)
+{
+    cfftBackward(state, false);
+}
+BENCHMARK(BM_CFFTBackwardScalar)->arg(64)->arg(512);
+
+// the synthesis filter bank for one window sequence, 0 to 3 for only long,
+// long start, eight short and long stop. The label breaks a call down into
+// the FFTs, the rest of the IMDCTs (pre and post twiddle, reordering) and
+// what ifilter_bank does on top of them (windowing, overlap-add). For the
+// long windows the post twiddle and the windowing are one pass, so the
+// last number is what that pass costs over the plain IMDCT
+static void BM_IFilterBank(Benchmark::State& state)
+{
+    const uint8_t sequence = state.arg();
+    const uint16_t frameLength = 1024;
+    fb_info* fb = filter_bank_init(frameLength);
+    std::vector<real_t> freq(frameLength), time(frameLength), overlap(frameLength);
+    for (uint16_t i = 0; i < frameLength; ++i)
+        freq[i] = std::sin(i * .1f) * 1000 / (i + 1);
+
+    const auto filterBank = [&]() {
+        ifilter_bank(fb, sequence, 1, 1, freq.data(), time.data(), overlap.data(), LC, frameLength);
+    };
+    for (auto _ : state) {
+        filterBank();
+        Benchmark::clobberMemory();
+    }
+    state.setItemsProcessed(state.iterations() * frameLength);
+
+    const bool isShort = sequence == EIGHT_SHORT_SEQUENCE;
+    mdct_info* mdct = isShort ? fb->mdct256 : fb->mdct2048;
+    const int blocks = isShort ? 8 : 1;
+    std::vector<real_t> transformed(mdct->N);
+    std::vector<complex_t> fft(mdct->N / 4);
+    for (size_t i = 0; i < fft.size(); ++i) {
+        RE(fft[i]) = std::sin(i * .1f);
+        IM(fft[i]) = std::cos(i * .3f);
+    }
+    // the best of a few rounds, the stages are short enough for the odd
+    // interrupt to throw a single long run off
+    const auto measure = [](const std::function<void()>& function) {
+        enum { Rounds = 20, Runs = 50 };
+        uint64_t best = UINT64_MAX;
+        function();
+        for (int r = 0; r < Rounds; ++r) {
+            const uint64_t started = Benchmark::cycles();
+            for (int i = 0; i < Runs; ++i) {
+                function();
+                Benchmark::clobberMemory();
+            }
+            best = std::min<uint64_t>(best, (Benchmark::cycles() - started) / Runs);
+        }
+        return best;
+    };
+    const uint64_t ffts = measure([&]() {
+        for (int b = 0; b < blocks; ++b)
+            cfftb(mdct->cfft, fft.data());
+    });
+    const uint64_t imdcts = measure([&]() {
+        for (int b = 0; b < blocks; ++b)
+            faad_imdct(mdct, freq.data() + b * mdct->N / 2, transformed.data());
+    });
+    const uint64_t total = measure(filterBank);
+    char label[128];
+    snprintf(label, sizeof(label), "fft %llu, twiddle %lld, window %lld %s",
+             static_cast<unsigned long long>(ffts), static_cast<long long>(imdcts - ffts),
+             static_cast<long long>(total - imdcts), Benchmark::cyclesUnit());
+    state.setLabel(label);
+
+    filter_bank_end(fb);
+}
+BENCHMARK(BM_IFilterBank)->arg(0)->arg(1)->arg(2)->arg(3);
+
+// spectral data codewords of one codebook, 1 to 11, read from random bits.
+// Random bits hit each codeword as often as its length says it should be,
+// which is what the codebooks were built for
+static void BM_HuffmanSpectralData(Benchmark::State& state)
+{
+    const uint8_t cb = state.arg();
+    std::vector<uint8_t> bits(1 << 16);
+    uint32_t seed = 1;
+    for (size_t i = 0; i < bits.size(); ++i) {
+        seed = seed * 1103515245 + 12345;
+        bits[i] = seed >> 16;
+    }
+    // leave room for the longest codeword plus escapes at the end
+    const uint32_t end = (bits.size() - 64) * 8;
+    bitfile ld;
+    faad_initbits(&ld, bits.data(), bits.size());
+    uint64_t codewords = 0;
+    for (auto _ : state) {
+        int16_t sp[4];
+        if (faad_get_processed_bits(&ld) > end)
+            faad_initbits(&ld, bits.data(), bits.size());
+        Benchmark::doNotOptimize(huffman_spectral_data(cb, &ld, sp));
+        Benchmark::doNotOptimize(sp);
+        ++codewords;
+    }
+    state.setItemsProcessed(codewords * (cb < FIRST_PAIR_HCB ? QUAD_LEN : PAIR_LEN));
+    faad_endbits(&ld);
+}
+BENCHMARK(BM_HuffmanSpectralData)->arg(1)->arg(2)->arg(3)->arg(4)->arg(5)->arg(6)
+    ->arg(7)->arg(8)->arg(9)->arg(10)->arg(11);
+
+// fields of arg bits (1 to 32) straight off the bit reader, the same mix
+// of showbits/flushbits every parser in libfaad boils down to
+static void BM_GetBits(Benchmark::State& state)
+{
+    const uint32_t n = state.arg();
+    std::vector<uint8_t> bits(1 << 16);
+    uint32_t seed = 1;
+    for (size_t i = 0; i < bits.size(); ++i) {
+        seed = seed * 1103515245 + 12345;
+        bits[i] = seed >> 16;
+    }
+    // start one byte in so the refills are unaligned like they are in a frame
+    const uint32_t end = (bits.size() - 8) * 8;
+    bitfile ld;
+    faad_initbits(&ld, bits.data() + 1, bits.size() - 1);
+    uint64_t fields = 0;
+    for (auto _ : state) {
+        if (faad_get_processed_bits(&ld) > end)
+            faad_initbits(&ld, bits.data() + 1, bits.size() - 1);
+        Benchmark::doNotOptimize(faad_getbits(&ld, n));
+        ++fields;
+    }
+    state.setItemsProcessed(fields);
+    faad_endbits(&ld);
+}
+BENCHMARK(BM_GetBits)->arg(1)->arg(4)->arg(11)->arg(32);
@@ -0,0 +1,62 @@
+#include "Benchmark.h"
+#include "PcmRing.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// one decoded AAC frame, 1024 samples of 16 bit stereo
+enum { FrameBytes = 1024 * 2 * 2, RingBytes = 512 * 1024 };
+
+// a frame in and back out in reads of the given size on one thread, the
+// cost of the ring itself without any contention
+static void BM_PcmRing(Benchmark::State& state)
+{
+    const size_t readSize = state.arg();
+    PcmRing ring(RingBytes);
+    std::vector<uint8_t> frame(FrameBytes, 0x55), out(readSize);
+    // start somewhere that makes the frames wrap around the end every so often
+    ring.write(frame.data(), 1000);
+    for (auto _ : state) {
+        ring.write(frame.data(), frame.size());
+        size_t left = frame.size();
+        while (left) {
+            const size_t got = ring.read(out.data(), std::min(readSize, left));
+            left -= got;
+        }
+        Benchmark::doNotOptimize(out.data());
+    }
+    state.setBytesProcessed(state.iterations() * FrameBytes);
+}
+BENCHMARK(BM_PcmRing)->arg(512)->arg(4096);
+
+// a producer thread writing frames as fast as the ring takes them and the
+// benchmark loop reading the given size, like the audio output callback
+static void BM_PcmRingThreaded(Benchmark::State& state)
+{
+    const size_t readSize = state.arg();
+    PcmRing ring(RingBytes);
+    std::atomic<bool> done(false);
+    std::thread producer([&ring, &done]() {
+        std::vector<uint8_t> frame(FrameBytes, 0x55);
+        while (!done.load(std::memory_order_relaxed)) {
+            if (!ring.write(frame.data(), frame.size()))
+                std::this_thread::yield();
+        }
+    });
+
+    std::vector<uint8_t> out(readSize);
+    for (auto _ : state) {
+        size_t left = readSize;
+        while (left) {
+            const size_t got = ring.read(out.data(), left);
+            if (!got)
+                std::this_thread::yield();
+            left -= got;
+        }
+        Benchmark::doNotOptimize(out.data());
+    }
+    done = true;
+    producer.join();
+    state.setBytesProcessed(state.iterations() * readSize);
+}
+BENCHMARK(BM_PcmRingThreaded)->arg(512)->arg(4096);
@@ -0,0 +1,141 @@
+#include "Benchmark.h"
+#include "DemuxerImpl.h"
+#include <cstring>
+
+enum { TSPacketSize = 188 };
+
+// Drives DemuxerImpl::ReadAV directly on buffers we hand the demuxer,
+// without demux-mpegts asking for anything. Reads never go past the
+// first buffer so nothing is popped and the same reads can repeat.
+class DemuxerBenchmark
+{
+public:
+    DemuxerBenchmark(bool zeroCopy)
+        : mDemuxer(options(zeroCopy))
+    {
+    }
+
+    void push(const uint8_t* data, size_t size)
+    {
+        Buffer buffer;
+        buffer.resize(size);
+        memcpy(buffer.data(), data, size);
+        mDemuxer.mBuffers.push(std::move(buffer));
+    }
+
+    const unsigned char* readAV(uint64_t pos, size_t n) { return mDemuxer.mDemuxer->ReadAV(pos, n); }
+    const unsigned char* contiguous(uint64_t pos, size_t* size) { return mDemuxer.mDemuxer->contiguous(pos, size); }
+
+private:
+    static Demuxer::Options options(bool zeroCopy)
+    {
+        Demuxer::Options opts;
+        opts.zeroCopy = zeroCopy;
+        return opts;
+    }
+
+    Demuxer mDemuxer;
+};
+
+static bool loadStream(Benchmark::State& state, std::vector<uint8_t>& ts)
+{
+    ts = Benchmark::loadData("stream.ts");
+    if (ts.size() < 2 * 65536) {
+        state.skip("stream.ts missing or too short");
+        return false;
+    }
+    return true;
+}
+
+// packet reads inside the window remembered by contiguous(), the common
+// case once the demuxer is in sync
+static void BM_ReadAVWindow(Benchmark::State& state)
+{
+    std::vector<uint8_t> ts;
+    if (!loadStream(state, ts))
+        return;
+    DemuxerBenchmark demuxer(state.arg() != 0);
+    demuxer.push(ts.data(), 65536);
+    size_t size;
+    demuxer.contiguous(0, &size);
+    const uint64_t end = size / TSPacketSize * TSPacketSize;
+    uint64_t pos = 0;
+    for (auto _ : state) {
+        Benchmark::doNotOptimize(demuxer.readAV(pos, TSPacketSize));
+        pos += TSPacketSize;
+        if (pos == end)
+            pos = 0;
+    }
+    state.setBytesProcessed(state.iterations() * TSPacketSize);
+}
+// 1 is zero copy, 0 copies every read
+BENCHMARK(BM_ReadAVWindow)->arg(1)->arg(0);
+
+// reads without a window, they walk the buffer list to find the first one
+static void BM_ReadAVFirstBuffer(Benchmark::State& state)
+{
+    std::vector<uint8_t> ts;
+    if (!loadStream(state, ts))
+        return;
+    DemuxerBenchmark demuxer(state.arg() != 0);
+    demuxer.push(ts.data(), 65536);
+    demuxer.push(ts.data() + 65536, 65536);
+    const uint64_t end = 65536 / TSPacketSize * TSPacketSize;
+    uint64_t pos = 0;
+    for (auto _ : state) {
+        Benchmark::doNotOptimize(demuxer.readAV(pos, TSPacketSize));
+        pos += TSPacketSize;
+        if (pos == end)
+            pos = 0;
+    }
+    state.setBytesProcessed(state.iterations() * TSPacketSize);
+}
+BENCHMARK(BM_ReadAVFirstBuffer)->arg(1)->arg(0);
+
+// reads straddling the end of a buffer the size of one TCP segment, they
+// have to be stitched together in the copy buffer. the argument is how
+// many bytes of the packet are in the first buffer
+static void BM_ReadAVStitched(Benchmark::State& state)
+{
+    std::vector<uint8_t> ts;
+    if (!loadStream(state, ts))
+        return;
+    enum { SegmentSize = 1448 };
+    DemuxerBenchmark demuxer(true);
+    demuxer.push(ts.data(), SegmentSize);
+    demuxer.push(ts.data() + SegmentSize, SegmentSize);
+    const uint64_t pos = SegmentSize - state.arg();
+    for (auto _ : state)
+        Benchmark::doNotOptimize(demuxer.readAV(pos, TSPacketSize));
+    state.setBytesProcessed(state.iterations() * TSPacketSize);
+}
+BENCHMARK(BM_ReadAVStitched)->arg(4)->arg(94)->arg(184);
+
+// the whole demuxer, the synthetic stream fed in chunks of the given size
+static void BM_DemuxerFeed(Benchmark::State& state)
+{
+    std::vector<uint8_t> ts;
+    if (!loadStream(state, ts))
+        return;
+    const size_t chunk = state.arg();
+    uint64_t packets = 0;
+    for (auto _ : state) {
+        state.pauseTiming();
+        Demuxer demuxer;
+        demuxer.pkt().connect([&packets](const Packet&) { ++packets; });
+        std::vector<Buffer> buffers;
+        for (size_t off = 0; off < ts.size(); off += chunk) {
+            const size_t size = std::min(chunk, ts.size() - off);
+            Buffer buffer;
+            buffer.resize(size);
+            memcpy(buffer.data(), ts.data() + off, size);
+            buffers.push_back(std::move(buffer));
+        }
+        state.resumeTiming();
+        for (Buffer& buffer : buffers)
+            demuxer.feed(std::move(buffer));
+    }
+    state.setBytesProcessed(state.iterations() * ts.size());
+    state.setItemsProcessed(packets);
+}
+BENCHMARK(BM_DemuxerFeed)->arg(1316)->arg(65536);
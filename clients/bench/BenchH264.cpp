@@ -0,0 +1,338 @@
+#include "Benchmark.h"
+#include <memory>
+#include "h264_parser.h"
+#include "h264_bit_reader.h"
+#include "AVCC.h"
+#include "H264Targets.h"
+
+// start code offsets of every NALU in the synthetic stream by type
+struct NALUs
+{
+    std::vector<uint8_t> data;
+    std::vector<off_t> sps, pps, slices;
+
+    bool load(Benchmark::State& state);
+};
+
+bool NALUs::load(Benchmark::State& state)
+{
+    data = Benchmark::loadData("h264.264");
+    if (data.empty()) {
+        state.skip("h264.264 missing");
+        return false;
+    }
+    off_t pos = 0;
+    for (;;) {
+        off_t offset, startCodeSize;
+        if (!media::H264Parser::FindStartCode(data.data() + pos, data.size() - pos, &offset, &startCodeSize))
+            break;
+        const off_t start = pos + offset;
+        const off_t header = start + startCodeSize;
+        if (header >= static_cast<off_t>(data.size()))
+            break;
+        switch (data[header] & 0x1f) {
+        case media::H264NALU::kSPS:
+            sps.push_back(start);
+            break;
+        case media::H264NALU::kPPS:
+            pps.push_back(start);
+            break;
+        case media::H264NALU::kIDRSlice:
+        case media::H264NALU::kNonIDRSlice:
+            slices.push_back(start);
+            break;
+        default:
+            break;
+        }
+        pos = header;
+    }
+    if (sps.empty() || pps.empty() || slices.empty()) {
+        state.skip("h264.264 has no SPS, PPS or slices");
+        return false;
+    }
+    return true;
+}
+
+// scans the whole stream for start codes, the random slice data makes
+// for the worst case of few candidates far apart
+static void BM_FindStartCode(Benchmark::State& state)
+{
+    const std::vector<uint8_t> data = Benchmark::loadData("h264.264");
+    if (data.empty()) {
+        state.skip("h264.264 missing");
+        return;
+    }
+    uint64_t found = 0;
+    for (auto _ : state) {
+        off_t pos = 0;
+        for (;;) {
+            off_t offset, startCodeSize;
+            if (!media::H264Parser::FindStartCode(data.data() + pos, data.size() - pos, &offset, &startCodeSize))
+                break;
+            ++found;
+            pos += offset + startCodeSize;
+        }
+    }
+    state.setBytesProcessed(state.iterations() * data.size());
+    state.setItemsProcessed(found);
+}
+BENCHMARK(BM_FindStartCode);
+
+// the search for the end of the longest slice, which is what LocateNALU
+// spends its time on
+static void BM_FindStartCodeSlice(Benchmark::State& state)
+{
+    NALUs nalus;
+    if (!nalus.load(state))
+        return;
+    off_t start = 0, size = 0;
+    for (size_t i = 0; i < nalus.slices.size(); ++i) {
+        const off_t end = i + 1 < nalus.slices.size() ? nalus.slices[i + 1] : nalus.data.size();
+        if (end - nalus.slices[i] > size) {
+            start = nalus.slices[i] + 4;
+            size = end - start;
+        }
+    }
+    for (auto _ : state) {
+        off_t offset, startCodeSize;
+        media::H264Parser::FindStartCode(nalus.data.data() + start, size, &offset, &startCodeSize);
+        Benchmark::doNotOptimize(offset);
+    }
+    state.setBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_FindStartCodeSlice);
+
+// walking all the NALUs of every access unit, the way the renderer did it
+// before it had an index, then with one
+static void BM_AdvanceToNextNALU(Benchmark::State& state)
+{
+    NALUs nalus;
+    if (!nalus.load(state))
+        return;
+    media::H264Parser parser;
+    uint64_t count = 0;
+    for (auto _ : state) {
+        parser.SetStream(nalus.data.data(), nalus.data.size());
+        media::H264NALU nalu;
+        while (parser.AdvanceToNextNALU(&nalu) == media::H264Parser::kOk)
+            ++count;
+    }
+    state.setBytesProcessed(state.iterations() * nalus.data.size());
+    state.setItemsProcessed(count);
+}
+BENCHMARK(BM_AdvanceToNextNALU);
+
+static void BM_IndexNALUs(Benchmark::State& state)
+{
+    enum { MaxNALUs = 64 };
+
+    NALUs nalus;
+    if (!nalus.load(state))
+        return;
+    // access units start at the AUDs the synthetic stream has
+    std::vector<off_t> units;
+    std::vector<media::H264NALUEntry> all(nalus.data.size() / 3);
+    size_t num;
+    media::H264Parser::IndexNALUs(nalus.data.data(), nalus.data.size(), all.data(), all.size(), &num);
+    for (size_t i = 0; i < num; ++i) {
+        if (all[i].nal_unit_type == media::H264NALU::kAUD)
+            units.push_back(all[i].offset - all[i].start_code_size);
+    }
+    units.push_back(nalus.data.size());
+    media::H264NALUEntry entries[MaxNALUs];
+    uint64_t count = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i + 1 < units.size(); ++i) {
+            media::H264Parser::IndexNALUs(nalus.data.data() + units[i], units[i + 1] - units[i],
+                                          entries, MaxNALUs, &num);
+            count += num;
+        }
+    }
+    state.setBytesProcessed(state.iterations() * nalus.data.size());
+    state.setItemsProcessed(count);
+}
+BENCHMARK(BM_IndexNALUs);
+
+// AVCC frames for every access unit, copied the way the renderer has to
+// when it can't write to the packet and then rewritten in place
+static void BM_AVCC(Benchmark::State& state)
+{
+    enum { MaxNALUs = 64 };
+
+    NALUs nalus;
+    if (!nalus.load(state))
+        return;
+    std::vector<media::H264NALUEntry> all(nalus.data.size() / 3);
+    size_t num;
+    media::H264Parser::IndexNALUs(nalus.data.data(), nalus.data.size(), all.data(), all.size(), &num);
+    std::vector<std::pair<size_t, size_t> > units;
+    for (size_t i = 0; i < num; ++i) {
+        if (all[i].nal_unit_type == media::H264NALU::kAUD)
+            units.push_back(std::make_pair(i, i));
+        if (!units.empty())
+            ++units.back().second;
+    }
+    const AVCC avcc((1u << media::H264NALU::kSPS) | (1u << media::H264NALU::kPPS));
+    const bool inPlace = state.arg();
+    std::vector<uint8_t> frame(nalus.data.size());
+    AVCC::Span spans[MaxNALUs];
+    size_t numSpans = 0;
+    for (auto _ : state) {
+        for (const auto& unit : units) {
+            const media::H264NALUEntry* entries = all.data() + unit.first;
+            const size_t count = unit.second - unit.first;
+            if (inPlace) {
+                avcc.convertInPlace(nalus.data.data(), entries, count, spans, &numSpans);
+            } else {
+                avcc.convert(nalus.data.data(), entries, count, frame.data());
+            }
+        }
+        Benchmark::clobberMemory();
+    }
+    state.setLabel(inPlace ? "in place" : "copy");
+    state.setBytesProcessed(state.iterations() * nalus.data.size());
+    state.setItemsProcessed(state.iterations() * units.size());
+}
+BENCHMARK(BM_AVCC)->arg(0)->arg(1);
+
+// reads through slice data the given number of bits at a time, emulation
+// prevention bytes included
+static void BM_ReadBits(Benchmark::State& state)
+{
+    NALUs nalus;
+    if (!nalus.load(state))
+        return;
+    // the first slice of the IDR picture is the longest
+    const off_t start = nalus.slices.front() + 4;
+    const off_t end = nalus.slices.size() > 1 ? nalus.slices[1] : start + 1024;
+    const int bits = state.arg();
+    media::H264BitReader reader;
+    reader.Initialize(nalus.data.data() + start, end - start);
+    int value = 0;
+    for (auto _ : state) {
+        if (!reader.ReadBits(bits, &value)) {
+            state.pauseTiming();
+            reader.Initialize(nalus.data.data() + start, end - start);
+            state.resumeTiming();
+            reader.ReadBits(bits, &value);
+        }
+        Benchmark::doNotOptimize(value);
+    }
+    state.setBytesProcessed(state.iterations() * bits / 8);
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ReadBits)->arg(1)->arg(5)->arg(16)->arg(31);
+
+// a fresh parser has to parse the SPS, the one that has seen it already
+// only has to notice it's been sent again
+static void BM_ParseSPS(Benchmark::State& state)
+{
+    NALUs nalus;
+    if (!nalus.load(state))
+        return;
+    const off_t start = nalus.sps.front();
+    const off_t end = nalus.pps.front();
+    const bool resent = state.arg();
+    std::unique_ptr<media::H264Parser> parser(new media::H264Parser);
+    for (auto _ : state) {
+        if (!resent) {
+            state.pauseTiming();
+            parser.reset(new media::H264Parser);
+            state.resumeTiming();
+        }
+        parser->SetStream(nalus.data.data() + start, end - start);
+        media::H264NALU nalu;
+        int id;
+        if (parser->AdvanceToNextNALU(&nalu) != media::H264Parser::kOk
+            || parser->ParseSPS(&id) != media::H264Parser::kOk) {
+            state.skip("unable to parse SPS");
+            break;
+        }
+    }
+    state.setLabel(resent ? "re-sent" : "new");
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParseSPS)->arg(0)->arg(1);
+
+// only the start of each slice is handed to the parser so finding the
+// end of the NALU doesn't dominate
+static void BM_ParseSliceHeader(Benchmark::State& state)
+{
+    enum { HeaderBytes = 64 };
+
+    NALUs nalus;
+    if (!nalus.load(state))
+        return;
+    media::H264Parser parser;
+    parser.SetStream(nalus.data.data() + nalus.sps.front(), nalus.slices.front() - nalus.sps.front());
+    for (;;) {
+        media::H264NALU nalu;
+        if (parser.AdvanceToNextNALU(&nalu) != media::H264Parser::kOk)
+            break;
+        int id;
+        if (nalu.nal_unit_type == media::H264NALU::kSPS)
+            parser.ParseSPS(&id);
+        else if (nalu.nal_unit_type == media::H264NALU::kPPS)
+            parser.ParsePPS(&id);
+    }
+
+    size_t slice = 0;
+    for (auto _ : state) {
+        parser.SetStream(nalus.data.data() + nalus.slices[slice], HeaderBytes);
+        media::H264NALU nalu;
+        media::H264SliceHeader shdr;
+        if (parser.AdvanceToNextNALU(&nalu) != media::H264Parser::kOk
+            || parser.ParseSliceHeader(nalu, &shdr) != media::H264Parser::kOk) {
+            state.skip("unable to parse slice header");
+            break;
+        }
+        if (++slice == nalus.slices.size())
+            slice = 0;
+    }
+    state.setItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParseSliceHeader);
+
+// the fuzz targets over a whole corpus, --corpus or by default the
+// synthetic stream cut into access units
+static void BM_H264Corpus(Benchmark::State& state)
+{
+    std::vector<std::vector<uint8_t> > corpus = Benchmark::loadCorpus();
+    if (corpus.empty()) {
+        const std::vector<uint8_t> data = Benchmark::loadData("h264.264");
+        off_t pos = 0, start = 0;
+        for (;;) {
+            off_t offset, startCodeSize;
+            const bool found = media::H264Parser::FindStartCode(data.data() + pos, data.size() - pos,
+                                                                &offset, &startCodeSize);
+            const off_t next = found ? pos + offset : static_cast<off_t>(data.size());
+            const off_t header = found ? next + startCodeSize : next;
+            if (!found || (header < static_cast<off_t>(data.size()) && (data[header] & 0x1f) == media::H264NALU::kAUD)) {
+                if (next > start)
+                    corpus.emplace_back(data.begin() + start, data.begin() + next);
+                start = next;
+            }
+            if (!found)
+                break;
+            pos = header;
+        }
+    }
+    if (corpus.empty()) {
+        state.skip("no corpus and h264.264 missing");
+        return;
+    }
+
+    const H264Targets::Target target = static_cast<H264Targets::Target>(state.arg());
+    size_t bytes = 0;
+    for (const std::vector<uint8_t>& input : corpus)
+        bytes += input.size();
+    for (auto _ : state) {
+        for (const std::vector<uint8_t>& input : corpus)
+            H264Targets::run(target, input.data(), input.size());
+    }
+    state.setLabel(H264Targets::name(target));
+    state.setBytesProcessed(state.iterations() * bytes);
+    state.setItemsProcessed(state.iterations() * corpus.size());
+}
+BENCHMARK(BM_H264Corpus)->arg(H264Targets::NALU)->arg(H264Targets::SPS)->arg(H264Targets::PPS)
+    ->arg(H264Targets::SliceHeader)->arg(H264Targets::SEI)->arg(H264Targets::Stream);
@@ -0,0 +1,236 @@
+#include "Benchmark.h"
+#include "Options.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <regex>
+
+#ifndef BENCH_DATA_DIR
+#define BENCH_DATA_DIR "data"
+#endif
+
+namespace Benchmark {
+
+static std::vector<std::unique_ptr<Registration> >& registrations()
+{
+    static std::vector<std::unique_ptr<Registration> > regs;
+    return regs;
+}
+
+static std::string sDataDir = BENCH_DATA_DIR;
+static std::string sCorpusDir;
+
+State::State(uint64_t iterations, int64_t arg)
+    : mIterations(iterations), mArg(arg), mElapsed(Clock::duration::zero()), mRunning(false),
+      mBytes(0), mItems(0)
+{
+}
+
+State::Iterator State::begin()
+{
+    mRunning = true;
+    mStarted = Clock::now();
+    return Iterator(this, mError.empty() ? mIterations : 0);
+}
+
+State::Iterator State::end()
+{
+    return Iterator(this, 0);
+}
+
+void State::finish()
+{
+    if (mRunning) {
+        mElapsed += Clock::now() - mStarted;
+        mRunning = false;
+    }
+}
+
+void State::pauseTiming()
+{
+    finish();
+}
+
+void State::resumeTiming()
+{
+    mRunning = true;
+    mStarted = Clock::now();
+}
+
+Registration::Registration(const char* name, Function function)
+    : mName(name), mFunction(std::move(function))
+{
+}
+
+Registration* Registration::arg(int64_t arg)
+{
+    mArgs.push_back(arg);
+    return this;
+}
+
+Registration* Registration::range(int64_t from, int64_t to, int64_t multiplier)
+{
+    for (int64_t a = from; a < to; a *= multiplier)
+        mArgs.push_back(a);
+    mArgs.push_back(to);
+    return this;
+}
+
+Registration* add(const char* name, Registration::Function function)
+{
+    registrations().emplace_back(new Registration(name, std::move(function)));
+    return registrations().back().get();
+}
+
+std::vector<uint8_t> loadData(const char* name)
+{
+    const std::string path = sDataDir + "/" + name;
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return std::vector<uint8_t>();
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+std::vector<std::vector<uint8_t> > loadCorpus()
+{
+    std::vector<std::vector<uint8_t> > corpus;
+    if (sCorpusDir.empty())
+        return corpus;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(sCorpusDir, error)) {
+        if (!entry.is_regular_file())
+            continue;
+        std::ifstream file(entry.path(), std::ios::binary);
+        if (file)
+            corpus.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    return corpus;
+}
+
+class Runner
+{
+public:
+    Runner(double minTime, const std::regex& filter) : mMinTime(minTime), mFilter(filter) { }
+
+    int runAll();
+
+private:
+    void run(const Registration& reg, const std::string& name, int64_t arg);
+
+private:
+    double mMinTime;
+    std::regex mFilter;
+};
+
+static std::string formatRate(double rate, const char* unit)
+{
+    static const char* prefixes[] = { "", "k", "M", "G", "T" };
+    size_t prefix = 0;
+    const double base = strcmp(unit, "B/s") ? 1000. : 1024.;
+    while (rate >= base && prefix + 1 < sizeof(prefixes) / sizeof(prefixes[0])) {
+        rate /= base;
+        ++prefix;
+    }
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.2f %s%s", rate, prefixes[prefix], unit);
+    return buf;
+}
+
+void Runner::run(const Registration& reg, const std::string& name, int64_t arg)
+{
+    // one iteration first to warm up and estimate, then grow the count
+    // until a run is long enough to trust
+    uint64_t iterations = 1;
+    for (;;) {
+        State state(iterations, arg);
+        reg.mFunction(state);
+        state.finish();
+        if (!state.mError.empty()) {
+            printf("%-40s skipped: %s\n", name.c_str(), state.mError.c_str());
+            return;
+        }
+        const double seconds = std::chrono::duration<double>(state.mElapsed).count();
+        if (seconds >= mMinTime || iterations >= 1000000000) {
+            std::string rates;
+            if (state.mBytes)
+                rates += "  " + formatRate(state.mBytes / seconds, "B/s");
+            if (state.mItems)
+                rates += "  " + formatRate(state.mItems / seconds, "items/s");
+            if (!state.mLabel.empty())
+                rates += "  " + state.mLabel;
+            printf("%-40s %12.1f ns %12llu%s\n", name.c_str(), seconds * 1e9 / iterations,
+                   static_cast<unsigned long long>(iterations), rates.c_str());
+            fflush(stdout);
+            return;
+        }
+        // aim for 1.4 times the minimum, but never more than 10x per step
+        double next = seconds > 0 ? iterations * mMinTime * 1.4 / seconds : iterations * 10.;
+        if (next > iterations * 10.)
+            next = iterations * 10.;
+        iterations = std::max<uint64_t>(iterations + 1, static_cast<uint64_t>(next));
+    }
+}
+
+int Runner::runAll()
+{
+    printf("%-40s %15s %12s\n", "benchmark", "time", "iterations");
+    int ran = 0;
+    for (const auto& reg : registrations()) {
+        if (reg->mArgs.empty()) {
+            if (!std::regex_search(reg->mName, mFilter))
+                continue;
+            run(*reg, reg->mName, 0);
+            ++ran;
+            continue;
+        }
+        for (int64_t arg : reg->mArgs) {
+            const std::string name = reg->mName + "/" + std::to_string(arg);
+            if (!std::regex_search(name, mFilter))
+                continue;
+            run(*reg, name, arg);
+            ++ran;
+        }
+    }
+    if (!ran) {
+        fprintf(stderr, "no benchmarks matched\n");
+        return 1;
+    }
+    return 0;
+}
+
+int run(int argc, char** argv)
+{
+    const Options options = Options::parse(argc, argv);
+    if (options.enabled("help")) {
+        printf("Usage: %s [options]\n"
+               "  --filter <regex>    only run benchmarks whose name matches\n"
+               "  --min-time <ms>     minimum time per benchmark (default 500)\n"
+               "  --data <dir>        where the synthetic streams are (default %s)\n"
+               "  --corpus <dir>      fuzzer corpus for the corpus benchmarks\n",
+               argv[0], BENCH_DATA_DIR);
+        return 0;
+    }
+    sDataDir = options.get<std::string>("data").value_or(BENCH_DATA_DIR);
+    sCorpusDir = options.get<std::string>("corpus").value_or(std::string());
+    const double minTime = options.get<int>("min-time", 500) / 1000.;
+    std::regex filter;
+    try {
+        filter = std::regex(options.get<std::string>("filter").value_or("."));
+    } catch (const std::regex_error&) {
+        fprintf(stderr, "invalid filter\n");
+        return 1;
+    }
+
+    Runner runner(minTime, filter);
+    return runner.runAll();
+}
+
+} // namespace Benchmark
+
+int main(int argc, char** argv)
+{
+    return Benchmark::run(argc, argv);
+}
@@ -0,0 +1,161 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// A small stand-in for Google Benchmark so the suite builds with nothing
+// but the tree itself. Benchmarks register with BENCHMARK() and loop with
+//
+//     static void BM_Thing(Benchmark::State& state)
+//     {
+//         for (auto _ : state)
+//             Benchmark::doNotOptimize(thing(state.arg()));
+//         state.setBytesProcessed(state.iterations() * size);
+//     }
+//     BENCHMARK(BM_Thing)->arg(1)->arg(8);
+//
+// The runner grows the iteration count until a run takes at least the
+// minimum time and reports the time per iteration plus byte and item rates.
+namespace Benchmark {
+
+class State
+{
+public:
+    State(uint64_t iterations, int64_t arg);
+
+    class Iterator
+    {
+    public:
+        // what `for (auto _ : state)` gets, there's nothing in it and it
+        // doesn't count as an unused variable
+        struct [[maybe_unused]] Value { };
+
+        Iterator(State* state, uint64_t remaining) : mState(state), mRemaining(remaining) { }
+
+        Value operator*() const { return Value(); }
+        Iterator& operator++() { --mRemaining; return *this; }
+        bool operator!=(const Iterator&)
+        {
+            if (mRemaining)
+                return true;
+            mState->finish();
+            return false;
+        }
+
+    private:
+        State* mState;
+        uint64_t mRemaining;
+    };
+
+    // starts the clock, the loop stops it when it runs out
+    Iterator begin();
+    Iterator end();
+
+    uint64_t iterations() const { return mIterations; }
+    int64_t arg() const { return mArg; }
+
+    // exclude setup done inside the loop from the measurement
+    void pauseTiming();
+    void resumeTiming();
+
+    void setBytesProcessed(uint64_t bytes) { mBytes = bytes; }
+    void setItemsProcessed(uint64_t items) { mItems = items; }
+    void setLabel(const std::string& label) { mLabel = label; }
+    // give up on this benchmark, e.g. when its input is missing
+    void skip(const std::string& error) { mError = error; }
+
+private:
+    void finish();
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    uint64_t mIterations;
+    int64_t mArg;
+    Clock::time_point mStarted;
+    Clock::duration mElapsed;
+    bool mRunning;
+    uint64_t mBytes, mItems;
+    std::string mLabel, mError;
+
+    friend class Runner;
+};
+
+class Registration
+{
+public:
+    typedef std::function<void(State&)> Function;
+
+    Registration(const char* name, Function function);
+
+    Registration* arg(int64_t arg);
+    Registration* range(int64_t from, int64_t to, int64_t multiplier = 2);
+
+private:
+    std::string mName;
+    Function mFunction;
+    std::vector<int64_t> mArgs;
+
+    friend class Runner;
+};
+
+Registration* add(const char* name, Registration::Function function);
+
+// runs everything matching --filter, returns the exit code for main
+int run(int argc, char** argv);
+
+// the synthetic streams, from --data or the directory they're checked in to
+std::vector<uint8_t> loadData(const char* name);
+
+// every file in the --corpus directory, empty without one
+std::vector<std::vector<uint8_t> > loadCorpus();
+
+// keeps the compiler from discarding a value or the work that produced it
+template<typename T>
+inline void doNotOptimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void clobberMemory()
+{
+    asm volatile("" : : : "memory");
+}
+
+// for breaking a benchmark down into stages, the time stamp counter where
+// there is one and nanoseconds elsewhere. cyclesUnit() says which
+inline uint64_t cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+inline const char* cyclesUnit()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+} // namespace Benchmark
+
+#define BENCHMARK_CONCAT2(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT2(a, b)
+#define BENCHMARK(function)                                             \
+    static Benchmark::Registration* BENCHMARK_CONCAT(sBenchmark, __LINE__) = \
+        Benchmark::add(#function, function)
+
+#endif
@@ -0,0 +1,1078 @@
+// Generates the synthetic streams the benchmarks run on. Nothing here is
+// a real encoder, the point is bitstreams that are valid and shaped like
+// what the HD60 sends so the parsers and decoders do representative work:
+//
+//   h264.264     Annex B High profile 1080p60, AUD/SPS/PPS/IDR then P
+//                pictures, four slices each, random slice data
+//   aac_lc.adts  AAC LC stereo 48 kHz, ~256 kbit/s, long windows with a
+//                start/eight short/stop transient every 16 frames
+//   aac_he.adts  HE-AAC stereo, AAC LC core at 24 kHz with SBR data in a
+//                fill element so faad2 runs the full SBR decoder, the
+//                same window switching as LC
+//   stream.ts    the video and LC audio muxed into MPEG-TS
+//
+// The AAC and SBR Huffman encoders are built by running faad2's own
+// decoders over every bit pattern, so whatever faad2 decodes is by
+// construction what we meant to write.
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+extern "C" {
+#include "common.h"
+#include "structs.h"
+#include "syntax.h"
+#include "bits.h"
+#include "huffman.h"
+#include "sbr_dec.h"
+#include "sbr_huff.h"
+#include "sbr_syntax.h"
+}
+// common.h defines these as macros
+#undef min
+#undef max
+
+namespace {
+
+class BitWriter
+{
+public:
+    BitWriter() : mAcc(0), mBits(0) { }
+
+    void put(uint32_t value, int bits)
+    {
+        for (int i = bits - 1; i >= 0; --i)
+            putBit((value >> i) & 1);
+    }
+    void putBit(int bit)
+    {
+        mAcc = (mAcc << 1) | (bit & 1);
+        if (++mBits == 8) {
+            mBytes.push_back(mAcc);
+            mAcc = 0;
+            mBits = 0;
+        }
+    }
+    void putUE(uint32_t value)
+    {
+        const uint32_t v = value + 1;
+        int len = 0;
+        while ((v >> len) > 1)
+            ++len;
+        put(0, len);
+        put(v, len + 1);
+    }
+    void putSE(int32_t value)
+    {
+        putUE(value > 0 ? 2 * value - 1 : -2 * value);
+    }
+    void append(const BitWriter& other)
+    {
+        for (uint8_t byte : other.mBytes)
+            put(byte, 8);
+        put(other.mAcc, other.mBits);
+    }
+    void align(int bit = 0)
+    {
+        while (mBits)
+            putBit(bit);
+    }
+    // rbsp_stop_one_bit and alignment
+    void trailing()
+    {
+        putBit(1);
+        align();
+    }
+
+    size_t bits() const { return mBytes.size() * 8 + mBits; }
+    const std::vector<uint8_t>& bytes() const { return mBytes; }
+
+private:
+    std::vector<uint8_t> mBytes;
+    uint32_t mAcc;
+    int mBits;
+};
+
+struct Code
+{
+    Code() : bits(0), len(0) { }
+
+    uint32_t bits;
+    int len;
+};
+
+static void putCode(BitWriter& writer, const Code& code)
+{
+    writer.put(code.bits, code.len);
+}
+
+// Runs decode over every maxBits long pattern and reports each distinct
+// prefix it consumed. decode returns the bits consumed or -1.
+static void enumerate(int maxBits, const std::function<int(bitfile*)>& decode,
+                      const std::function<void(const Code&)>& found)
+{
+    const uint64_t end = uint64_t(1) << maxBits;
+    uint64_t pattern = 0;
+    while (pattern < end) {
+        uint8_t buffer[16] = { 0 };
+        const uint64_t aligned = pattern << (64 - maxBits);
+        for (int i = 0; i < 8; ++i)
+            buffer[i] = aligned >> (56 - 8 * i);
+        bitfile ld;
+        faad_initbits(&ld, buffer, sizeof(buffer));
+        const int used = decode(&ld);
+        faad_endbits(&ld);
+        if (used <= 0 || used > maxBits) {
+            ++pattern;
+            continue;
+        }
+        Code code;
+        code.bits = pattern >> (maxBits - used);
+        code.len = used;
+        found(code);
+        pattern = (uint64_t(code.bits) + 1) << (maxBits - used);
+    }
+}
+
+class AACTables
+{
+public:
+    AACTables();
+
+    // scalefactor delta, -60 to 60
+    const Code& scalefactor(int delta) const { return mScalefactor[delta + 60]; }
+    // appends the codeword for values[0..dim) in codebook cb, with sign
+    // bits and escapes
+    bool spectral(BitWriter& writer, int cb, const int* values) const;
+    // rough cost in bits, for picking codebooks
+    int cost(int cb, const int* values) const;
+
+    // SBR deltas in frequency direction
+    const Code& envelope(int delta) const { return mEnvelope[delta + 60]; }
+    const Code& noise(int delta) const { return mNoise[delta + 31]; }
+
+    static int dimension(int cb) { return cb < 5 ? 4 : 2; }
+    static int largest(int cb)
+    {
+        static const int lav[] = { 0, 1, 1, 2, 2, 4, 4, 7, 7, 12, 12, 16 };
+        return lav[cb];
+    }
+
+private:
+    static int key(const int* values, int dim)
+    {
+        int k = 0;
+        for (int i = 0; i < dim; ++i)
+            k = k * 33 + values[i] + 16;
+        return k;
+    }
+
+    Code mScalefactor[121];
+    std::unordered_map<int, Code> mSpectral[12];
+    // key of the values the last spectral decode produced, -1 for none
+    int mPending;
+    Code mEnvelope[121], mNoise[63];
+};
+
+AACTables::AACTables()
+    : mPending(-1)
+{
+    enumerate(19, [](bitfile* ld) {
+            const int value = huffman_scale_factor(ld);
+            return value < 0 ? -1 : int(faad_get_processed_bits(ld));
+        }, [this](const Code& code) {
+            uint8_t buffer[8] = { uint8_t(code.bits << (32 - code.len) >> 24), uint8_t(code.bits << (32 - code.len) >> 16),
+                                  uint8_t(code.bits << (32 - code.len) >> 8), uint8_t(code.bits << (32 - code.len)) };
+            bitfile ld;
+            faad_initbits(&ld, buffer, sizeof(buffer));
+            mScalefactor[huffman_scale_factor(&ld)] = code;
+            faad_endbits(&ld);
+        });
+
+    for (int cb = 1; cb <= 11; ++cb) {
+        const int dim = dimension(cb);
+        // codeword, sign bits and two minimal escapes for 16
+        const int maxBits = cb == 11 ? 26 : 19;
+        enumerate(maxBits, [cb, dim, this](bitfile* ld) {
+                int16_t sp[4] = { 0 };
+                mPending = -1;
+                if (huffman_spectral_data(cb, ld, sp))
+                    return -1;
+                const int used = faad_get_processed_bits(ld);
+                int values[4];
+                for (int i = 0; i < dim; ++i) {
+                    if (sp[i] > 16 || sp[i] < -16)
+                        return used;
+                    values[i] = sp[i];
+                }
+                mPending = key(values, dim);
+                return used;
+            }, [cb, this](const Code& code) {
+                if (mPending >= 0 && !mSpectral[cb].count(mPending))
+                    mSpectral[cb][mPending] = code;
+                mPending = -1;
+            });
+    }
+
+    // the SBR tables are only reachable through sbr_envelope/sbr_noise,
+    // set up one envelope of two bands so the second one is our delta
+    sbr_info* sbr = sbrDecodeInit(1024, ID_SCE, 48000, 0);
+    for (int noise = 0; noise < 2; ++noise) {
+        const int maxBits = 20;
+        enumerate(maxBits, [sbr, noise](bitfile* ld) {
+                sbr->bs_coupling = 0;
+                sbr->bs_frame_class[0] = FIXFIX;
+                sbr->L_E[0] = sbr->L_Q[0] = 1;
+                sbr->f[0][0] = 1;
+                sbr->n[1] = 2;
+                sbr->N_Q = 2;
+                sbr->bs_df_env[0][0] = sbr->bs_df_noise[0][0] = 0;
+                if (noise)
+                    sbr_noise(ld, sbr, 0);
+                else
+                    sbr_envelope(ld, sbr, 0);
+                return int(faad_get_processed_bits(ld));
+            }, [sbr, noise, this](const Code& code) {
+                // the pattern starts with the absolute first value,
+                // 7 bits of 64 for the envelope and 5 bits of 16 for noise
+                if (noise) {
+                    const int delta = sbr->Q[0][1][0] - sbr->Q[0][0][0];
+                    if (code.bits >> (code.len - 5) == 16 && delta >= -31 && delta <= 31 && !mNoise[delta + 31].len) {
+                        mNoise[delta + 31].bits = code.bits & ((1u << (code.len - 5)) - 1);
+                        mNoise[delta + 31].len = code.len - 5;
+                    }
+                } else {
+                    const int delta = sbr->E[0][1][0] - sbr->E[0][0][0];
+                    if (code.bits >> (code.len - 7) == 64 && delta >= -60 && delta <= 60 && !mEnvelope[delta + 60].len) {
+                        mEnvelope[delta + 60].bits = code.bits & ((1u << (code.len - 7)) - 1);
+                        mEnvelope[delta + 60].len = code.len - 7;
+                    }
+                }
+            });
+    }
+    sbrDecodeEnd(sbr);
+}
+
+bool AACTables::spectral(BitWriter& writer, int cb, const int* values) const
+{
+    const int dim = dimension(cb);
+    int clamped[4];
+    int escapes = 0;
+    for (int i = 0; i < dim; ++i) {
+        clamped[i] = values[i];
+        if (cb == 11 && std::abs(values[i]) >= 16) {
+            clamped[i] = values[i] < 0 ? -16 : 16;
+            ++escapes;
+        }
+    }
+    const auto it = mSpectral[cb].find(key(clamped, dim));
+    if (it == mSpectral[cb].end())
+        return false;
+    // the table entry for 16 carries the shortest escape, 5 zero bits,
+    // replace those with the real ones
+    Code code = it->second;
+    code.bits >>= 5 * escapes;
+    code.len -= 5 * escapes;
+    putCode(writer, code);
+    for (int i = 0; i < dim && escapes; ++i) {
+        const int value = std::abs(values[i]);
+        if (cb != 11 || value < 16)
+            continue;
+        int n = 4;
+        while ((value >> (n + 1)) > 0)
+            ++n;
+        writer.put((1u << (n - 4)) - 1, n - 4);
+        writer.putBit(0);
+        writer.put(value - (1 << n), n);
+    }
+    return true;
+}
+
+int AACTables::cost(int cb, const int* values) const
+{
+    const int dim = dimension(cb);
+    int clamped[4];
+    int extra = 0;
+    for (int i = 0; i < dim; ++i) {
+        clamped[i] = values[i];
+        if (cb == 11 && std::abs(values[i]) >= 16) {
+            clamped[i] = values[i] < 0 ? -16 : 16;
+            int n = 4;
+            while ((std::abs(values[i]) >> (n + 1)) > 0)
+                ++n;
+            extra += 2 * n - 4 + 1 - 5;
+        }
+    }
+    const auto it = mSpectral[cb].find(key(clamped, dim));
+    return it == mSpectral[cb].end() ? 1 << 20 : it->second.len + extra;
+}
+
+static const uint16_t SwbOffset48[] = {
+    0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 48, 56, 64, 72,
+    80, 88, 96, 108, 120, 132, 144, 160, 176, 196, 216, 240, 264, 292,
+    320, 352, 384, 416, 448, 480, 512, 544, 576, 608, 640, 672, 704, 736,
+    768, 800, 832, 864, 896, 928, 1024
+};
+
+static const uint16_t SwbOffset24[] = {
+    0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 52, 60, 68,
+    76, 84, 92, 100, 108, 116, 124, 136, 148, 160, 172, 188, 204, 220,
+    240, 260, 284, 308, 336, 364, 396, 432, 468, 508, 552, 600, 652, 704,
+    768, 832, 896, 960, 1024
+};
+
+static const uint16_t SwbOffsetShort48[] = {
+    0, 4, 8, 12, 16, 20, 28, 36, 44, 56, 68, 80, 96, 112, 128
+};
+
+static const uint16_t SwbOffsetShort24[] = {
+    0, 4, 8, 12, 16, 20, 24, 28, 36, 44, 52, 64, 76, 92, 108, 128
+};
+
+enum {
+    // a transient every TransientPeriod frames, the frames before and
+    // after it switch the window over
+    TransientPeriod = 16,
+    // the eight short windows grouped 3/1/4, the bits say which windows
+    // share the scale factors of the one before
+    ShortGrouping = 0x67,
+    ShortGroups = 3
+};
+
+static const int ShortGroupLength[ShortGroups] = { 3, 1, 4 };
+
+class AACWriter
+{
+public:
+    struct Config
+    {
+        int sampleRateIndex;
+        const uint16_t* swbOffset;
+        const uint16_t* swbOffsetShort;
+        // bands actually coded, the rest is left to SBR or silence
+        int maxSfb;
+        // spectral amplitude at dc, falls off towards maxSfb
+        double amplitude;
+        bool sbr;
+    };
+
+    AACWriter(const AACTables& tables, const Config& config, unsigned int seed);
+
+    std::vector<uint8_t> frame();
+
+private:
+    // how the coefficients of one channel are coded, q holds them in
+    // bitstream order: by group, band and then window
+    struct Layout
+    {
+        const uint16_t* swb;
+        int maxSfb;
+        bool isShort;
+        int groups;
+        const int* groupLength;
+    };
+
+    int windowSequence() const;
+    void channel(BitWriter& writer, const Layout& layout, const int* q);
+    void sbrPayload(BitWriter& writer);
+
+    const AACTables& mTables;
+    Config mConfig;
+    std::mt19937 mRandom;
+    int mFrame;
+    // SBR frequency tables for our header, filled in by probing faad2
+    int mSbrHigh, mSbrNoise;
+};
+
+enum {
+    SbrStartFreq = 5,
+    SbrStopFreq = 9,
+    SbrXoverBand = 0
+};
+
+static void sbrHeader(BitWriter& writer)
+{
+    writer.putBit(0); // bs_amp_res
+    writer.put(SbrStartFreq, 4);
+    writer.put(SbrStopFreq, 4);
+    writer.put(SbrXoverBand, 3);
+    writer.put(0, 2); // reserved
+    writer.putBit(0); // bs_header_extra_1
+    writer.putBit(0); // bs_header_extra_2
+}
+
+AACWriter::AACWriter(const AACTables& tables, const Config& config, unsigned int seed)
+    : mTables(tables), mConfig(config), mRandom(seed), mFrame(0), mSbrHigh(0), mSbrNoise(0)
+{
+    if (!config.sbr)
+        return;
+    // let faad2 work out how many envelope and noise bands our header
+    // means, sbr_extension_data derives the tables before parsing sbr_data
+    BitWriter probe;
+    probe.put(EXT_SBR_DATA, 4);
+    probe.putBit(1);
+    sbrHeader(probe);
+    probe.align();
+    std::vector<uint8_t> buffer = probe.bytes();
+    buffer.resize(256);
+    sbr_info* sbr = sbrDecodeInit(1024, ID_CPE, 48000, 0);
+    bitfile ld;
+    faad_initbits(&ld, buffer.data(), buffer.size());
+    sbr_extension_data(&ld, sbr, 200, 0);
+    faad_endbits(&ld);
+    mSbrHigh = sbr->N_high;
+    mSbrNoise = sbr->N_Q;
+    sbrDecodeEnd(sbr);
+}
+
+// ONLY_LONG_SEQUENCE mostly, the transient at the end of every period
+// takes a frame each of LONG_START, EIGHT_SHORT and LONG_STOP
+int AACWriter::windowSequence() const
+{
+    switch (mFrame % TransientPeriod) {
+    case TransientPeriod - 3:
+        return LONG_START_SEQUENCE;
+    case TransientPeriod - 2:
+        return EIGHT_SHORT_SEQUENCE;
+    case TransientPeriod - 1:
+        return LONG_STOP_SEQUENCE;
+    default:
+        return ONLY_LONG_SEQUENCE;
+    }
+}
+
+void AACWriter::channel(BitWriter& writer, const Layout& layout, const int* q)
+{
+    const uint16_t* swb = layout.swb;
+    const int maxSfb = layout.maxSfb;
+
+    // cheapest codebook per group and band, then merge runs into sections
+    int cbs[8][64];
+    const int* values = q;
+    for (int g = 0; g < layout.groups; ++g) {
+        for (int band = 0; band < maxSfb; ++band) {
+            const int count = layout.groupLength[g] * (swb[band + 1] - swb[band]);
+            int largest = 0;
+            for (int k = 0; k < count; ++k)
+                largest = std::max(largest, std::abs(values[k]));
+            if (!largest) {
+                cbs[g][band] = 0;
+                values += count;
+                continue;
+            }
+            int best = 11, bestCost = 1 << 30;
+            for (int cb = 1; cb <= 11; ++cb) {
+                if (largest > AACTables::largest(cb) && cb != 11)
+                    continue;
+                const int dim = AACTables::dimension(cb);
+                int cost = 0;
+                for (int k = 0; k < count; k += dim)
+                    cost += mTables.cost(cb, values + k);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    best = cb;
+                }
+            }
+            cbs[g][band] = best;
+            values += count;
+        }
+    }
+
+    const int globalGain = 150;
+    writer.put(globalGain, 8);
+
+    // section_data, shorter section lengths for short windows
+    const int sectBits = layout.isShort ? 3 : 5;
+    const int sectEscape = (1 << sectBits) - 1;
+    for (int g = 0; g < layout.groups; ++g) {
+        for (int band = 0; band < maxSfb;) {
+            int end = band + 1;
+            while (end < maxSfb && cbs[g][end] == cbs[g][band])
+                ++end;
+            writer.put(cbs[g][band], 4);
+            int len = end - band;
+            while (len >= sectEscape) {
+                writer.put(sectEscape, sectBits);
+                len -= sectEscape;
+            }
+            writer.put(len, sectBits);
+            band = end;
+        }
+    }
+
+    // scale_factor_data, a slow random walk around the global gain
+    std::uniform_int_distribution<int> step(-2, 2);
+    int sf = globalGain;
+    for (int g = 0; g < layout.groups; ++g) {
+        for (int band = 0; band < maxSfb; ++band) {
+            if (!cbs[g][band])
+                continue;
+            int delta = step(mRandom);
+            if (sf + delta < globalGain - 10 || sf + delta > globalGain + 10)
+                delta = -delta;
+            sf += delta;
+            putCode(writer, mTables.scalefactor(delta));
+        }
+    }
+
+    writer.putBit(0); // pulse_data_present
+    writer.putBit(0); // tns_data_present
+    writer.putBit(0); // gain_control_data_present
+
+    // spectral_data
+    values = q;
+    for (int g = 0; g < layout.groups; ++g) {
+        for (int band = 0; band < maxSfb; ++band) {
+            const int count = layout.groupLength[g] * (swb[band + 1] - swb[band]);
+            const int cb = cbs[g][band];
+            if (cb) {
+                const int dim = AACTables::dimension(cb);
+                for (int k = 0; k < count; k += dim)
+                    mTables.spectral(writer, cb, values + k);
+            }
+            values += count;
+        }
+    }
+}
+
+void AACWriter::sbrPayload(BitWriter& writer)
+{
+    std::uniform_int_distribution<int> envelopeStep(-3, 3);
+    std::uniform_int_distribution<int> noiseStep(-2, 2);
+
+    writer.put(EXT_SBR_DATA, 4);
+    writer.putBit(1);
+    sbrHeader(writer);
+
+    // sbr_channel_pair_element, uncoupled
+    writer.putBit(0); // bs_data_extra
+    writer.putBit(0); // bs_coupling
+    for (int ch = 0; ch < 2; ++ch) {
+        writer.put(FIXFIX, 2);
+        writer.put(0, 2); // one envelope
+        writer.putBit(1); // high frequency resolution
+    }
+    for (int ch = 0; ch < 2; ++ch) {
+        writer.putBit(0); // bs_df_env
+        writer.putBit(0); // bs_df_noise
+    }
+    for (int ch = 0; ch < 2; ++ch) {
+        for (int band = 0; band < mSbrNoise; ++band)
+            writer.put(1, 2); // bs_invf_mode
+    }
+    for (int ch = 0; ch < 2; ++ch) {
+        // envelope energies falling off with frequency
+        writer.put(40 + (mRandom() % 8), 7);
+        for (int band = 1; band < mSbrHigh; ++band)
+            putCode(writer, mTables.envelope(envelopeStep(mRandom) - 1));
+    }
+    for (int ch = 0; ch < 2; ++ch) {
+        writer.put(8 + (mRandom() % 4), 5);
+        for (int band = 1; band < mSbrNoise; ++band)
+            putCode(writer, mTables.noise(noiseStep(mRandom)));
+    }
+    writer.putBit(0); // bs_add_harmonic_flag
+    writer.putBit(0);
+    writer.putBit(0); // bs_extended_data
+    writer.align();
+}
+
+std::vector<uint8_t> AACWriter::frame()
+{
+    static const int LongGroupLength[] = { 1 };
+    const int sequence = windowSequence();
+    Layout layout = { mConfig.swbOffset, mConfig.maxSfb, false, 1, LongGroupLength };
+    if (sequence == EIGHT_SHORT_SEQUENCE) {
+        // the short bands covering what the long ones do
+        const int top = mConfig.swbOffset[mConfig.maxSfb] / 8;
+        int maxSfb = 0;
+        while (mConfig.swbOffsetShort[maxSfb] < top && mConfig.swbOffsetShort[maxSfb] < 128)
+            ++maxSfb;
+        layout = { mConfig.swbOffsetShort, maxSfb, true, ShortGroups, ShortGroupLength };
+    }
+    const int coefficients = layout.swb[layout.maxSfb];
+
+    // the second channel is the side signal, smaller than the first. the
+    // short windows each get an eighth of the energy
+    int q[2][1024];
+    for (int ch = 0; ch < 2; ++ch) {
+        std::fill(q[ch], q[ch] + 1024, 0);
+        const double level = mConfig.amplitude * (ch ? 0.3 : 1.) * (0.8 + 0.4 * std::sin(mFrame * 0.3))
+            * (layout.isShort ? 0.35 : 1.);
+        int* value = q[ch];
+        for (int g = 0; g < layout.groups; ++g) {
+            for (int band = 0; band < layout.maxSfb; ++band) {
+                for (int w = 0; w < layout.groupLength[g]; ++w) {
+                    for (int k = layout.swb[band]; k < layout.swb[band + 1]; ++k) {
+                        const double scale = level * std::exp(-3. * k / coefficients);
+                        std::exponential_distribution<double> magnitude(1. / scale);
+                        const int v = int(magnitude(mRandom) + .5);
+                        *value++ = (mRandom() & 1) ? -v : v;
+                    }
+                }
+            }
+        }
+    }
+    ++mFrame;
+
+    BitWriter raw;
+    // channel_pair_element with a common window, all bands M/S
+    raw.put(ID_CPE, 3);
+    raw.put(0, 4);
+    raw.putBit(1);
+    raw.putBit(0); // ics_reserved_bit
+    raw.put(sequence, 2);
+    raw.putBit(1); // kbd window
+    if (layout.isShort) {
+        raw.put(layout.maxSfb, 4);
+        raw.put(ShortGrouping, 7);
+    } else {
+        raw.put(layout.maxSfb, 6);
+        raw.putBit(0); // predictor_data_present
+    }
+    raw.put(2, 2); // ms_mask_present, all bands
+    channel(raw, layout, q[0]);
+    channel(raw, layout, q[1]);
+
+    if (mConfig.sbr) {
+        BitWriter sbr;
+        sbrPayload(sbr);
+        const int count = sbr.bytes().size();
+        raw.put(ID_FIL, 3);
+        if (count < 15) {
+            raw.put(count, 4);
+        } else {
+            raw.put(15, 4);
+            raw.put(count - 14, 8);
+        }
+        raw.append(sbr);
+    }
+    raw.put(ID_END, 3);
+    raw.align();
+
+    const size_t length = raw.bytes().size() + 7;
+    BitWriter adts;
+    adts.put(0xfff, 12);
+    adts.putBit(0); // mpeg-4
+    adts.put(0, 2); // layer
+    adts.putBit(1); // protection_absent
+    adts.put(1, 2); // profile, LC
+    adts.put(mConfig.sampleRateIndex, 4);
+    adts.putBit(0); // private
+    adts.put(2, 3); // channel configuration
+    adts.putBit(0); // original
+    adts.putBit(0); // home
+    adts.putBit(0); // copyright id bit
+    adts.putBit(0); // copyright id start
+    adts.put(length, 13);
+    adts.put(0x7ff, 11); // buffer fullness, vbr
+    adts.put(0, 2); // one raw data block
+    adts.append(raw);
+    return adts.bytes();
+}
+
+// Escapes an RBSP into a NAL unit with the Annex B start code in front.
+static void appendNAL(std::vector<uint8_t>& out, int refIdc, int type, const std::vector<uint8_t>& rbsp)
+{
+    static const uint8_t startCode[] = { 0, 0, 0, 1 };
+    out.insert(out.end(), startCode, startCode + 4);
+    out.push_back((refIdc << 5) | type);
+    int zeros = 0;
+    for (uint8_t byte : rbsp) {
+        if (zeros >= 2 && byte <= 3) {
+            out.push_back(3);
+            zeros = 0;
+        }
+        out.push_back(byte);
+        zeros = byte ? 0 : zeros + 1;
+    }
+}
+
+class H264Writer
+{
+public:
+    enum {
+        Width = 1920,
+        Height = 1080,
+        MbsWide = (Width + 15) / 16,
+        MbsHigh = (Height + 15) / 16,
+        SlicesPerPicture = 4,
+        Log2MaxFrameNum = 4,
+        Log2MaxPocLsb = 6
+    };
+
+    H264Writer(unsigned int seed) : mRandom(seed), mFrame(0), mIdrId(0), mFrameNum(0) { }
+
+    // one access unit, parameter sets and an IDR every gop pictures
+    std::vector<uint8_t> picture(int gop, size_t idrBytes, size_t pBytes);
+
+private:
+    std::vector<uint8_t> sps() const;
+    std::vector<uint8_t> pps() const;
+    std::vector<uint8_t> slice(bool idr, int index, size_t bytes);
+
+    std::mt19937 mRandom;
+    int mFrame, mIdrId;
+    int mFrameNum;
+};
+
+std::vector<uint8_t> H264Writer::sps() const
+{
+    BitWriter w;
+    w.put(100, 8); // high profile
+    w.put(0, 8);
+    w.put(42, 8); // level 4.2
+    w.putUE(0); // seq_parameter_set_id
+    w.putUE(1); // chroma_format_idc
+    w.putUE(0); // bit_depth_luma_minus8
+    w.putUE(0); // bit_depth_chroma_minus8
+    w.putBit(0); // qpprime_y_zero_transform_bypass_flag
+    w.putBit(0); // seq_scaling_matrix_present_flag
+    w.putUE(Log2MaxFrameNum - 4);
+    w.putUE(0); // pic_order_cnt_type
+    w.putUE(Log2MaxPocLsb - 4);
+    w.putUE(1); // max_num_ref_frames
+    w.putBit(0); // gaps_in_frame_num_value_allowed_flag
+    w.putUE(MbsWide - 1);
+    w.putUE(MbsHigh - 1);
+    w.putBit(1); // frame_mbs_only_flag
+    w.putBit(1); // direct_8x8_inference_flag
+    w.putBit(1); // frame_cropping_flag
+    w.putUE(0);
+    w.putUE(0);
+    w.putUE(0);
+    w.putUE((MbsHigh * 16 - Height) / 2);
+    w.putBit(1); // vui_parameters_present_flag
+    w.putBit(1); // aspect_ratio_info_present_flag
+    w.put(1, 8); // square pixels
+    w.putBit(0); // overscan_info_present_flag
+    w.putBit(1); // video_signal_type_present_flag
+    w.put(5, 3); // unspecified video format
+    w.putBit(0); // limited range
+    w.putBit(1); // colour_description_present_flag
+    w.put(1, 8); // bt.709
+    w.put(1, 8);
+    w.put(1, 8);
+    w.putBit(0); // chroma_loc_info_present_flag
+    w.putBit(1); // timing_info_present_flag
+    w.put(1, 32); // num_units_in_tick
+    w.put(120, 32); // time_scale, 60 fps
+    w.putBit(1); // fixed_frame_rate_flag
+    w.putBit(0); // nal_hrd_parameters_present_flag
+    w.putBit(0); // vcl_hrd_parameters_present_flag
+    w.putBit(0); // pic_struct_present_flag
+    w.putBit(1); // bitstream_restriction_flag
+    w.putBit(1); // motion_vectors_over_pic_boundaries_flag
+    w.putUE(2); // max_bytes_per_pic_denom
+    w.putUE(1); // max_bits_per_mb_denom
+    w.putUE(16); // log2_max_mv_length_horizontal
+    w.putUE(16); // log2_max_mv_length_vertical
+    w.putUE(0); // max_num_reorder_frames
+    w.putUE(1); // max_dec_frame_buffering
+    w.trailing();
+    return w.bytes();
+}
+
+std::vector<uint8_t> H264Writer::pps() const
+{
+    BitWriter w;
+    w.putUE(0); // pic_parameter_set_id
+    w.putUE(0); // seq_parameter_set_id
+    w.putBit(1); // entropy_coding_mode_flag, cabac
+    w.putBit(0); // bottom_field_pic_order_in_frame_present_flag
+    w.putUE(0); // num_slice_groups_minus1
+    w.putUE(0); // num_ref_idx_l0_default_active_minus1
+    w.putUE(0); // num_ref_idx_l1_default_active_minus1
+    w.putBit(0); // weighted_pred_flag
+    w.put(0, 2); // weighted_bipred_idc
+    w.putSE(0); // pic_init_qp_minus26
+    w.putSE(0); // pic_init_qs_minus26
+    w.putSE(0); // chroma_qp_index_offset
+    w.putBit(1); // deblocking_filter_control_present_flag
+    w.putBit(0); // constrained_intra_pred_flag
+    w.putBit(0); // redundant_pic_cnt_present_flag
+    w.putBit(1); // transform_8x8_mode_flag
+    w.putBit(0); // pic_scaling_matrix_present_flag
+    w.putSE(0); // second_chroma_qp_index_offset
+    w.trailing();
+    return w.bytes();
+}
+
+std::vector<uint8_t> H264Writer::slice(bool idr, int index, size_t bytes)
+{
+    BitWriter w;
+    w.putUE(index * (MbsWide * MbsHigh / SlicesPerPicture)); // first_mb_in_slice
+    w.putUE(idr ? 7 : 5); // all I or all P
+    w.putUE(0); // pic_parameter_set_id
+    w.put(mFrameNum, Log2MaxFrameNum);
+    if (idr)
+        w.putUE(mIdrId);
+    w.put((2 * mFrame) % (1 << Log2MaxPocLsb), Log2MaxPocLsb);
+    if (!idr) {
+        w.putBit(0); // num_ref_idx_active_override_flag
+        w.putBit(0); // ref_pic_list_modification_flag_l0
+    }
+    // dec_ref_pic_marking
+    if (idr) {
+        w.putBit(0); // no_output_of_prior_pics_flag
+        w.putBit(0); // long_term_reference_flag
+    } else {
+        w.putBit(0); // adaptive_ref_pic_marking_mode_flag
+    }
+    if (!idr)
+        w.putUE(0); // cabac_init_idc
+    w.putSE(int(mRandom() % 7) - 3); // slice_qp_delta
+    w.putUE(0); // disable_deblocking_filter_idc
+    w.putSE(0);
+    w.putSE(0);
+    w.align(1); // cabac_alignment_one_bit
+
+    // stand-in for the cabac data, must not end in a zero byte
+    std::vector<uint8_t> rbsp = w.bytes();
+    std::uniform_int_distribution<int> byte(0, 255);
+    while (rbsp.size() < bytes)
+        rbsp.push_back(byte(mRandom));
+    rbsp.push_back(0x80);
+    return rbsp;
+}
+
+std::vector<uint8_t> H264Writer::picture(int gop, size_t idrBytes, size_t pBytes)
+{
+    const bool idr = !(mFrame % gop);
+    std::vector<uint8_t> out;
+
+    BitWriter aud;
+    aud.put(idr ? 0 : 1, 3); // primary_pic_type
+    aud.trailing();
+    appendNAL(out, 0, 9, aud.bytes());
+
+    if (idr) {
+        appendNAL(out, 3, 7, sps());
+        appendNAL(out, 3, 8, pps());
+        mFrame = 0;
+        mFrameNum = 0;
+        mIdrId = (mIdrId + 1) % 16;
+    }
+    std::normal_distribution<double> jitter(1., .15);
+    const size_t bytes = (idr ? idrBytes : pBytes) * std::max(jitter(mRandom), .5) / SlicesPerPicture;
+    for (int i = 0; i < SlicesPerPicture; ++i)
+        appendNAL(out, idr ? 3 : 2, idr ? 5 : 1, slice(idr, i, bytes));
+
+    ++mFrame;
+    mFrameNum = (mFrameNum + 1) % (1 << Log2MaxFrameNum);
+    return out;
+}
+
+class TSWriter
+{
+public:
+    enum {
+        PmtPid = 0x1000,
+        VideoPid = 0x100,
+        AudioPid = 0x101
+    };
+
+    TSWriter() { std::fill(mContinuity, mContinuity + 0x2000, 0); }
+
+    void tables();
+    void pes(uint16_t pid, uint8_t streamId, uint64_t pts, const std::vector<uint8_t>& payload, bool pcr);
+
+    const std::vector<uint8_t>& data() const { return mData; }
+
+private:
+    void section(uint16_t pid, const std::vector<uint8_t>& section);
+    void packet(uint16_t pid, bool start, const uint8_t* payload, size_t size, const uint64_t* pcr);
+
+    std::vector<uint8_t> mData;
+    uint8_t mContinuity[0x2000];
+};
+
+static uint32_t crc32(const uint8_t* data, size_t size)
+{
+    uint32_t crc = 0xffffffff;
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= uint32_t(data[i]) << 24;
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04c11db7 : crc << 1;
+    }
+    return crc;
+}
+
+void TSWriter::packet(uint16_t pid, bool start, const uint8_t* payload, size_t size, const uint64_t* pcr)
+{
+    uint8_t ts[188];
+    ts[0] = 0x47;
+    ts[1] = (start ? 0x40 : 0) | (pid >> 8);
+    ts[2] = pid & 0xff;
+    size_t header = 4;
+    const size_t room = 184 - (pcr ? 8 : 0);
+    const bool adaptation = pcr || size < 184;
+    ts[3] = (adaptation ? 0x30 : 0x10) | (mContinuity[pid]++ & 0xf);
+    if (adaptation) {
+        // pad short packets with adaptation field stuffing
+        const size_t fieldLength = 183 - std::min(size, room);
+        ts[4] = fieldLength;
+        if (fieldLength > 0) {
+            ts[5] = pcr ? 0x10 : 0;
+            size_t at = 6;
+            if (pcr) {
+                const uint64_t base = *pcr;
+                ts[6] = base >> 25;
+                ts[7] = base >> 17;
+                ts[8] = base >> 9;
+                ts[9] = base >> 1;
+                ts[10] = ((base & 1) << 7) | 0x7e;
+                ts[11] = 0;
+                at = 12;
+            }
+            memset(ts + at, 0xff, 5 + fieldLength - at);
+        }
+        header = 5 + fieldLength;
+    }
+    memcpy(ts + header, payload, 188 - header);
+    mData.insert(mData.end(), ts, ts + 188);
+}
+
+void TSWriter::section(uint16_t pid, const std::vector<uint8_t>& section)
+{
+    std::vector<uint8_t> payload;
+    payload.push_back(0); // pointer_field
+    payload.insert(payload.end(), section.begin(), section.end());
+    const uint32_t crc = crc32(section.data(), section.size());
+    payload.push_back(crc >> 24);
+    payload.push_back(crc >> 16);
+    payload.push_back(crc >> 8);
+    payload.push_back(crc);
+    payload.resize(184, 0xff);
+    packet(pid, true, payload.data(), payload.size(), 0);
+}
+
+void TSWriter::tables()
+{
+    // sections are written without the crc, section_length includes it
+    const std::vector<uint8_t> pat = {
+        0x00, 0xb0, 13, 0x00, 0x01, 0xc1, 0x00, 0x00,
+        0x00, 0x01, 0xe0 | (PmtPid >> 8), PmtPid & 0xff
+    };
+    section(0, pat);
+    const std::vector<uint8_t> pmt = {
+        0x02, 0xb0, 23, 0x00, 0x01, 0xc1, 0x00, 0x00,
+        0xe0 | (VideoPid >> 8), VideoPid & 0xff, 0xf0, 0x00,
+        0x1b, 0xe0 | (VideoPid >> 8), VideoPid & 0xff, 0xf0, 0x00,
+        0x0f, 0xe0 | (AudioPid >> 8), AudioPid & 0xff, 0xf0, 0x00
+    };
+    section(PmtPid, pmt);
+}
+
+void TSWriter::pes(uint16_t pid, uint8_t streamId, uint64_t pts, const std::vector<uint8_t>& payload, bool pcr)
+{
+    std::vector<uint8_t> pes = { 0x00, 0x00, 0x01, streamId, 0, 0, 0x80, 0x80, 5 };
+    const size_t length = payload.size() + 8;
+    if (streamId != 0xe0 || length <= 0xffff) {
+        pes[4] = length >> 8;
+        pes[5] = length & 0xff;
+    }
+    pes.push_back(0x21 | ((pts >> 29) & 0x0e));
+    pes.push_back(pts >> 22);
+    pes.push_back(0x01 | ((pts >> 14) & 0xfe));
+    pes.push_back(pts >> 7);
+    pes.push_back(0x01 | ((pts << 1) & 0xfe));
+    pes.insert(pes.end(), payload.begin(), payload.end());
+
+    const uint64_t clock = pts - 9000;
+    size_t offset = 0;
+    bool first = true;
+    while (offset < pes.size()) {
+        const bool withPcr = first && pcr;
+        const size_t room = withPcr ? 176 : 184;
+        const size_t size = std::min(room, pes.size() - offset);
+        packet(pid, first, pes.data() + offset, size, withPcr ? &clock : 0);
+        offset += size;
+        first = false;
+    }
+}
+
+static bool writeFile(const std::string& path, const std::vector<uint8_t>& data)
+{
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) {
+        fprintf(stderr, "unable to open %s\n", path.c_str());
+        return false;
+    }
+    const bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+    fclose(f);
+    printf("%s: %zu bytes\n", path.c_str(), data.size());
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::string dir = argc > 1 ? argv[1] : ".";
+
+    enum {
+        VideoFrames = 30,
+        Gop = 30,
+        IdrBytes = 40000,
+        PBytes = 7000,
+        AudioFrames = 96
+    };
+
+    const AACTables tables;
+
+    H264Writer h264(1);
+    std::vector<std::vector<uint8_t> > pictures;
+    std::vector<uint8_t> video;
+    for (int i = 0; i < VideoFrames; ++i) {
+        pictures.push_back(h264.picture(Gop, IdrBytes, PBytes));
+        video.insert(video.end(), pictures.back().begin(), pictures.back().end());
+    }
+
+    const AACWriter::Config lc = { 3, SwbOffset48, SwbOffsetShort48, 44, 9., false };
+    AACWriter lcWriter(tables, lc, 2);
+    std::vector<std::vector<uint8_t> > lcFrames;
+    std::vector<uint8_t> lcStream;
+    for (int i = 0; i < AudioFrames; ++i) {
+        lcFrames.push_back(lcWriter.frame());
+        lcStream.insert(lcStream.end(), lcFrames.back().begin(), lcFrames.back().end());
+    }
+
+    const AACWriter::Config he = { 6, SwbOffset24, SwbOffsetShort24, 36, 4., true };
+    AACWriter heWriter(tables, he, 3);
+    std::vector<uint8_t> heStream;
+    for (int i = 0; i < AudioFrames; ++i) {
+        const std::vector<uint8_t> frame = heWriter.frame();
+        heStream.insert(heStream.end(), frame.begin(), frame.end());
+    }
+
+    // interleave by presentation time, tables every six pictures
+    TSWriter ts;
+    const uint64_t start = 90000;
+    size_t audio = 0;
+    for (int i = 0; i < VideoFrames; ++i) {
+        const uint64_t pts = start + i * 1500;
+        while (audio < lcFrames.size() && start + audio * 1920 <= pts) {
+            ts.pes(TSWriter::AudioPid, 0xc0, start + audio * 1920, lcFrames[audio], false);
+            ++audio;
+        }
+        if (!(i % 6))
+            ts.tables();
+        ts.pes(TSWriter::VideoPid, 0xe0, pts, pictures[i], true);
+    }
+
+    if (!writeFile(dir + "/h264.264", video)
+        || !writeFile(dir + "/aac_lc.adts", lcStream)
+        || !writeFile(dir + "/aac_he.adts", heStream)
+        || !writeFile(dir + "/stream.ts", ts.data())) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include "AVCC.h"
+#include <string.h>
+
+static inline void writeSize(uint8_t* dst, size_t size)
+{
+    dst[0] = static_cast<uint8_t>(size >> 24);
+    dst[1] = static_cast<uint8_t>(size >> 16);
+    dst[2] = static_cast<uint8_t>(size >> 8);
+    dst[3] = static_cast<uint8_t>(size);
+}
+
+AVCC::AVCC(uint32_t skipTypes)
+    : mSkipTypes(skipTypes)
+{
+}
+
+size_t AVCC::size(const media::H264NALUEntry* nalus, size_t count) const
+{
+    size_t size = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (keep(nalus[i]))
+            size += 4 + nalus[i].size;
+    }
+    return size;
+}
+
+bool AVCC::convertInPlace(uint8_t* data, const media::H264NALUEntry* nalus, size_t count,
+                          Span* spans, size_t* numSpans) const
+{
+    // check everything first, a half converted buffer is no use to anyone
+    for (size_t i = 0; i < count; ++i) {
+        if (keep(nalus[i]) && nalus[i].start_code_size != 4)
+            return false;
+    }
+
+    size_t num = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const media::H264NALUEntry& nalu = nalus[i];
+        if (!keep(nalu))
+            continue;
+        const size_t start = nalu.offset - 4;
+        writeSize(data + start, nalu.size);
+        if (num && spans[num - 1].offset + spans[num - 1].size == start) {
+            spans[num - 1].size += 4 + nalu.size;
+        } else {
+            spans[num].offset = start;
+            spans[num].size = 4 + nalu.size;
+            ++num;
+        }
+    }
+    *numSpans = num;
+    return true;
+}
+
+void AVCC::convert(const uint8_t* data, const media::H264NALUEntry* nalus, size_t count, uint8_t* dst) const
+{
+    for (size_t i = 0; i < count; ++i) {
+        const media::H264NALUEntry& nalu = nalus[i];
+        if (!keep(nalu))
+            continue;
+        writeSize(dst, nalu.size);
+        memcpy(dst + 4, data + nalu.offset, nalu.size);
+        dst += 4 + nalu.size;
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef AVCC_H
+#define AVCC_H
+
+#include "h264_parser.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// Turns an indexed Annex B access unit into AVCC, every NALU prefixed by
+// its size as a 4 byte big endian number instead of a start code. NALU
+// types can be left out, the decoders on the Mac take the parameter sets
+// out of band and don't want them in the frame.
+class AVCC
+{
+public:
+    // types to leave out, as a mask of 1 << nal_unit_type
+    AVCC(uint32_t skipTypes = 0);
+
+    // a run of the converted frame in the buffer it was converted in
+    struct Span
+    {
+        size_t offset, size;
+    };
+
+    // bytes the kept NALUs take up as AVCC
+    size_t size(const media::H264NALUEntry* nalus, size_t count) const;
+
+    // Rewrites the 4 byte start codes of the kept NALUs in data as their
+    // sizes. The frame is then the spans of data in order, neighbouring
+    // NALUs end up in the same span so there's only more than one if
+    // something was left out in between. spans needs room for count
+    // entries. Returns false without touching data if a kept NALU has a
+    // 3 byte start code, there's no room for the size in front of it then.
+    bool convertInPlace(uint8_t* data, const media::H264NALUEntry* nalus, size_t count,
+                        Span* spans, size_t* numSpans) const;
+
+    // Copies the kept NALUs to dst with their sizes in front, dst needs
+    // room for size() bytes
+    void convert(const uint8_t* data, const media::H264NALUEntry* nalus, size_t count, uint8_t* dst) const;
+
+private:
+    bool keep(const media::H264NALUEntry& nalu) const { return !(mSkipTypes & (1u << nalu.nal_unit_type)); }
+
+    uint32_t mSkipTypes;
+};
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef BUFFERRING_H
+#define BUFFERRING_H
+
+#include <rct/Buffer.h>
+#include <vector>
+#include <assert.h>
+#include <stddef.h>
+
+// Fixed capacity FIFO of received buffers. Pushing and popping are O(1) and
+// the slot array is allocated once up front so that steady state operation
+// doesn't touch the allocator. Not thread safe.
+class BufferRing
+{
+public:
+    BufferRing(size_t capacity);
+
+    bool isEmpty() const { return !mCount; }
+    bool isFull() const { return mCount == mSlots.size(); }
+
+    // number of buffers and total number of bytes held
+    size_t size() const { return mCount; }
+    size_t bytes() const { return mBytes; }
+    size_t capacity() const { return mSlots.size(); }
+
+    void push(Buffer&& buffer);
+    void pop();
+
+    Buffer& front() { return at(0); }
+    const Buffer& front() const { return at(0); }
+
+    // idx is relative to the front of the ring
+    Buffer& at(size_t idx);
+    const Buffer& at(size_t idx) const;
+    const Buffer& operator[](size_t idx) const { return at(idx); }
+
+private:
+    std::vector<Buffer> mSlots;
+    size_t mMask, mHead, mCount, mBytes;
+
+    BufferRing(const BufferRing&) = delete;
+    BufferRing& operator=(const BufferRing&) = delete;
+};
+
+inline BufferRing::BufferRing(size_t capacity)
+    : mMask(0), mHead(0), mCount(0), mBytes(0)
+{
+    // round up to a power of two so that wrapping is a mask
+    size_t cap = 1;
+    while (cap < capacity)
+        cap <<= 1;
+    mSlots.resize(cap);
+    mMask = cap - 1;
+}
+
+inline void BufferRing::push(Buffer&& buffer)
+{
+    assert(!isFull());
+    mBytes += buffer.size();
+    mSlots[(mHead + mCount) & mMask] = std::move(buffer);
+    ++mCount;
+}
+
+inline void BufferRing::pop()
+{
+    assert(!isEmpty());
+    Buffer& slot = mSlots[mHead];
+    mBytes -= slot.size();
+    slot.clear();
+    mHead = (mHead + 1) & mMask;
+    --mCount;
+}
+
+inline Buffer& BufferRing::at(size_t idx)
+{
+    assert(idx < mCount);
+    return mSlots[(mHead + idx) & mMask];
+}
+
+inline const Buffer& BufferRing::at(size_t idx) const
+{
+    assert(idx < mCount);
+    return mSlots[(mHead + idx) & mMask];
+}
+
+#endif
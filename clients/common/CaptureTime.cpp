@@ -0,0 +1,25 @@
+#include "CaptureTime.h"
+#include <chrono>
+#include <string.h>
+
+const uint8_t CaptureTime::Uuid[16] = {
+    0x68, 0x64, 0x36, 0x30, 0x72, 0x65, 0x6e, 0x64, // hd60rend
+    0x9a, 0x3c, 0x4e, 0x1b, 0xb2, 0x57, 0x0d, 0xc1
+};
+
+bool CaptureTime::read(const media::H264SEIUserDataUnregistered& userData, uint64_t* usecs)
+{
+    if (userData.payload_size < 8 || memcmp(userData.uuid_iso_iec_11578, Uuid, sizeof(Uuid)))
+        return false;
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i)
+        value = (value << 8) | userData.payload[i];
+    *usecs = value;
+    return true;
+}
+
+uint64_t CaptureTime::now()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,23 @@
+#ifndef CAPTURETIME_H
+#define CAPTURETIME_H
+
+#include <stdint.h>
+#include "h264_parser.h"
+
+// The server can tag a picture with the wall clock time it was captured at
+// in a user_data_unregistered SEI message: Uuid followed by the time as 8
+// bytes of big endian microseconds since the epoch. With the clocks of both
+// machines in sync that gives the real latency of every frame.
+class CaptureTime
+{
+public:
+    static const uint8_t Uuid[16];
+
+    // false if the message isn't a capture time
+    static bool read(const media::H264SEIUserDataUnregistered& userData, uint64_t* usecs);
+
+    // microseconds since the epoch, to compare against
+    static uint64_t now();
+};
+
+#endif
@@ -0,0 +1,343 @@
+#include "DemuxerImpl.h"
+#include "Log.h"
+#include <algorithm>
+#include <assert.h>
+
+DemuxerImpl::DemuxerImpl(Demuxer* d)
+    : demuxer(d), window(nullptr), windowStart(0), windowEnd(0)
+{
+    current.resize(AV_BUFFER_SIZE + 1);
+}
+
+void DemuxerImpl::invalidate()
+{
+    window = nullptr;
+    windowStart = windowEnd = 0;
+}
+
+const unsigned char* DemuxerImpl::contiguous(uint64_t pos, size_t* size)
+{
+    assert(pos >= demuxer->mOffset);
+    if (pos >= windowStart && pos < windowEnd) {
+        *size = windowEnd - pos;
+        return window + (pos - windowStart);
+    }
+    const auto& buffers = demuxer->mBuffers;
+    uint64_t bufoff = pos - demuxer->mOffset;
+    for (size_t bufpos = 0; bufpos < buffers.size(); ++bufpos) {
+        const auto& mbuf = buffers[bufpos];
+        if (bufoff < mbuf.size()) {
+            *size = mbuf.size() - bufoff;
+            window = mbuf.data() + bufoff;
+            windowStart = pos;
+            windowEnd = pos + *size;
+            return window;
+        }
+        bufoff -= mbuf.size();
+    }
+    *size = 0;
+    return nullptr;
+}
+
+static inline int stream_identifier(int composition_id, int ancillary_id)
+{
+    return ((composition_id & 0xff00) >> 8)
+        | ((composition_id & 0xff) << 8)
+        | ((ancillary_id & 0xff00) << 16)
+        | ((ancillary_id & 0xff) << 24);
+}
+
+static void show_stream_info(TSDemux::ElementaryStream* es, uint16_t channel)
+{
+    if (!es)
+        return;
+
+    Log::stdout("dump stream infos for channel % PID %\n", channel, es->pid);
+    Log::stdout("  Codec name     : %\n", es->GetStreamCodecName());
+    Log::stdout("  Language       : %\n", es->stream_info.language);
+    Log::stdout("  Identifier     : %\n", stream_identifier(es->stream_info.composition_id, es->stream_info.ancillary_id));
+    Log::stdout("  FPS scale      : %\n", es->stream_info.fps_scale);
+    Log::stdout("  FPS rate       : %\n", es->stream_info.fps_rate);
+    Log::stdout("  Interlaced     : %\n", (es->stream_info.interlaced ? "true" : "false"));
+    Log::stdout("  Height         : %\n", es->stream_info.height);
+    Log::stdout("  Width          : %\n", es->stream_info.width);
+    Log::stdout("  Aspect         : %\n", es->stream_info.aspect);
+    Log::stdout("  Channels       : %\n", es->stream_info.channels);
+    Log::stdout("  Sample rate    : %\n", es->stream_info.sample_rate);
+    Log::stdout("  Block align    : %\n", es->stream_info.block_align);
+    Log::stdout("  Bit rate       : %\n", es->stream_info.bit_rate);
+    Log::stdout("  Bit per sample : %\n", es->stream_info.bits_per_sample);
+    Log::stdout("\n");
+}
+
+const unsigned char* DemuxerImpl::ReadAV(uint64_t pos, size_t n)
+{
+    // printf("wanting %zu bytes at %llu\n", n, pos);
+    assert(n <= AV_BUFFER_SIZE + 1);
+    assert(pos >= demuxer->mOffset);
+    auto& buffers = demuxer->mBuffers;
+
+    if (pos >= windowStart && pos + n <= windowEnd) {
+        ++demuxer->mStats.reads;
+        const unsigned char* data = window + (pos - windowStart);
+        if (demuxer->mOptions.zeroCopy) {
+            return data;
+        }
+        memcpy(current.data(), data, n);
+        return current.data();
+    }
+
+    // skip to the buffer containing pos
+    size_t bufpos = 0;
+    uint64_t bufoff = pos - demuxer->mOffset;
+    for (;;) {
+        if (bufpos >= buffers.size()) {
+            // we don't have enough data
+            return nullptr;
+        }
+        const auto& mbuf = buffers[bufpos];
+        if (bufoff < mbuf.size())
+            break;
+        bufoff -= mbuf.size();
+        ++bufpos;
+    }
+    // nothing before pos will be asked for again. we only drop buffers here
+    // and not after the read since the pointer we returned last time may
+    // still point into the first one
+    if (bufpos > 0) {
+        invalidate();
+        demuxer->mOffset = pos - bufoff;
+        while (bufpos-- > 0)
+            buffers.pop();
+    }
+
+    const auto& first = buffers.front();
+    if (bufoff + n <= first.size()) {
+        ++demuxer->mStats.reads;
+        if (demuxer->mOptions.zeroCopy) {
+            return first.data() + bufoff;
+        }
+        memcpy(current.data(), first.data() + bufoff, n);
+        return current.data();
+    }
+
+    // the read straddles two or more buffers, make sure we have all of it
+    // before stitching it together
+    size_t avail = first.size() - bufoff;
+    for (bufpos = 1; avail < n; ++bufpos) {
+        if (bufpos >= buffers.size()) {
+            // we don't have enough data
+            return nullptr;
+        }
+        avail += buffers[bufpos].size();
+    }
+
+    size_t where = first.size() - bufoff;
+    memcpy(current.data(), first.data() + bufoff, where);
+    for (bufpos = 1; where < n; ++bufpos) {
+        const auto& mbuf = buffers[bufpos];
+        const size_t num = std::min(mbuf.size(), n - where);
+        memcpy(current.data() + where, mbuf.data(), num);
+        where += num;
+    }
+    assert(where == n);
+
+    ++demuxer->mStats.reads;
+    ++demuxer->mStats.stitchedReads;
+    return current.data();
+}
+
+Demuxer::Demuxer()
+    : Demuxer(Options())
+{
+}
+
+Demuxer::Demuxer(const Options& options)
+    : mOptions(options), mPidFilter(false), mPacketPool(PacketPool::create()),
+      mBuffers(options.maxBuffers), mOffset(0)
+{
+    mDemuxer = std::make_shared<DemuxerImpl>(this);
+    mAVContext = std::make_shared<TSDemux::AVContext>(mDemuxer.get(), 0, 0);
+}
+
+void Demuxer::addPid(uint16_t pid)
+{
+    assert(pid <= MaxPid);
+    mPidFilter = true;
+    mWantedPids.set(pid);
+    if (mStreamPids.test(pid))
+        mAVContext->StartStreaming(pid);
+}
+
+void Demuxer::removePid(uint16_t pid)
+{
+    assert(pid <= MaxPid);
+    if (!mPidFilter) {
+        // everything was wanted so far, keep it that way for the others
+        mWantedPids = mStreamPids;
+        mPidFilter = true;
+    }
+    mWantedPids.reset(pid);
+    if (mStreamPids.test(pid))
+        mAVContext->StopStreaming(pid);
+}
+
+void Demuxer::clearPids()
+{
+    mPidFilter = false;
+    mWantedPids.reset();
+    for (uint16_t pid = 0; pid <= MaxPid; ++pid) {
+        if (mStreamPids.test(pid))
+            mAVContext->StartStreaming(pid);
+    }
+}
+
+bool Demuxer::isPidWanted(uint16_t pid) const
+{
+    return !mPidFilter || mWantedPids.test(pid);
+}
+
+inline bool Demuxer::isFiltered(const unsigned char* header) const
+{
+    const uint16_t pid = ((header[1] & 0x1f) << 8) | header[2];
+    if (pid == NullPid)
+        return true;
+    // pids we don't know as elementary streams might be PSI, let those through
+    return mPidFilter && mStreamPids.test(pid) && !mWantedPids.test(pid);
+}
+
+void Demuxer::feed(Buffer&& buffer)
+{
+    // a packet spread over more buffers than the ring holds or data that
+    // never syncs. drop the oldest, what was already demuxed doesn't count
+    if (mBuffers.isFull()) {
+        const uint64_t pos = mAVContext->GetPosition();
+        const uint64_t end = mOffset + mBuffers.front().size();
+        const size_t dropped = end > pos ? end - std::max(pos, mOffset) : 0;
+        mBuffers.pop();
+        mDemuxer->invalidate();
+        mOffset = end;
+        if (dropped > 0) {
+            ++mStats.droppedBuffers;
+            mStats.droppedBytes += dropped;
+            Log::stderr("demuxer buffer ring full, dropped % bytes (% total)\n", dropped, mStats.droppedBytes);
+        }
+        if (pos < mOffset) {
+            // whatever we were in the middle of is gone, resync at the
+            // oldest data we still have
+            mAVContext->GoPosition(mOffset);
+            mAVContext->ResetPackets();
+        }
+    }
+
+    mBuffers.push(std::move(buffer));
+
+    for (;;) {
+        if (mAVContext->TSResync() != TSDemux::AVCONTEXT_CONTINUE) {
+            //printf("no sync\n");
+            return;
+        }
+
+        // TSResync copies every packet it finds into the AVContext. Finding
+        // it is cheap though: the buffer it's
+        // in becomes the read window, so TSResync reading the next packets
+        // and us looking at their headers are a bounds check instead of a
+        // walk over mBuffers
+        const uint64_t pos = mAVContext->GetPosition();
+        size_t size;
+        const unsigned char* header = mDemuxer->contiguous(pos, &size);
+        if (size < 4)
+            header = mDemuxer->ReadAV(pos, 4);
+
+        ++mStats.packets;
+        if (isFiltered(header)) {
+            // the packets after it in the same buffer are often dropped too
+            // (the other stream, null padding). step over those straight out
+            // of the window rather than have TSResync find and copy each one,
+            // 192/204 byte packets are left to it
+            const bool plain = mAVContext->GetNextPosition() - pos == TSPacketSize;
+            for (;;) {
+                ++mStats.filteredPackets;
+                mAVContext->GoNext();
+                if (!plain || size < 2 * TSPacketSize)
+                    break;
+                header += TSPacketSize;
+                size -= TSPacketSize;
+                if (header[0] != TSSyncByte || !isFiltered(header))
+                    break;
+                ++mStats.packets;
+            }
+        } else if (processPacket() == TSDemux::AVCONTEXT_TS_ERROR) {
+            mAVContext->Shift();
+        } else {
+            mAVContext->GoNext();
+        }
+    }
+}
+
+void Demuxer::dropped(size_t buffers, size_t bytes)
+{
+    // feed() consumes all it can, what's left is the start of a packet
+    // whose rest was just dropped
+    const uint64_t pos = mAVContext->GetPosition();
+    const uint64_t end = mOffset + mBuffers.bytes();
+    const size_t unfinished = end > pos ? end - std::max(pos, mOffset) : 0;
+    while (!mBuffers.isEmpty())
+        mBuffers.pop();
+    mDemuxer->invalidate();
+    mOffset = end;
+    mAVContext->GoPosition(mOffset);
+    mAVContext->ResetPackets();
+
+    mStats.droppedBuffers += buffers;
+    mStats.droppedBytes += bytes + unfinished;
+    Log::stderr("demuxer falling behind, dropped % bytes in % buffers (% total)\n",
+                bytes + unfinished, buffers, mStats.droppedBytes);
+}
+
+int Demuxer::processPacket()
+{
+    int ret = mAVContext->ProcessTSPacket();
+    if (mAVContext->HasPIDStreamData()) {
+        TSDemux::STREAM_PKT pkt;
+        for (;;) {
+            TSDemux::ElementaryStream* es = mAVContext->GetPIDStream();
+            if (!es)
+                break;
+            if (!es->GetStreamPacket(&pkt))
+                break;
+            if (pkt.streamChange) {
+                mSignalInfo(pkt.pid, es->stream_type, es->stream_info);
+                //show_stream_info(es, mAVContext->GetChannel(pkt.pid));
+            }
+            if (pkt.size > 0 && pkt.data) {
+                //printf("data for pid %.4x %zu\n", pkt.pid, pkt.size);
+                mSignalPkt(mPacketPool->acquire(pkt));
+            }
+        }
+        // stream datas
+        //printf("has stream data\n");
+    }
+    if (mAVContext->HasPIDPayload()) {
+        // woop
+        //printf("has payload\n");
+        ret = mAVContext->ProcessTSPayload();
+        if (ret == TSDemux::AVCONTEXT_PROGRAM_CHANGE) {
+            // hey
+            Log::stdout("program change\n");
+            const std::vector<TSDemux::ElementaryStream*> streams = mAVContext->GetStreams();
+            mStreamPids.reset();
+            for (std::vector<TSDemux::ElementaryStream*>::const_iterator it = streams.begin(); it != streams.end(); ++it) {
+                mStreamPids.set((*it)->pid);
+                if (!isPidWanted((*it)->pid))
+                    continue;
+                mAVContext->StartStreaming((*it)->pid);
+                if ((*it)->has_stream_info) {
+                    //show_stream_info(*it, mAVContext->GetChannel((*it)->pid));
+                    mSignalInfo((*it)->pid, (*it)->stream_type, (*it)->stream_info);
+                }
+            }
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,108 @@
+#ifndef DEMUXER_H
+#define DEMUXER_H
+
+#include <tsDemuxer.h>
+#include <elementaryStream.h>
+#include <rct/Buffer.h>
+#include <rct/SignalSlot.h>
+#include <bitset>
+#include <vector>
+#include <memory>
+#include "BufferRing.h"
+#include "Packet.h"
+
+class DemuxerImpl;
+
+class Demuxer
+{
+public:
+    struct Options
+    {
+        // return pointers straight into the received buffers whenever a
+        // read doesn't straddle two of them, copy otherwise
+        bool zeroCopy;
+        // maximum number of received buffers held for packets that span
+        // them, the oldest is dropped when a new one doesn't fit
+        size_t maxBuffers;
+        // maximum number of bytes waiting to be demuxed, 0 for no limit.
+        // the demux stage in front of feed() applies it since that's where
+        // the backlog builds, and tells us what it dropped with dropped()
+        size_t highWaterMark;
+
+        Options() : zeroCopy(true), maxBuffers(64), highWaterMark(8 * 1024 * 1024) { }
+    };
+
+    struct Stats
+    {
+        Stats() : packets(0), reads(0), stitchedReads(0), droppedBuffers(0), droppedBytes(0), filteredPackets(0) { }
+
+        // TS packets seen, filtered ones included
+        uint64_t packets;
+        uint64_t reads;
+        // reads that had to be copied into the stitch buffer
+        uint64_t stitchedReads;
+        // data that never got demuxed, dropped by the demux stage or
+        // because the buffer ring was full. bytes that had already been
+        // demuxed when their buffer went don't count
+        uint64_t droppedBuffers;
+        uint64_t droppedBytes;
+        // null packets and packets discarded by the pid filter
+        uint64_t filteredPackets;
+    };
+
+    enum { MaxPid = 0x1fff, NullPid = 0x1fff, TSPacketSize = 188, TSSyncByte = 0x47 };
+
+    Demuxer();
+    Demuxer(const Options& options);
+
+    void feed(Buffer&& buffer);
+    // buffers were thrown away between the last feed() and the next one.
+    // whatever is unfinished can't be completed anymore, so that goes too
+    // and demuxing picks up at the next buffer
+    void dropped(size_t buffers, size_t bytes);
+
+    const Stats& stats() const { return mStats; }
+
+    // Restrict demuxing to the given elementary stream pids. Packets for
+    // other streams are dropped based on the TS header alone, PAT/PMT are
+    // always processed. Without any pids added everything is demuxed.
+    // Removing a pid from that turns the filter on with every stream
+    // known so far but the removed one.
+    void addPid(uint16_t pid);
+    void removePid(uint16_t pid);
+    void clearPids();
+    bool isPidWanted(uint16_t pid) const;
+
+    Signal<std::function<void(uint16_t pid, TSDemux::STREAM_TYPE, const TSDemux::STREAM_INFO&)> >& info() { return mSignalInfo; }
+    Signal<std::function<void(const Packet&)> >& pkt() { return mSignalPkt; }
+
+    PacketPool::Stats packetStats() const { return mPacketPool->stats(); }
+
+private:
+    int processPacket();
+    bool isFiltered(const unsigned char* header) const;
+
+private:
+    Options mOptions;
+    Stats mStats;
+
+    std::shared_ptr<DemuxerImpl> mDemuxer;
+    std::shared_ptr<TSDemux::AVContext> mAVContext;
+
+    bool mPidFilter;
+    std::bitset<MaxPid + 1> mWantedPids, mStreamPids;
+
+    std::shared_ptr<PacketPool> mPacketPool;
+
+    BufferRing mBuffers;
+    // stream offset of the first byte in mBuffers
+    uint64_t mOffset;
+
+    Signal<std::function<void(uint16_t pid, TSDemux::STREAM_TYPE, const TSDemux::STREAM_INFO&)> > mSignalInfo;
+    Signal<std::function<void(const Packet&)> > mSignalPkt;
+
+    friend class DemuxerImpl;
+    friend class DemuxerBenchmark;
+};
+
+#endif
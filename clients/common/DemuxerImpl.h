@@ -0,0 +1,33 @@
+#ifndef DEMUXERIMPL_H
+#define DEMUXERIMPL_H
+
+#include "Demuxer.h"
+
+// The TSDemuxer that feeds demux-mpegts out of the Demuxer's buffers. Only
+// Demuxer.cpp and the benchmarks need to see this.
+
+#define AV_BUFFER_SIZE 131072
+
+class DemuxerImpl : public TSDemux::TSDemuxer
+{
+public:
+    DemuxerImpl(Demuxer* d);
+
+    const unsigned char* ReadAV(uint64_t pos, size_t n);
+
+    // returns the bytes that can be read starting at pos without stitching
+    // and remembers them, reads that fall inside them are O(1) until the
+    // buffer they live in is dropped. so is asking again for a pos inside
+    // the window
+    const unsigned char* contiguous(uint64_t pos, size_t* size);
+    void invalidate();
+
+private:
+    Buffer current;
+    Demuxer* demuxer;
+
+    const unsigned char* window;
+    uint64_t windowStart, windowEnd;
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "DropPolicy.h"
+#include "h264_bit_reader.h"
+
+DropPolicy::DropPolicy(const Options& options)
+    : mOptions(options), mDepth(0), mSkipping(false)
+{
+}
+
+DropPolicy::Picture DropPolicy::classify(const uint8_t* data, const media::H264NALUEntry* nalus, size_t count)
+{
+    Picture picture;
+    for (size_t i = 0; i < count; ++i) {
+        const media::H264NALUEntry& nalu = nalus[i];
+        if (nalu.nal_unit_type != media::H264NALU::kIDRSlice && nalu.nal_unit_type != media::H264NALU::kNonIDRSlice)
+            continue;
+        if (nalu.nal_unit_type == media::H264NALU::kIDRSlice)
+            picture.idr = true;
+        if (nalu.nal_ref_idc)
+            picture.reference = true;
+        if (!picture.slices++) {
+            // first_mb_in_slice, then slice_type, past the NALU header
+            media::H264BitReader reader;
+            int firstMb, sliceType;
+            if (nalu.size > 1 && reader.Initialize(data + nalu.offset + 1, nalu.size - 1)
+                && reader.ReadUE(&firstMb) && reader.ReadUE(&sliceType) && sliceType <= 9) {
+                picture.sliceType = sliceType % 5;
+            }
+        }
+    }
+    return picture;
+}
+
+DropPolicy::Decision DropPolicy::decide(const Picture& picture)
+{
+    const size_t depth = mDepth.load(std::memory_order_relaxed);
+    if (mSkipping && !picture.idr) {
+        ++mStats.skipped;
+        return Skip;
+    }
+    mSkipping = false;
+    if (depth >= mOptions.skipToIDR && !picture.idr) {
+        mSkipping = true;
+        ++mStats.skips;
+        ++mStats.skipped;
+        return Skip;
+    }
+    if (depth >= mOptions.dropNonReference && !picture.reference) {
+        ++mStats.droppedNonReference;
+        if (picture.sliceType == media::H264SliceHeader::kBSlice)
+            ++mStats.droppedB;
+        return DropNonReference;
+    }
+    ++mStats.decoded;
+    return Decode;
+}
@@ -0,0 +1,81 @@
+#ifndef DROPPOLICY_H
+#define DROPPOLICY_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include "h264_parser.h"
+
+// Decides which pictures to leave out when the decoder falls behind. The
+// decoder's queue depth is counted here, one submitted() per frame handed
+// to it and one completed() per frame it's done with, so none of this
+// depends on the platform decoder. Past dropNonReference frames in flight
+// the pictures nothing refers to are dropped, past skipToIDR everything is
+// until the next IDR picture since whatever follows a dropped reference
+// picture won't decode right.
+class DropPolicy
+{
+public:
+    struct Options
+    {
+        size_t dropNonReference, skipToIDR;
+
+        Options() : dropNonReference(4), skipToIDR(12) { }
+    };
+
+    // what we need to know about the picture in an access unit
+    struct Picture
+    {
+        Picture() : slices(0), idr(false), reference(false), sliceType(-1) { }
+
+        int slices;
+        bool idr;
+        // nal_ref_idc of any slice is non-zero
+        bool reference;
+        // of the first slice, -1 if it couldn't be read
+        int sliceType;
+    };
+
+    enum Decision {
+        Decode,
+        DropNonReference,
+        // dropped while waiting for an IDR picture
+        Skip
+    };
+
+    struct Stats
+    {
+        Stats() : decoded(0), droppedNonReference(0), droppedB(0), skipped(0), skips(0) { }
+
+        uint64_t decoded, droppedNonReference;
+        // the B pictures among droppedNonReference
+        uint64_t droppedB;
+        // pictures dropped waiting for an IDR, and how often that happened
+        uint64_t skipped, skips;
+    };
+
+    DropPolicy(const Options& options = Options());
+
+    // Reads slice_type straight from the start of the first slice header,
+    // that part doesn't need the parameter sets
+    static Picture classify(const uint8_t* data, const media::H264NALUEntry* nalus, size_t count);
+
+    // call from the thread submitting to the decoder
+    Decision decide(const Picture& picture);
+
+    void submitted() { mDepth.fetch_add(1, std::memory_order_relaxed); }
+    // from any thread, also for frames the decoder failed or refused
+    void completed() { mDepth.fetch_sub(1, std::memory_order_relaxed); }
+    size_t depth() const { return mDepth.load(std::memory_order_relaxed); }
+
+    // only from the deciding thread
+    const Stats& stats() const { return mStats; }
+
+private:
+    Options mOptions;
+    std::atomic<size_t> mDepth;
+    bool mSkipping;
+    Stats mStats;
+};
+
+#endif
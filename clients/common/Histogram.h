@@ -0,0 +1,110 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <atomic>
+#include <stdint.h>
+#include <stddef.h>
+
+// Log-linear histogram for latencies. Each power of two is split into
+// eight buckets so percentiles come out within ~12% of the real value,
+// which is plenty to spot regressions. Recording is a couple of relaxed
+// atomic adds, meant for one writer thread with readers anywhere.
+class Histogram
+{
+public:
+    enum {
+        SubBits = 3,
+        SubBuckets = 1 << SubBits,
+        // values are clamped to 2^40, about 18 minutes in nanoseconds
+        MaxBits = 40,
+        Buckets = (MaxBits - SubBits + 1) * SubBuckets
+    };
+
+    Histogram() { reset(); }
+
+    void record(uint64_t value);
+    void reset();
+
+    uint64_t count() const { return mCount.load(std::memory_order_relaxed); }
+    uint64_t max() const { return mMax.load(std::memory_order_relaxed); }
+    uint64_t mean() const;
+    // upper bound of the bucket holding the given percentile (0-100)
+    uint64_t percentile(double p) const;
+
+private:
+    static size_t indexOf(uint64_t value);
+    static uint64_t upperBound(size_t index);
+
+    std::atomic<uint64_t> mBuckets[Buckets];
+    std::atomic<uint64_t> mCount, mSum, mMax;
+};
+
+inline size_t Histogram::indexOf(uint64_t value)
+{
+    if (value < SubBuckets)
+        return value;
+    if (value >= (uint64_t(1) << MaxBits))
+        return Buckets - 1;
+    const int msb = 63 - __builtin_clzll(value);
+    const int shift = msb - SubBits;
+    return (shift + 1) * SubBuckets + ((value >> shift) & (SubBuckets - 1));
+}
+
+inline uint64_t Histogram::upperBound(size_t index)
+{
+    if (index < SubBuckets)
+        return index;
+    const int shift = index / SubBuckets - 1;
+    const uint64_t sub = index % SubBuckets;
+    return ((SubBuckets + sub + 1) << shift) - 1;
+}
+
+inline void Histogram::record(uint64_t value)
+{
+    mBuckets[indexOf(value)].fetch_add(1, std::memory_order_relaxed);
+    mCount.fetch_add(1, std::memory_order_relaxed);
+    mSum.fetch_add(value, std::memory_order_relaxed);
+    if (value > mMax.load(std::memory_order_relaxed))
+        mMax.store(value, std::memory_order_relaxed);
+}
+
+inline void Histogram::reset()
+{
+    for (size_t i = 0; i < Buckets; ++i)
+        mBuckets[i].store(0, std::memory_order_relaxed);
+    mCount.store(0, std::memory_order_relaxed);
+    mSum.store(0, std::memory_order_relaxed);
+    mMax.store(0, std::memory_order_relaxed);
+}
+
+inline uint64_t Histogram::mean() const
+{
+    const uint64_t count = mCount.load(std::memory_order_relaxed);
+    return count ? mSum.load(std::memory_order_relaxed) / count : 0;
+}
+
+inline uint64_t Histogram::percentile(double p) const
+{
+    // count the buckets rather than trusting mCount, a writer might be
+    // halfway through a record
+    uint64_t total = 0;
+    for (size_t i = 0; i < Buckets; ++i)
+        total += mBuckets[i].load(std::memory_order_relaxed);
+    if (!total)
+        return 0;
+    uint64_t rank = static_cast<uint64_t>(p / 100. * total + .5);
+    if (rank < 1)
+        rank = 1;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < Buckets; ++i) {
+        seen += mBuckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            const uint64_t bound = upperBound(i);
+            const uint64_t max = mMax.load(std::memory_order_relaxed);
+            return bound < max ? bound : max;
+        }
+    }
+    return mMax.load(std::memory_order_relaxed);
+}
+
+#endif
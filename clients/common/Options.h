@@ -299,7 +299,7 @@ Options::Value Options::get(const char* arg, const Value& defaultValue) const
 }
 
 template<typename Type,
-         typename std::enable_if<std::is_arithmetic<Type>::value, Type>::type = 0>
+         typename std::enable_if<std::is_arithmetic<Type>::value, Type>::type>
 Type Options::get(const char* arg, Type defaultValue) const
 {
     Option opt(arg);
@@ -312,7 +312,7 @@ Type Options::get(const char* arg, Type defaultValue) const
 }
 
 template<typename Type,
-         typename std::enable_if<!std::is_arithmetic<Type>::value, Type>::type = 0>
+         typename std::enable_if<!std::is_arithmetic<Type>::value, Type>::type>
 Type Options::get(const char* arg, const Type& defaultValue) const
 {
     Option opt(arg);
@@ -386,7 +386,7 @@ Options::Value Options::Standalones::at(size_t idx, const Value& defaultValue) c
 }
 
 template<typename Type,
-         typename std::enable_if<std::is_arithmetic<Type>::value, Type>::type = 0>
+         typename std::enable_if<std::is_arithmetic<Type>::value, Type>::type>
 Type Options::Standalones::at(size_t idx, Type defaultValue) const
 {
     if (idx >= standalones.size())
@@ -397,7 +397,7 @@ Type Options::Standalones::at(size_t idx, Type defaultValue) const
 }
 
 template<typename Type,
-         typename std::enable_if<!std::is_arithmetic<Type>::value, Type>::type = 0>
+         typename std::enable_if<!std::is_arithmetic<Type>::value, Type>::type>
 Type Options::Standalones::at(size_t idx, const Type& defaultValue) const
 {
     if (idx >= standalones.size())
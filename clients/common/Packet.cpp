@@ -0,0 +1,62 @@
+#include "Packet.h"
+#include <string.h>
+
+PacketPool::PacketPool()
+{
+    mFree.reserve(64);
+}
+
+PacketPool::~PacketPool()
+{
+    for (Packet::Data* data : mFree) {
+        delete data;
+    }
+}
+
+std::shared_ptr<PacketPool> PacketPool::create()
+{
+    return std::shared_ptr<PacketPool>(new PacketPool);
+}
+
+Packet PacketPool::acquire(const TSDemux::STREAM_PKT& pkt)
+{
+    Packet::Data* data = nullptr;
+    {
+        std::unique_lock<std::mutex> locker(mMutex);
+        ++mStats.acquired;
+        if (!mFree.empty()) {
+            data = mFree.back();
+            mFree.pop_back();
+            if (data->bytes.capacity() < pkt.size)
+                ++mStats.allocations;
+        } else {
+            ++mStats.allocations;
+        }
+    }
+    if (!data)
+        data = new Packet::Data;
+
+    data->ref.store(1, std::memory_order_relaxed);
+    data->pool = shared_from_this();
+    data->pid = pkt.pid;
+    data->pts = pkt.pts;
+    data->dts = pkt.dts;
+    data->duration = pkt.duration;
+    data->streamChange = pkt.streamChange;
+    data->bytes.resize(pkt.size);
+    if (pkt.size > 0)
+        memcpy(data->bytes.data(), pkt.data, pkt.size);
+    return Packet(data);
+}
+
+void PacketPool::release(Packet::Data* data)
+{
+    std::unique_lock<std::mutex> locker(mMutex);
+    mFree.push_back(data);
+}
+
+PacketPool::Stats PacketPool::stats() const
+{
+    std::unique_lock<std::mutex> locker(mMutex);
+    return mStats;
+}
@@ -0,0 +1,150 @@
+#ifndef PACKET_H
+#define PACKET_H
+
+#include <elementaryStream.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+
+class PacketPool;
+
+// A demuxed PES packet. Copies share the same payload, which goes back to
+// the pool it came from when the last copy goes away, so packets can be
+// kept around and passed between threads without copying the data.
+class Packet
+{
+public:
+    Packet();
+    Packet(const Packet& other);
+    Packet(Packet&& other);
+    ~Packet();
+
+    Packet& operator=(const Packet& other);
+    Packet& operator=(Packet&& other);
+
+    bool isNull() const { return !mData; }
+    void reset();
+
+    uint16_t pid() const { return mData->pid; }
+    uint64_t pts() const { return mData->pts; }
+    uint64_t dts() const { return mData->dts; }
+    uint64_t duration() const { return mData->duration; }
+    bool streamChange() const { return mData->streamChange; }
+
+    const uint8_t* data() const { return mData->bytes.data(); }
+    size_t size() const { return mData->bytes.size(); }
+
+    // the payload can be rewritten in place by whoever holds the only copy
+    bool unique() const { return mData->ref.load(std::memory_order_acquire) == 1; }
+    uint8_t* mutableData() { return mData->bytes.data(); }
+
+private:
+    struct Data
+    {
+        std::atomic<int> ref;
+        // only set while handed out, free packets don't keep the pool alive
+        std::shared_ptr<PacketPool> pool;
+
+        uint16_t pid;
+        uint64_t pts, dts, duration;
+        bool streamChange;
+        std::vector<uint8_t> bytes;
+    };
+
+    Packet(Data* data) : mData(data) { }
+
+    Data* mData;
+
+    friend class PacketPool;
+};
+
+class PacketPool : public std::enable_shared_from_this<PacketPool>
+{
+public:
+    ~PacketPool();
+
+    static std::shared_ptr<PacketPool> create();
+
+    // copy the payload of pkt into a pooled packet
+    Packet acquire(const TSDemux::STREAM_PKT& pkt);
+
+    struct Stats
+    {
+        Stats() : acquired(0), allocations(0) { }
+
+        uint64_t acquired;
+        // packets created or grown, stays flat once the pool has warmed up
+        uint64_t allocations;
+    };
+    Stats stats() const;
+
+private:
+    PacketPool();
+
+    void release(Packet::Data* data);
+
+    mutable std::mutex mMutex;
+    std::vector<Packet::Data*> mFree;
+    Stats mStats;
+
+    friend class Packet;
+};
+
+inline Packet::Packet()
+    : mData(nullptr)
+{
+}
+
+inline Packet::Packet(const Packet& other)
+    : mData(other.mData)
+{
+    if (mData)
+        mData->ref.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline Packet::Packet(Packet&& other)
+    : mData(other.mData)
+{
+    other.mData = nullptr;
+}
+
+inline Packet::~Packet()
+{
+    reset();
+}
+
+inline Packet& Packet::operator=(const Packet& other)
+{
+    if (other.mData)
+        other.mData->ref.fetch_add(1, std::memory_order_relaxed);
+    reset();
+    mData = other.mData;
+    return *this;
+}
+
+inline Packet& Packet::operator=(Packet&& other)
+{
+    if (this != &other) {
+        reset();
+        mData = other.mData;
+        other.mData = nullptr;
+    }
+    return *this;
+}
+
+inline void Packet::reset()
+{
+    if (mData) {
+        if (mData->ref.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            // hold on to the pool until the packet is back in it
+            std::shared_ptr<PacketPool> pool = std::move(mData->pool);
+            pool->release(mData);
+        }
+        mData = nullptr;
+    }
+}
+
+#endif
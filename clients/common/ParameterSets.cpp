@@ -0,0 +1,90 @@
+#include "ParameterSets.h"
+#include <string.h>
+
+ParameterSets::Format::Format()
+    : width(0), height(0), profile(0), level(0), chromaFormat(0), bitDepthLuma(0), bitDepthChroma(0),
+      interlaced(false), refFrames(-1), reorderFrames(-1)
+{
+}
+
+ParameterSets::Format::Format(const media::H264SPS& sps)
+    : profile(sps.profile_idc), level(sps.level_idc), chromaFormat(sps.chroma_format_idc),
+      bitDepthLuma(sps.bit_depth_luma_minus8 + 8), bitDepthChroma(sps.bit_depth_chroma_minus8 + 8),
+      interlaced(!sps.frame_mbs_only_flag), refFrames(sps.max_num_ref_frames),
+      reorderFrames(sps.bitstream_restriction_flag ? sps.max_num_reorder_frames : -1)
+{
+    // see 7.4.2.1.1, the crop offsets are in chroma samples
+    const int fieldFactor = sps.frame_mbs_only_flag ? 1 : 2;
+    int cropUnitX = 1, cropUnitY = fieldFactor;
+    if (sps.chroma_array_type == 1) {
+        cropUnitX = 2;
+        cropUnitY = 2 * fieldFactor;
+    } else if (sps.chroma_array_type == 2) {
+        cropUnitX = 2;
+    }
+    width = (sps.pic_width_in_mbs_minus1 + 1) * 16;
+    height = (sps.pic_height_in_map_units_minus1 + 1) * 16 * fieldFactor;
+    if (sps.frame_cropping_flag) {
+        width -= cropUnitX * (sps.frame_crop_left_offset + sps.frame_crop_right_offset);
+        height -= cropUnitY * (sps.frame_crop_top_offset + sps.frame_crop_bottom_offset);
+    }
+}
+
+bool ParameterSets::Format::operator==(const Format& other) const
+{
+    return width == other.width && height == other.height
+        && profile == other.profile && level == other.level
+        && chromaFormat == other.chromaFormat
+        && bitDepthLuma == other.bitDepthLuma && bitDepthChroma == other.bitDepthChroma
+        && interlaced == other.interlaced
+        && refFrames == other.refFrames && reorderFrames == other.reorderFrames;
+}
+
+ParameterSets::ParameterSets()
+    : mPPSId(-1), mValid(false)
+{
+}
+
+bool ParameterSets::store(std::vector<uint8_t>& dst, const uint8_t* data, size_t size)
+{
+    if (dst.size() == size && !memcmp(dst.data(), data, size))
+        return false;
+    dst.assign(data, data + size);
+    return true;
+}
+
+ParameterSets::Change ParameterSets::update(const uint8_t* data, const media::H264NALUEntry* nalus, size_t count)
+{
+    bool changed = false;
+    for (size_t i = 0; i < count; ++i) {
+        const media::H264NALUEntry& entry = nalus[i];
+        if (entry.nal_unit_type != media::H264NALU::kSPS && entry.nal_unit_type != media::H264NALU::kPPS)
+            continue;
+        media::H264NALU nalu;
+        if (mParser.SetNALU(data, entry, &nalu) != media::H264Parser::kOk)
+            continue;
+        int id;
+        if (entry.nal_unit_type == media::H264NALU::kSPS) {
+            // unchanged re-sends are skipped by the parser
+            if (mParser.ParseSPS(&id) == media::H264Parser::kOk)
+                changed |= store(mSPS, data + entry.offset, entry.size);
+        } else if (mParser.ParsePPS(&id) == media::H264Parser::kOk) {
+            mPPSId = id;
+            changed |= store(mPPS, data + entry.offset, entry.size);
+        }
+    }
+    if (!changed)
+        return None;
+
+    const media::H264PPS* pps = mParser.GetPPS(mPPSId);
+    const media::H264SPS* sps = pps ? mParser.GetSPS(pps->seq_parameter_set_id) : 0;
+    if (!sps)
+        return None;
+    const Format format(*sps);
+    if (mValid && format == mFormat)
+        return ParameterSetsChanged;
+    mValid = true;
+    mFormat = format;
+    mFormatChanged(mFormat);
+    return FormatChanged;
+}
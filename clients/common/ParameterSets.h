@@ -0,0 +1,74 @@
+#ifndef PARAMETERSETS_H
+#define PARAMETERSETS_H
+
+#include <rct/SignalSlot.h>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+#include "h264_parser.h"
+
+// Follows the SPS and PPS of a stream and tells the decoder-relevant
+// changes apart from everything else. The HD60 re-sends both with every
+// IDR picture and they only really change when the console switches
+// modes, that's the only time the decoder needs to be set up again.
+// Streams with more than one SPS/PPS in use aren't a thing here, the
+// last ones received are the active ones.
+class ParameterSets
+{
+public:
+    // what a decoder has to be set up for
+    struct Format
+    {
+        Format();
+        Format(const media::H264SPS& sps);
+
+        bool operator==(const Format& other) const;
+        bool operator!=(const Format& other) const { return !(*this == other); }
+
+        // cropped picture size in pixels
+        int width, height;
+        int profile, level;
+        int chromaFormat, bitDepthLuma, bitDepthChroma;
+        bool interlaced;
+        // -1 if the stream doesn't say
+        int refFrames, reorderFrames;
+    };
+
+    enum Change {
+        // nothing new, or only re-sends
+        None,
+        // the SPS or PPS are different but the format isn't. decoders that
+        // take the parameter sets out of band need the new ones
+        ParameterSetsChanged,
+        FormatChanged
+    };
+
+    ParameterSets();
+
+    // Goes through the SPSes and PPSes of an indexed access unit, emits
+    // formatChanged() before returning FormatChanged
+    Change update(const uint8_t* data, const media::H264NALUEntry* nalus, size_t count);
+
+    // false until both an SPS and a PPS referring to it have been seen
+    bool isValid() const { return mValid; }
+    const Format& format() const { return mFormat; }
+
+    // the active NALUs, header byte included
+    const std::vector<uint8_t>& sps() const { return mSPS; }
+    const std::vector<uint8_t>& pps() const { return mPPS; }
+
+    Signal<std::function<void(const Format&)> >& formatChanged() { return mFormatChanged; }
+
+private:
+    bool store(std::vector<uint8_t>& dst, const uint8_t* data, size_t size);
+
+    media::H264Parser mParser;
+    std::vector<uint8_t> mSPS, mPPS;
+    int mPPSId;
+    bool mValid;
+    Format mFormat;
+
+    Signal<std::function<void(const Format&)> > mFormatChanged;
+};
+
+#endif
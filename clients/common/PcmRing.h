@@ -0,0 +1,90 @@
+#ifndef PCMRING_H
+#define PCMRING_H
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Wait free ring of PCM bytes between one producer thread (the decoder) and
+// one consumer thread (the audio output callback). All memory is allocated
+// up front, neither side ever locks or allocates.
+class PcmRing
+{
+public:
+    // capacity is rounded up to a power of two
+    PcmRing(size_t capacity);
+
+    // producer side. writes all of data or nothing at all so that partial
+    // frames never end up in the ring, returns false if there wasn't room
+    bool write(const void* data, size_t size);
+
+    // consumer side. reads up to size bytes and returns how many were read
+    size_t read(void* data, size_t size);
+
+    // bytes available to the consumer / free for the producer
+    size_t available() const;
+    size_t space() const { return mCapacity - available(); }
+    size_t capacity() const { return mCapacity; }
+
+private:
+    std::unique_ptr<uint8_t[]> mData;
+    size_t mCapacity, mMask;
+
+    alignas(64) std::atomic<size_t> mReadPos;
+    alignas(64) std::atomic<size_t> mWritePos;
+
+    PcmRing(const PcmRing&) = delete;
+    PcmRing& operator=(const PcmRing&) = delete;
+};
+
+inline PcmRing::PcmRing(size_t capacity)
+    : mCapacity(1), mMask(0), mReadPos(0), mWritePos(0)
+{
+    while (mCapacity < capacity)
+        mCapacity <<= 1;
+    mMask = mCapacity - 1;
+    mData.reset(new uint8_t[mCapacity]);
+}
+
+inline bool PcmRing::write(const void* data, size_t size)
+{
+    const size_t writePos = mWritePos.load(std::memory_order_relaxed);
+    const size_t readPos = mReadPos.load(std::memory_order_acquire);
+    if (size > mCapacity - (writePos - readPos))
+        return false;
+
+    const size_t offset = writePos & mMask;
+    const size_t first = std::min(size, mCapacity - offset);
+    memcpy(mData.get() + offset, data, first);
+    memcpy(mData.get(), static_cast<const uint8_t*>(data) + first, size - first);
+
+    mWritePos.store(writePos + size, std::memory_order_release);
+    return true;
+}
+
+inline size_t PcmRing::read(void* data, size_t size)
+{
+    const size_t readPos = mReadPos.load(std::memory_order_relaxed);
+    const size_t writePos = mWritePos.load(std::memory_order_acquire);
+    size = std::min(size, writePos - readPos);
+
+    const size_t offset = readPos & mMask;
+    const size_t first = std::min(size, mCapacity - offset);
+    memcpy(data, mData.get() + offset, first);
+    memcpy(static_cast<uint8_t*>(data) + first, mData.get(), size - first);
+
+    mReadPos.store(readPos + size, std::memory_order_release);
+    return size;
+}
+
+inline size_t PcmRing::available() const
+{
+    const size_t readPos = mReadPos.load(std::memory_order_acquire);
+    const size_t writePos = mWritePos.load(std::memory_order_acquire);
+    return writePos - readPos;
+}
+
+#endif
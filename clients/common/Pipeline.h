@@ -0,0 +1,258 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include "SpscQueue.h"
+#include "Histogram.h"
+#include <atomic>
+#include <assert.h>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+struct StageStats
+{
+    StageStats()
+        : depth(0), capacity(0), maxDepth(0), processed(0), stalls(0), idle(0), dropped(0), droppedBytes(0),
+          latencyMean(0), latencyP50(0), latencyP99(0), latencyMax(0), serviceP50(0), serviceP99(0)
+    {
+    }
+
+    std::string name;
+    size_t depth, capacity, maxDepth;
+    // items handled by the stage thread
+    uint64_t processed;
+    // pushes that found the queue full and had to wait for the stage
+    uint64_t stalls;
+    // times the stage thread ran out of work and went to sleep
+    uint64_t idle;
+    // items thrown away to stay under the high-water mark
+    uint64_t dropped, droppedBytes;
+    // nanoseconds from push until the handler returned
+    uint64_t latencyMean, latencyP50, latencyP99, latencyMax;
+    // nanoseconds spent in the handler alone
+    uint64_t serviceP50, serviceP99;
+};
+
+// One step of the client pipeline. Items pushed from a single producer
+// thread go through a bounded SpscQueue to a thread of their own that runs
+// the handler. A full queue blocks the producer, which is what pushes back
+// on the socket when a later stage falls behind, unless the stage has a
+// high-water mark.
+template<typename T>
+class PipelineStage
+{
+public:
+    typedef std::function<void(T&&)> Handler;
+    typedef std::function<size_t(const T&)> SizeFunction;
+    // called on the stage thread before the first item handled after a
+    // drop, with what was dropped since the last call
+    typedef std::function<void(size_t items, size_t bytes)> DropHandler;
+
+    PipelineStage(const std::string& name, size_t capacity, Handler&& handler);
+    ~PipelineStage();
+
+    // Keep at most bytes queued instead of blocking the producer. The stage
+    // thread throws away the oldest items until it's back under the mark,
+    // a push that finds the queue full while the handler is busy drops the
+    // new item. Call before start().
+    void setHighWaterMark(size_t bytes, SizeFunction&& size, DropHandler&& dropped);
+
+    void start();
+    // finishes whatever is already queued before returning
+    void stop();
+
+    // producer side
+    void push(T&& item);
+
+    StageStats stats() const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Entry
+    {
+        T item;
+        Clock::time_point queued;
+        // pushes dropped right before this one because the queue was full
+        size_t gapItems, gapBytes;
+    };
+
+    void run();
+
+    std::string mName;
+    SpscQueue<Entry> mQueue;
+    Handler mHandler;
+    std::thread mThread;
+    std::atomic<bool> mStopped;
+
+    std::mutex mMutex;
+    std::condition_variable mCond;
+    std::atomic<bool> mSleeping;
+
+    std::atomic<size_t> mMaxDepth;
+    std::atomic<uint64_t> mProcessed, mStalls, mIdle;
+    Histogram mLatency, mService;
+
+    size_t mHighWaterMark;
+    SizeFunction mSize;
+    DropHandler mDropHandler;
+    std::atomic<size_t> mBytes;
+    // producer side, what the next entry has to report
+    size_t mGapItems, mGapBytes;
+    std::atomic<uint64_t> mDropped, mDroppedBytes;
+};
+
+template<typename T>
+inline PipelineStage<T>::PipelineStage(const std::string& name, size_t capacity, Handler&& handler)
+    : mName(name), mQueue(capacity), mHandler(std::move(handler)), mStopped(true), mSleeping(false),
+      mMaxDepth(0), mProcessed(0), mStalls(0), mIdle(0),
+      mHighWaterMark(0), mBytes(0), mGapItems(0), mGapBytes(0), mDropped(0), mDroppedBytes(0)
+{
+}
+
+template<typename T>
+inline PipelineStage<T>::~PipelineStage()
+{
+    stop();
+}
+
+template<typename T>
+inline void PipelineStage<T>::setHighWaterMark(size_t bytes, SizeFunction&& size, DropHandler&& dropped)
+{
+    assert(mStopped.load());
+    mHighWaterMark = bytes;
+    mSize = std::move(size);
+    mDropHandler = std::move(dropped);
+}
+
+template<typename T>
+inline void PipelineStage<T>::start()
+{
+    if (!mStopped.load())
+        return;
+    mStopped = false;
+    mThread = std::thread(&PipelineStage<T>::run, this);
+}
+
+template<typename T>
+inline void PipelineStage<T>::stop()
+{
+    if (mStopped.exchange(true))
+        return;
+    {
+        std::unique_lock<std::mutex> locker(mMutex);
+        mCond.notify_one();
+    }
+    mThread.join();
+}
+
+template<typename T>
+inline void PipelineStage<T>::push(T&& item)
+{
+    Entry entry = { std::move(item), Clock::now(), mGapItems, mGapBytes };
+    if (mHighWaterMark) {
+        const size_t size = mSize(entry.item);
+        // counted before the stage thread can see it so that mBytes
+        // never goes below zero
+        mBytes.fetch_add(size);
+        if (!mQueue.tryPush(std::move(entry))) {
+            mBytes.fetch_sub(size);
+            ++mGapItems;
+            mGapBytes += size;
+            ++mDropped;
+            mDroppedBytes += size;
+            return;
+        }
+        mGapItems = mGapBytes = 0;
+    } else if (!mQueue.tryPush(std::move(entry))) {
+        ++mStalls;
+        auto backoff = std::chrono::microseconds(50);
+        while (!mQueue.tryPush(std::move(entry))) {
+            if (mStopped.load())
+                return;
+            std::this_thread::sleep_for(backoff);
+            backoff = std::min<std::chrono::microseconds>(backoff * 2, std::chrono::milliseconds(2));
+        }
+    }
+    const size_t depth = mQueue.size();
+    if (depth > mMaxDepth.load(std::memory_order_relaxed))
+        mMaxDepth.store(depth, std::memory_order_relaxed);
+    if (mSleeping.load()) {
+        std::unique_lock<std::mutex> locker(mMutex);
+        mCond.notify_one();
+    }
+}
+
+template<typename T>
+inline void PipelineStage<T>::run()
+{
+    Entry entry;
+    size_t droppedItems = 0, droppedBytes = 0;
+    for (;;) {
+        if (mQueue.tryPop(entry)) {
+            if (mHighWaterMark) {
+                const size_t size = mSize(entry.item);
+                droppedItems += entry.gapItems;
+                droppedBytes += entry.gapBytes;
+                // this one and everything behind it
+                if (mBytes.fetch_sub(size) > mHighWaterMark) {
+                    ++droppedItems;
+                    droppedBytes += size;
+                    ++mDropped;
+                    mDroppedBytes += size;
+                    entry.item = T();
+                    continue;
+                }
+                if (droppedItems) {
+                    mDropHandler(droppedItems, droppedBytes);
+                    droppedItems = droppedBytes = 0;
+                }
+            }
+            const Clock::time_point started = Clock::now();
+            mHandler(std::move(entry.item));
+            entry.item = T();
+            const Clock::time_point done = Clock::now();
+            mLatency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(done - entry.queued).count());
+            mService.record(std::chrono::duration_cast<std::chrono::nanoseconds>(done - started).count());
+            ++mProcessed;
+            continue;
+        }
+        if (mStopped.load())
+            break;
+        ++mIdle;
+        std::unique_lock<std::mutex> locker(mMutex);
+        mSleeping = true;
+        // the producer might have pushed between tryPop and mSleeping being
+        // set, the timeout makes sure a missed wakeup only costs a little
+        if (mQueue.isEmpty() && !mStopped.load())
+            mCond.wait_for(locker, std::chrono::milliseconds(5));
+        mSleeping = false;
+    }
+}
+
+template<typename T>
+inline StageStats PipelineStage<T>::stats() const
+{
+    StageStats stats;
+    stats.name = mName;
+    stats.depth = mQueue.size();
+    stats.capacity = mQueue.capacity();
+    stats.maxDepth = mMaxDepth.load();
+    stats.processed = mProcessed.load();
+    stats.stalls = mStalls.load();
+    stats.idle = mIdle.load();
+    stats.dropped = mDropped.load();
+    stats.droppedBytes = mDroppedBytes.load();
+    stats.latencyMean = mLatency.mean();
+    stats.latencyP50 = mLatency.percentile(50);
+    stats.latencyP99 = mLatency.percentile(99);
+    stats.latencyMax = mLatency.max();
+    stats.serviceP50 = mService.percentile(50);
+    stats.serviceP99 = mService.percentile(99);
+    return stats;
+}
+
+#endif
@@ -0,0 +1,49 @@
+#include "RandomAccess.h"
+
+RandomAccess::RandomAccess()
+    : mTotal(0), mAccessUnits(0)
+{
+}
+
+RandomAccess::Type RandomAccess::update(const uint8_t* data, const media::H264NALUEntry* nalus, size_t count, uint64_t pts)
+{
+    const uint64_t accessUnit = mAccessUnits++;
+    Point point;
+    for (size_t i = 0; i < count && point.type != IDR; ++i) {
+        const media::H264NALUEntry& entry = nalus[i];
+        if (entry.nal_unit_type == media::H264NALU::kIDRSlice) {
+            point = Point();
+            point.type = IDR;
+            point.exact = true;
+        } else if (entry.nal_unit_type == media::H264NALU::kSPS) {
+            // a buffering_period ahead of the recovery point needs the SPS
+            // to get past its delays, a re-sent one isn't parsed again
+            media::H264NALU nalu;
+            int id;
+            if (mParser.SetNALU(data, entry, &nalu) == media::H264Parser::kOk)
+                mParser.ParseSPS(&id);
+        } else if (entry.nal_unit_type == media::H264NALU::kSEIMessage && point.type == None) {
+            // the SEI comes before the slices, only look at it until the
+            // first recovery point
+            media::H264NALU nalu;
+            media::H264Parser::Result result = mParser.SetNALU(data, entry, &nalu);
+            while (result == media::H264Parser::kOk && point.type == None) {
+                media::H264SEIMessage sei;
+                result = mParser.ParseSEI(&sei);
+                if (result == media::H264Parser::kOk && sei.type == media::H264SEIMessage::kSEIRecoveryPoint) {
+                    point.type = RecoveryPoint;
+                    point.recoveryFrames = sei.recovery_point.recovery_frame_cnt;
+                    point.exact = sei.recovery_point.exact_match_flag;
+                    point.brokenLink = sei.recovery_point.broken_link_flag;
+                }
+            }
+        }
+    }
+    if (point.type == None)
+        return None;
+
+    point.accessUnit = accessUnit;
+    point.pts = pts;
+    mPoints[mTotal++ % MaxPoints] = point;
+    return point.type;
+}
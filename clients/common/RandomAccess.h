@@ -0,0 +1,58 @@
+#ifndef RANDOMACCESS_H
+#define RANDOMACCESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "h264_parser.h"
+
+// Rolling index of the places in a stream a decoder can start from, IDR
+// pictures and access units with a recovery point SEI. Whoever joins the
+// stream late, or throws its decoder away, waits for the next one of these
+// instead of feeding the decoder pictures that refer to things it never
+// saw.
+class RandomAccess
+{
+public:
+    enum Type {
+        None,
+        IDR,
+        // decoding can start here, the output is right after recoveryFrames
+        RecoveryPoint
+    };
+
+    struct Point
+    {
+        Point() : type(None), accessUnit(0), pts(0), recoveryFrames(0), exact(false), brokenLink(false) { }
+
+        Type type;
+        // number of access units before this one
+        uint64_t accessUnit;
+        uint64_t pts;
+        // 0 for IDR pictures
+        int recoveryFrames;
+        bool exact, brokenLink;
+    };
+
+    enum { MaxPoints = 16 };
+
+    RandomAccess();
+
+    // Looks at one indexed access unit, adds it to the index and returns
+    // its type if decoding can start there
+    Type update(const uint8_t* data, const media::H264NALUEntry* nalus, size_t count, uint64_t pts);
+
+    uint64_t accessUnits() const { return mAccessUnits; }
+
+    // the last MaxPoints points, 0 is the most recent one
+    size_t count() const { return mTotal < MaxPoints ? static_cast<size_t>(mTotal) : static_cast<size_t>(MaxPoints); }
+    const Point& point(size_t idx) const { return mPoints[(mTotal - 1 - idx) % MaxPoints]; }
+    // null if there hasn't been one yet
+    const Point* latest() const { return mTotal ? &point(0) : 0; }
+
+private:
+    media::H264Parser mParser;
+    Point mPoints[MaxPoints];
+    uint64_t mTotal, mAccessUnits;
+};
+
+#endif
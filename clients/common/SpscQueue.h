@@ -0,0 +1,92 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <vector>
+#include <stddef.h>
+
+// Bounded lock free queue for exactly one producer thread and one consumer
+// thread. Slots are allocated up front, T needs to be default constructible
+// and move assignable.
+template<typename T>
+class SpscQueue
+{
+public:
+    SpscQueue(size_t capacity);
+
+    // producer side, returns false if the queue is full
+    bool tryPush(T&& value);
+    // consumer side, returns false if the queue is empty
+    bool tryPop(T& value);
+
+    // approximate when called from a thread that is neither the
+    // producer nor the consumer
+    size_t size() const;
+    bool isEmpty() const { return !size(); }
+    size_t capacity() const { return mSlots.size(); }
+
+private:
+    std::vector<T> mSlots;
+    size_t mMask;
+
+    // keep the indexes on separate cache lines so that the producer and
+    // consumer don't invalidate each other on every operation
+    alignas(64) std::atomic<size_t> mHead;
+    size_t mCachedTail;
+    alignas(64) std::atomic<size_t> mTail;
+    size_t mCachedHead;
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+};
+
+template<typename T>
+inline SpscQueue<T>::SpscQueue(size_t capacity)
+    : mMask(0), mHead(0), mCachedTail(0), mTail(0), mCachedHead(0)
+{
+    size_t cap = 1;
+    while (cap < capacity)
+        cap <<= 1;
+    mSlots.resize(cap);
+    mMask = cap - 1;
+}
+
+template<typename T>
+inline bool SpscQueue<T>::tryPush(T&& value)
+{
+    const size_t tail = mTail.load(std::memory_order_relaxed);
+    if (tail - mCachedHead == mSlots.size()) {
+        mCachedHead = mHead.load(std::memory_order_acquire);
+        if (tail - mCachedHead == mSlots.size())
+            return false;
+    }
+    mSlots[tail & mMask] = std::move(value);
+    mTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+inline bool SpscQueue<T>::tryPop(T& value)
+{
+    const size_t head = mHead.load(std::memory_order_relaxed);
+    if (head == mCachedTail) {
+        mCachedTail = mTail.load(std::memory_order_acquire);
+        if (head == mCachedTail)
+            return false;
+    }
+    value = std::move(mSlots[head & mMask]);
+    // don't keep whatever the slot held alive until it gets reused
+    mSlots[head & mMask] = T();
+    mHead.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+inline size_t SpscQueue<T>::size() const
+{
+    const size_t head = mHead.load(std::memory_order_acquire);
+    const size_t tail = mTail.load(std::memory_order_acquire);
+    return tail - head;
+}
+
+#endif
@@ -0,0 +1,263 @@
+// Copyright 2014 The Chromium Authors. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//    * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//    * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//    * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "h264_bit_reader.h"
+
+#include <string.h>
+
+namespace media {
+
+namespace {
+
+inline uint64_t LoadBigEndian64(const uint8_t* data) {
+  uint64_t value;
+  memcpy(&value, data, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  value = __builtin_bswap64(value);
+#endif
+  return value;
+}
+
+inline bool HasZeroByte(uint64_t value) {
+  return ((value - 0x0101010101010101ull) & ~value & 0x8080808080808080ull) != 0;
+}
+
+}  // namespace
+
+H264BitReader::H264BitReader()
+    : data_(NULL),
+      bytes_left_(0),
+      cache_(0),
+      num_bits_in_cache_(0),
+      prev_two_bytes_(0),
+      emulation_prevention_bytes_(0),
+      bytes_loaded_(0) {}
+
+H264BitReader::~H264BitReader() {}
+
+bool H264BitReader::Initialize(const uint8_t* data, off_t size) {
+
+  if (size < 1)
+    return false;
+
+  data_ = data;
+  bytes_left_ = size;
+  cache_ = 0;
+  num_bits_in_cache_ = 0;
+  // Initially set to 0xffff to accept all initial two-byte sequences.
+  prev_two_bytes_ = 0xffff;
+  emulation_prevention_bytes_ = 0;
+  bytes_loaded_ = 0;
+
+  return true;
+}
+
+bool H264BitReader::LoadByte() {
+  if (bytes_left_ < 1)
+    return false;
+
+  // Emulation prevention three-byte detection.
+  // If a sequence of 0x000003 is found, skip (ignore) the last byte (0x03).
+  if (*data_ == 0x03 && (prev_two_bytes_ & 0xffff) == 0) {
+    // Detected 0x000003, skip last byte.
+    ++data_;
+    --bytes_left_;
+    recent_emulation_prevention_bytes_[emulation_prevention_bytes_ %
+                                       kRecentEmulationPreventionBytes] =
+        bytes_loaded_;
+    ++emulation_prevention_bytes_;
+    // Need another full three bytes before we can detect the sequence again.
+    prev_two_bytes_ = 0xffff;
+
+    if (bytes_left_ < 1)
+      return false;
+  }
+
+  // Load a new byte and advance pointers.
+  const int byte = *data_++;
+  --bytes_left_;
+  cache_ |= static_cast<uint64_t>(byte) << (56 - num_bits_in_cache_);
+  num_bits_in_cache_ += 8;
+  ++bytes_loaded_;
+
+  prev_two_bytes_ = ((prev_two_bytes_ & 0xff) << 8) | byte;
+
+  return true;
+}
+
+void H264BitReader::Refill() {
+  while (num_bits_in_cache_ <= 56) {
+    // Take all the bytes that fit in one go when none of them can be an
+    // emulation prevention byte. Without a zero byte among them that can
+    // only be the first one, following two zero bytes we already have.
+    if (bytes_left_ >= 8) {
+      const uint64_t word = LoadBigEndian64(data_);
+      if (!HasZeroByte(word) &&
+          !((word >> 56) == 0x03 && (prev_two_bytes_ & 0xffff) == 0)) {
+        const int num_bytes = (64 - num_bits_in_cache_) >> 3;
+        const int num_bits = num_bytes * 8;
+        const uint64_t taken = num_bytes == 8 ? word : word >> (64 - num_bits);
+        cache_ |= (taken << (64 - num_bits)) >> num_bits_in_cache_;
+        num_bits_in_cache_ += num_bits;
+        data_ += num_bytes;
+        bytes_left_ -= num_bytes;
+        bytes_loaded_ += num_bytes;
+        prev_two_bytes_ = num_bytes > 1
+                              ? static_cast<int>(taken & 0xffff)
+                              : ((prev_two_bytes_ & 0xff) << 8) |
+                                    static_cast<int>(taken);
+        return;
+      }
+    }
+
+    if (!LoadByte())
+      return;
+  }
+}
+
+bool H264BitReader::ReadUE(int* out) {
+  // Count the number of contiguous zero bits. Bits past the end of the
+  // cache are zero so the count has to be capped to what's in it.
+  int num_bits = 0;
+  for (;;) {
+    if (num_bits_in_cache_ < 32)
+      Refill();
+    if (num_bits_in_cache_ == 0)
+      return false;
+    int zeros = cache_ ? __builtin_clzll(cache_) : 64;
+    if (zeros < num_bits_in_cache_) {
+      num_bits += zeros;
+      // drop the zeros and the one that ends them
+      cache_ = (cache_ << zeros) << 1;
+      num_bits_in_cache_ -= zeros + 1;
+      break;
+    }
+    num_bits += num_bits_in_cache_;
+    cache_ = 0;
+    num_bits_in_cache_ = 0;
+    if (num_bits > 31)
+      return false;
+  }
+
+  if (num_bits > 31)
+    return false;
+
+  // Calculate exp-Golomb code value of size num_bits.
+  // Special case for |num_bits| == 31 to avoid integer overflow. The only
+  // valid representation as an int is 2^31 - 1, so the remaining bits must
+  // be 0 or else the number is too large.
+  *out = (1u << num_bits) - 1u;
+
+  int rest;
+  if (num_bits == 31) {
+    if (!ReadBits(num_bits, &rest))
+      return false;
+    return rest == 0;
+  }
+
+  if (num_bits > 0) {
+    if (!ReadBits(num_bits, &rest))
+      return false;
+    *out += rest;
+  }
+
+  return true;
+}
+
+size_t H264BitReader::NumEmulationPreventionBytesAfter(size_t bytes) const {
+  size_t after = 0;
+  while (after < emulation_prevention_bytes_ &&
+         after < kRecentEmulationPreventionBytes &&
+         recent_emulation_prevention_bytes_
+                 [(emulation_prevention_bytes_ - after - 1) %
+                  kRecentEmulationPreventionBytes] >= bytes) {
+    ++after;
+  }
+  return after;
+}
+
+size_t H264BitReader::NumEmulationPreventionBytesAhead() const {
+  // Whole bytes in the cache haven't been started on, the partly read one
+  // has been.
+  return NumEmulationPreventionBytesAfter(bytes_loaded_ -
+                                          num_bits_in_cache_ / 8);
+}
+
+off_t H264BitReader::NumBitsLeft() {
+  return num_bits_in_cache_ +
+         (bytes_left_ + NumEmulationPreventionBytesAhead()) * 8;
+}
+
+bool H264BitReader::HasMoreRBSPData() {
+  // Make sure we have more bits, if we are at 0 bits in current byte and
+  // updating current byte fails, we don't have more data anyway.
+  if (num_bits_in_cache_ == 0) {
+    Refill();
+    if (num_bits_in_cache_ == 0)
+      return false;
+  }
+  const int num_remaining_bits_in_curr_byte =
+      num_bits_in_cache_ % 8 ? num_bits_in_cache_ % 8 : 8;
+  const int curr_byte =
+      static_cast<int>(cache_ >> (64 - num_remaining_bits_in_curr_byte));
+
+  // If there is no more RBSP data, then |curr_byte| contains the stop bit and
+  // zero padding. Check to see if there is other data instead.
+  // (We don't actually check for the stop bit itself, instead treating the
+  // invalid case of all trailing zeros identically).
+  if ((curr_byte & ((1 << (num_remaining_bits_in_curr_byte - 1)) - 1)) != 0)
+    return true;
+
+  // While the spec disallows it (7.4.1: "The last byte of the NAL unit shall
+  // not be equal to 0x00"), some streams have trailing null bytes anyway. We
+  // don't handle emulation prevention sequences because HasMoreRBSPData() is
+  // not used when parsing slices (where cabac_zero_word elements are legal).
+  // The rest of the cache and any emulation prevention bytes skipped
+  // loading it count as other data too. Unlike the byte at a time reader we
+  // don't mark the current byte as started when we're at a byte boundary,
+  // which can only show in NumBitsLeft() afterwards.
+  const size_t curr_byte_index =
+      bytes_loaded_ - (num_bits_in_cache_ + 7) / 8;
+  if ((cache_ << num_remaining_bits_in_curr_byte) != 0 ||
+      NumEmulationPreventionBytesAfter(curr_byte_index + 1) > 0)
+    return true;
+  for (off_t i = 0; i < bytes_left_; i++) {
+    if (data_[i] != 0)
+      return true;
+  }
+
+  bytes_left_ = 0;
+  num_bits_in_cache_ = num_remaining_bits_in_curr_byte;
+  return false;
+}
+
+size_t H264BitReader::NumEmulationPreventionBytesRead() {
+  return emulation_prevention_bytes_ - NumEmulationPreventionBytesAhead();
+}
+
+}  // namespace media
@@ -56,11 +56,16 @@ class H264BitReader {
 
   // Read |num_bits| next bits from stream and return in |*out|, first bit
   // from the stream starting at |num_bits| position in |*out|.
-  // |num_bits| may be 1-32, inclusive.
+  // |num_bits| may be 1-31, inclusive.
   // Return false if the given number of bits cannot be read (not enough
   // bits in the stream), true otherwise.
   bool ReadBits(int num_bits, int* out);
 
+  // Read an unsigned Exp-Golomb code into |*out|.
+  // Return false if the stream ends before the code does or the value
+  // doesn't fit in an int.
+  bool ReadUE(int* out);
+
   // Return the number of bits left in the stream.
   off_t NumBitsLeft();
 
@@ -71,22 +76,34 @@ class H264BitReader {
   size_t NumEmulationPreventionBytesRead();
 
  private:
-  // Advance to the next byte, loading it into curr_byte_.
+  // Load whole bytes into cache_ until it holds more than 56 bits or the
+  // stream ends, skipping emulation prevention bytes.
+  void Refill();
+
+  // Load one byte, checking it for emulation prevention.
   // Return false on end of stream.
-  bool UpdateCurrByte();
+  bool LoadByte();
+
+  // Number of emulation prevention bytes that were skipped while loading
+  // bytes into the cache that haven't been started on yet. The original
+  // byte at a time reader hadn't met those, this keeps NumBitsLeft() and
+  // NumEmulationPreventionBytesRead() what they were.
+  size_t NumEmulationPreventionBytesAhead() const;
+
+  // Number of emulation prevention bytes met after the first |bytes|
+  // bytes were loaded.
+  size_t NumEmulationPreventionBytesAfter(size_t bytes) const;
 
-  // Pointer to the next unread (not in curr_byte_) byte in the stream.
+  // Pointer to the next byte not loaded into cache_.
   const uint8_t* data_;
 
-  // Bytes left in the stream (without the curr_byte_).
+  // Bytes left in the stream (without those in cache_).
   off_t bytes_left_;
 
-  // Contents of the current byte; first unread bit starting at position
-  // 8 - num_remaining_bits_in_curr_byte_ from MSB.
-  int curr_byte_;
-
-  // Number of bits remaining in curr_byte_
-  int num_remaining_bits_in_curr_byte_;
+  // The next bits to read, starting at the MSB. Bits past
+  // num_bits_in_cache_ are always zero.
+  uint64_t cache_;
+  int num_bits_in_cache_;
 
   // Used in emulation prevention three byte detection (see spec).
   // Initially set to 0xffff to accept all initial two-byte sequences.
@@ -95,10 +112,37 @@ class H264BitReader {
   // Number of emulation preventation bytes (0x000003) we met.
   size_t emulation_prevention_bytes_;
 
+  // Bytes loaded into the cache so far, and for the most recent emulation
+  // prevention bytes how many had been loaded when we met them. The cache
+  // holds at most 8 bytes and every emulation prevention byte needs two
+  // zero bytes before it, so there can't be more than 8 ahead.
+  enum { kRecentEmulationPreventionBytes = 8 };
+  size_t bytes_loaded_;
+  size_t recent_emulation_prevention_bytes_[kRecentEmulationPreventionBytes];
+
   H264BitReader(const H264BitReader&) = delete;
   H264BitReader& operator=(const H264BitReader&) = delete;
 };
 
+// Read |num_bits| (0 to 31 inclusive) from the stream and return them
+// in |out|, with first bit in the stream as MSB in |out| at position
+// (|num_bits| - 1). Inline since the parser calls this for nearly every
+// syntax element and it's usually a shift out of the cache.
+inline bool H264BitReader::ReadBits(int num_bits, int* out) {
+  if (num_bits_in_cache_ < num_bits) {
+    Refill();
+    if (num_bits_in_cache_ < num_bits)
+      return false;
+  }
+
+  // shifted in two steps so that |num_bits| == 0 is well defined
+  *out = static_cast<int>((cache_ >> 1) >> (63 - num_bits));
+  cache_ <<= num_bits;
+  num_bits_in_cache_ -= num_bits;
+
+  return true;
+}
+
 }  // namespace media
 
 #endif  // MEDIA_H264_BIT_READER_H_
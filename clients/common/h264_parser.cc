@@ -27,7 +27,9 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "h264_parser.h"
+#include "h264_start_code.h"
 
+#include <algorithm>
 #include <cstring>
 #include <limits>
 #include <memory>
@@ -135,17 +137,18 @@ static const int kTableSarHeight[] = {
 static_assert(sizeof(kTableSarWidth) == sizeof(kTableSarHeight),
               "sar tables must have the same size");
 
-H264Parser::H264Parser() {
+H264Parser::H264Parser()
+    : nalu_data_(NULL),
+      nalu_size_(0),
+      sps_present_(0),
+      active_sps_id_(-1) {
+  std::memset(sps_hash_, 0, sizeof(sps_hash_));
+  std::memset(pps_hash_, 0, sizeof(pps_hash_));
+  std::memset(pps_present_, 0, sizeof(pps_present_));
   Reset();
 }
 
 H264Parser::~H264Parser() {
-  for (auto&& sps : active_SPSes_)
-    delete sps.second;
-  active_SPSes_.clear();
-  for (auto&& pps : active_PPSes_)
-    delete pps.second;
-  active_PPSes_.clear();
 }
 
 void H264Parser::Reset() {
@@ -181,25 +184,56 @@ void H264Parser::SetEncryptedStream(
 }
 
 const H264PPS* H264Parser::GetPPS(int pps_id) const {
-  auto it = active_PPSes_.find(pps_id);
-  if (it == active_PPSes_.end()) {
+  if (pps_id < 0 || pps_id >= kMaxPPSs ||
+      !(pps_present_[pps_id / 64] & (1ull << (pps_id % 64)))) {
     return nullptr;
   }
 
-  return it->second;
+  return pps_[pps_id].get();
 }
 
 const H264SPS* H264Parser::GetSPS(int sps_id) const {
-  auto it = active_SPSes_.find(sps_id);
-  if (it == active_SPSes_.end()) {
+  if (sps_id < 0 || sps_id >= kMaxSPSs || !(sps_present_ & (1u << sps_id))) {
     return nullptr;
   }
 
-  return it->second;
+  return sps_[sps_id].get();
 }
 
-static inline bool IsStartCode(const uint8_t* data) {
-  return data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x01;
+uint64_t H264Parser::HashNALU() const {
+  // FNV-1a, parameter sets are a few dozen bytes
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (off_t i = 0; i < nalu_size_; ++i) {
+    hash ^= nalu_data_[i];
+    hash *= 0x100000001b3ull;
+  }
+  // 0 marks an unknown hash
+  return hash ? hash : 1;
+}
+
+bool H264Parser::IsStoredNALU(uint64_t hash,
+                              uint64_t stored_hash,
+                              const std::vector<uint8_t>& stored) const {
+  // These bytes come off the network, a matching hash only says it's worth
+  // comparing them.
+  return hash == stored_hash &&
+         stored.size() == static_cast<size_t>(nalu_size_) &&
+         std::memcmp(stored.data(), nalu_data_, nalu_size_) == 0;
+}
+
+bool H264Parser::PeekSPSId(int* sps_id) const {
+  // After the NALU header, profile_idc, the constraint flags and level_idc.
+  H264BitReader br;
+  int data;
+  return br.Initialize(nalu_data_, nalu_size_) && br.ReadBits(8, &data) &&
+         br.ReadBits(24, &data) && br.ReadUE(sps_id) && *sps_id < kMaxSPSs;
+}
+
+bool H264Parser::PeekPPSId(int* pps_id) const {
+  H264BitReader br;
+  int data;
+  return br.Initialize(nalu_data_, nalu_size_) && br.ReadBits(8, &data) &&
+         br.ReadUE(pps_id) && *pps_id < kMaxPPSs;
 }
 
 // static
@@ -207,34 +241,27 @@ bool H264Parser::FindStartCode(const uint8_t* data,
                                off_t data_size,
                                off_t* offset,
                                off_t* start_code_size) {
-  off_t bytes_left = data_size;
-
-  while (bytes_left >= 3) {
-    if (IsStartCode(data)) {
-      // Found three-byte start code, set pointer at its beginning.
-      *offset = data_size - bytes_left;
-      *start_code_size = 3;
-
-      // If there is a zero byte before this start code,
-      // then it's actually a four-byte start code, so backtrack one byte.
-      if (*offset > 0 && *(data - 1) == 0x00) {
-        --(*offset);
-        ++(*start_code_size);
-      }
-
-      return true;
+  const off_t found = ScanForStartCode(data, data_size);
+  if (found >= 0) {
+    // Found three-byte start code, set pointer at its beginning.
+    *offset = found;
+    *start_code_size = 3;
+
+    // If there is a zero byte before this start code,
+    // then it's actually a four-byte start code, so backtrack one byte.
+    if (*offset > 0 && data[*offset - 1] == 0x00) {
+      --(*offset);
+      ++(*start_code_size);
     }
 
-    ++data;
-    --bytes_left;
+    return true;
   }
 
   // End of data: offset is pointing to the first byte that was not considered
   // as a possible start of a start code.
   // Note: there is no security issue when receiving a negative |data_size|
-  // since in this case, |bytes_left| is equal to |data_size| and thus
-  // |*offset| is equal to 0 (valid offset).
-  *offset = data_size - bytes_left;
+  // since in this case |*offset| is 0 (valid offset).
+  *offset = data_size >= 3 ? data_size - 2 : 0;
   *start_code_size = 0;
   return false;
 }
@@ -316,36 +343,7 @@ bool H264Parser::FindStartCodeInClearRanges(
 }
 
 H264Parser::Result H264Parser::ReadUE(int* val) {
-  int num_bits = -1;
-  int bit;
-  int rest;
-
-  // Count the number of contiguous zero bits.
-  do {
-    READ_BITS_OR_RETURN(1, &bit);
-    num_bits++;
-  } while (bit == 0);
-
-  if (num_bits > 31)
-    return kInvalidStream;
-
-  // Calculate exp-Golomb code value of size num_bits.
-  // Special case for |num_bits| == 31 to avoid integer overflow. The only
-  // valid representation as an int is 2^31 - 1, so the remaining bits must
-  // be 0 or else the number is too large.
-  *val = (1u << num_bits) - 1u;
-
-  if (num_bits == 31) {
-    READ_BITS_OR_RETURN(num_bits, &rest);
-    return (rest == 0) ? kOk : kInvalidStream;
-  }
-
-  if (num_bits > 0) {
-    READ_BITS_OR_RETURN(num_bits, &rest);
-    *val += rest;
-  }
-
-  return kOk;
+  return br_.ReadUE(val) ? kOk : kInvalidStream;
 }
 
 H264Parser::Result H264Parser::ReadSE(int* val) {
@@ -378,6 +376,8 @@ H264Parser::Result H264Parser::AdvanceToNextNALU(H264NALU* nalu) {
   // Initialize bit reader at the start of found NALU.
   if (!br_.Initialize(nalu->data, nalu->size))
     return kEOStream;
+  nalu_data_ = nalu->data;
+  nalu_size_ = nalu->size;
 
   // Move parser state to after this NALU, so next time AdvanceToNextNALU
   // is called, we will effectively be skipping it;
@@ -397,6 +397,76 @@ H264Parser::Result H264Parser::AdvanceToNextNALU(H264NALU* nalu) {
   return kOk;
 }
 
+H264Parser::Result H264Parser::SetNALU(const uint8_t* stream,
+                                       const H264NALUEntry& entry,
+                                       H264NALU* nalu) {
+  nalu->data = stream + entry.offset;
+  nalu->size = entry.size;
+  nalu->nal_ref_idc = entry.nal_ref_idc;
+  nalu->nal_unit_type = entry.nal_unit_type;
+
+  // Initialize bit reader at the start of the NALU, past the header the
+  // index has already read.
+  if (!br_.Initialize(nalu->data, nalu->size))
+    return kEOStream;
+  nalu_data_ = nalu->data;
+  nalu_size_ = nalu->size;
+  int data;
+  READ_BITS_OR_RETURN(8, &data);
+
+  return kOk;
+}
+
+// static
+H264Parser::Result H264Parser::IndexNALUs(const uint8_t* stream,
+                                          off_t stream_size,
+                                          H264NALUEntry* entries,
+                                          size_t max_entries,
+                                          size_t* num_entries) {
+  *num_entries = 0;
+
+  off_t offset;
+  off_t start_code_size;
+  if (!FindStartCode(stream, stream_size, &offset, &start_code_size))
+    return kOk;
+
+  // Each scan finds the end of the previous NALU and the start of the
+  // next, so every byte is looked at once.
+  off_t nalu_offset = offset + start_code_size;
+  while (nalu_offset < stream_size) {
+    const off_t nalu_start_code_size = start_code_size;
+    off_t nalu_size;
+    if (FindStartCode(stream + nalu_offset, stream_size - nalu_offset,
+                      &offset, &start_code_size)) {
+      nalu_size = offset;
+    } else {
+      nalu_size = stream_size - nalu_offset;
+    }
+    // AdvanceToNextNALU() stops at an empty NALU too
+    if (nalu_size < 1)
+      break;
+
+    const uint8_t header = stream[nalu_offset];
+    if (header & 0x80)
+      return kInvalidStream;
+    if (*num_entries == max_entries)
+      return kUnsupportedStream;
+
+    H264NALUEntry& entry = entries[(*num_entries)++];
+    entry.offset = nalu_offset;
+    entry.size = nalu_size;
+    entry.start_code_size = nalu_start_code_size;
+    entry.nal_ref_idc = (header >> 5) & 0x3;
+    entry.nal_unit_type = header & 0x1f;
+
+    if (!start_code_size)
+      break;
+    nalu_offset += offset + start_code_size;
+  }
+
+  return kOk;
+}
+
 // Default scaling lists (per spec).
 static const int kDefault4x4Intra[kH264ScalingList4x4Length] = {
     6, 13, 13, 20, 20, 20, 28, 28, 28, 28, 32, 32, 32, 37, 37, 42, };
@@ -661,25 +731,54 @@ H264Parser::Result H264Parser::ParsePPSScalingLists(const H264SPS& sps,
   return kOk;
 }
 
-H264Parser::Result H264Parser::ParseAndIgnoreHRDParameters(
-    bool* hrd_parameters_present) {
-  int data;
-  READ_BOOL_OR_RETURN(&data);  // {nal,vcl}_hrd_parameters_present_flag
-  if (!data)
-    return kOk;
-
-  *hrd_parameters_present = true;
+H264Parser::Result H264Parser::ReadLongBits(int num_bits, uint32_t* out) {
+  // The bit reader takes at most 31 at a time.
+  int high = 0;
+  int low;
+  if (num_bits > 16) {
+    READ_BITS_OR_RETURN(num_bits - 16, &high);
+    num_bits = 16;
+  }
+  READ_BITS_OR_RETURN(num_bits, &low);
+  *out = (static_cast<uint32_t>(high) << num_bits) | static_cast<uint32_t>(low);
+  return kOk;
+}
 
+H264Parser::Result H264Parser::ParseHRDParameters(H264SPS* sps, bool vcl) {
+  // See E.1.2.
   int cpb_cnt_minus1;
   READ_UE_OR_RETURN(&cpb_cnt_minus1);
   IN_RANGE_OR_RETURN(cpb_cnt_minus1, 0, 31);
-  READ_BITS_OR_RETURN(8, &data);  // bit_rate_scale, cpb_size_scale
+  if (vcl)
+    sps->vcl_cpb_cnt_minus1 = cpb_cnt_minus1;
+  else
+    sps->cpb_cnt_minus1 = cpb_cnt_minus1;
+
+  // The NAL HRD has already filled these in if there is one.
+  const bool keep = !vcl || !sps->nal_hrd_parameters_present_flag;
+  int bit_rate_scale, cpb_size_scale;
+  READ_BITS_OR_RETURN(4, &bit_rate_scale);
+  READ_BITS_OR_RETURN(4, &cpb_size_scale);
+  if (keep) {
+    sps->bit_rate_scale = bit_rate_scale;
+    sps->cpb_size_scale = cpb_size_scale;
+  }
   for (int i = 0; i <= cpb_cnt_minus1; ++i) {
-    READ_UE_OR_RETURN(&data);  // bit_rate_value_minus1[i]
-    READ_UE_OR_RETURN(&data);  // cpb_size_value_minus1[i]
-    READ_BOOL_OR_RETURN(&data);  // cbr_flag
+    int bit_rate_value_minus1, cpb_size_value_minus1;
+    bool cbr_flag;
+    READ_UE_OR_RETURN(&bit_rate_value_minus1);
+    READ_UE_OR_RETURN(&cpb_size_value_minus1);
+    READ_BOOL_OR_RETURN(&cbr_flag);
+    if (keep) {
+      sps->bit_rate_value_minus1[i] = bit_rate_value_minus1;
+      sps->cpb_size_value_minus1[i] = cpb_size_value_minus1;
+      sps->cbr_flag[i] = cbr_flag;
+    }
   }
-  READ_BITS_OR_RETURN(20, &data);  // cpb/dpb delays, etc.
+  READ_BITS_OR_RETURN(5, &sps->initial_cpb_removal_delay_length_minus_1);
+  READ_BITS_OR_RETURN(5, &sps->cpb_removal_delay_length_minus1);
+  READ_BITS_OR_RETURN(5, &sps->dpb_output_delay_length_minus1);
+  READ_BITS_OR_RETURN(5, &sps->time_offset_length);
 
   return kOk;
 }
@@ -722,31 +821,50 @@ H264Parser::Result H264Parser::ParseVUIParameters(H264SPS* sps) {
     READ_UE_OR_RETURN(&data);  // chroma_sample_loc_type_bottom_field
   }
 
-  // Read and ignore timing info.
-  READ_BOOL_OR_RETURN(&data);  // timing_info_present_flag
-  if (data) {
-    READ_BITS_OR_RETURN(16, &data);  // num_units_in_tick
-    READ_BITS_OR_RETURN(16, &data);  // num_units_in_tick
-    READ_BITS_OR_RETURN(16, &data);  // time_scale
-    READ_BITS_OR_RETURN(16, &data);  // time_scale
-    READ_BOOL_OR_RETURN(&data);  // fixed_frame_rate_flag
+  Result res;
+  READ_BOOL_OR_RETURN(&sps->timing_info_present_flag);
+  if (sps->timing_info_present_flag) {
+    uint32_t value;
+    res = ReadLongBits(32, &value);
+    if (res != kOk)
+      return res;
+    sps->num_units_in_tick = value;
+    res = ReadLongBits(32, &value);
+    if (res != kOk)
+      return res;
+    sps->time_scale = value;
+    READ_BOOL_OR_RETURN(&sps->fixed_frame_rate_flag);
   }
 
-  // Read and ignore NAL HRD parameters, if present.
-  bool hrd_parameters_present = false;
-  Result res = ParseAndIgnoreHRDParameters(&hrd_parameters_present);
-  if (res != kOk)
-    return res;
+  // Defaults for when there are no HRD parameters, see E.2.2.
+  sps->initial_cpb_removal_delay_length_minus_1 =
+      H264SPS::kDefaultInitialCPBRemovalDelayLength - 1;
+  sps->cpb_removal_delay_length_minus1 =
+      H264SPS::kDefaultInitialCPBRemovalDelayLength - 1;
+  sps->dpb_output_delay_length_minus1 =
+      H264SPS::kDefaultDPBOutputDelayLength - 1;
+  sps->time_offset_length = H264SPS::kDefaultTimeOffsetLength;
+
+  READ_BOOL_OR_RETURN(&sps->nal_hrd_parameters_present_flag);
+  if (sps->nal_hrd_parameters_present_flag) {
+    res = ParseHRDParameters(sps, false);
+    if (res != kOk)
+      return res;
+  }
 
-  // Read and ignore VCL HRD parameters, if present.
-  res = ParseAndIgnoreHRDParameters(&hrd_parameters_present);
-  if (res != kOk)
-    return res;
+  READ_BOOL_OR_RETURN(&sps->vcl_hrd_parameters_present_flag);
+  if (sps->vcl_hrd_parameters_present_flag) {
+    res = ParseHRDParameters(sps, true);
+    if (res != kOk)
+      return res;
+  }
 
-  if (hrd_parameters_present)  // One of NAL or VCL params present is enough.
-    READ_BOOL_OR_RETURN(&data);  // low_delay_hrd_flag
+  // One of NAL or VCL params present is enough.
+  if (sps->nal_hrd_parameters_present_flag ||
+      sps->vcl_hrd_parameters_present_flag)
+    READ_BOOL_OR_RETURN(&sps->low_delay_hrd_flag);
 
-  READ_BOOL_OR_RETURN(&data);  // pic_struct_present_flag
+  READ_BOOL_OR_RETURN(&sps->pic_struct_present_flag);
   READ_BOOL_OR_RETURN(&sps->bitstream_restriction_flag);
   if (sps->bitstream_restriction_flag) {
     READ_BOOL_OR_RETURN(&data);  // motion_vectors_over_pic_boundaries_flag
@@ -781,7 +899,18 @@ H264Parser::Result H264Parser::ParseSPS(int* sps_id) {
 
   *sps_id = -1;
 
-  std::unique_ptr<H264SPS> sps(new H264SPS());
+  // The same SPS comes with every IDR picture, there's nothing to do if
+  // it's what's stored under its id already.
+  const uint64_t hash = HashNALU();
+  int id;
+  if (PeekSPSId(&id) && IsStoredNALU(hash, sps_hash_[id], sps_nalu_[id])) {
+    *sps_id = id;
+    active_sps_id_ = id;
+    return kOk;
+  }
+
+  H264SPS parsed;
+  H264SPS* sps = &parsed;
 
   READ_BITS_OR_RETURN(8, &sps->profile_idc);
   READ_BOOL_OR_RETURN(&sps->constraint_set0_flag);
@@ -816,15 +945,15 @@ H264Parser::Result H264Parser::ParseSPS(int* sps_id) {
     READ_BOOL_OR_RETURN(&sps->seq_scaling_matrix_present_flag);
 
     if (sps->seq_scaling_matrix_present_flag) {
-      res = ParseSPSScalingLists(sps.get());
+      res = ParseSPSScalingLists(sps);
       if (res != kOk)
         return res;
     } else {
-      FillDefaultSeqScalingLists(sps.get());
+      FillDefaultSeqScalingLists(sps);
     }
   } else {
     sps->chroma_format_idc = 1;
-    FillDefaultSeqScalingLists(sps.get());
+    FillDefaultSeqScalingLists(sps);
   }
 
   if (sps->separate_colour_plane_flag)
@@ -878,15 +1007,23 @@ H264Parser::Result H264Parser::ParseSPS(int* sps_id) {
 
   READ_BOOL_OR_RETURN(&sps->vui_parameters_present_flag);
   if (sps->vui_parameters_present_flag) {
-    res = ParseVUIParameters(sps.get());
+    res = ParseVUIParameters(sps);
     if (res != kOk)
       return res;
   }
 
-  // If an SPS with the same id already exists, replace it.
+  // If an SPS with the same id already exists, replace it. PPSes are
+  // parsed against their SPS so the stored ones have to be parsed again
+  // even if they're sent unchanged.
   *sps_id = sps->seq_parameter_set_id;
-  delete active_SPSes_[*sps_id];
-  active_SPSes_[*sps_id] = sps.release();
+  if (!sps_[*sps_id])
+    sps_[*sps_id].reset(new H264SPS);
+  *sps_[*sps_id] = parsed;
+  sps_hash_[*sps_id] = hash;
+  sps_nalu_[*sps_id].assign(nalu_data_, nalu_data_ + nalu_size_);
+  sps_present_ |= 1u << *sps_id;
+  active_sps_id_ = *sps_id;
+  std::memset(pps_hash_, 0, sizeof(pps_hash_));
 
   return kOk;
 }
@@ -898,19 +1035,27 @@ H264Parser::Result H264Parser::ParsePPS(int* pps_id) {
 
   *pps_id = -1;
 
-  std::unique_ptr<H264PPS> pps(new H264PPS());
+  // Re-sent with every IDR picture like the SPS.
+  const uint64_t hash = HashNALU();
+  int id;
+  if (PeekPPSId(&id) && IsStoredNALU(hash, pps_hash_[id], pps_nalu_[id])) {
+    *pps_id = id;
+    return kOk;
+  }
+
+  H264PPS parsed;
+  H264PPS* pps = &parsed;
 
   READ_UE_OR_RETURN(&pps->pic_parameter_set_id);
+  TRUE_OR_RETURN(pps->pic_parameter_set_id < kMaxPPSs);
   READ_UE_OR_RETURN(&pps->seq_parameter_set_id);
-  TRUE_OR_RETURN(pps->seq_parameter_set_id < 32);
+  TRUE_OR_RETURN(pps->seq_parameter_set_id < kMaxSPSs);
 
-  if (active_SPSes_.find(pps->seq_parameter_set_id) == active_SPSes_.end()) {
+  sps = GetSPS(pps->seq_parameter_set_id);
+  if (!sps) {
     return kInvalidStream;
   }
 
-  sps = GetSPS(pps->seq_parameter_set_id);
-  TRUE_OR_RETURN(sps);
-
   READ_BOOL_OR_RETURN(&pps->entropy_coding_mode_flag);
   READ_BOOL_OR_RETURN(&pps->bottom_field_pic_order_in_frame_present_flag);
 
@@ -948,7 +1093,7 @@ H264Parser::Result H264Parser::ParsePPS(int* pps_id) {
     READ_BOOL_OR_RETURN(&pps->pic_scaling_matrix_present_flag);
 
     if (pps->pic_scaling_matrix_present_flag) {
-      res = ParsePPSScalingLists(*sps, pps.get());
+      res = ParsePPSScalingLists(*sps, pps);
       if (res != kOk)
         return res;
     }
@@ -958,8 +1103,12 @@ H264Parser::Result H264Parser::ParsePPS(int* pps_id) {
 
   // If a PPS with the same id already exists, replace it.
   *pps_id = pps->pic_parameter_set_id;
-  delete active_PPSes_[*pps_id];
-  active_PPSes_[*pps_id] = pps.release();
+  if (!pps_[*pps_id])
+    pps_[*pps_id].reset(new H264PPS);
+  *pps_[*pps_id] = parsed;
+  pps_hash_[*pps_id] = hash;
+  pps_nalu_[*pps_id].assign(nalu_data_, nalu_data_ + nalu_size_);
+  pps_present_[*pps_id / 64] |= 1ull << (*pps_id % 64);
 
   return kOk;
 }
@@ -1181,6 +1330,7 @@ H264Parser::Result H264Parser::ParseSliceHeader(const H264NALU& nalu,
 
   sps = GetSPS(pps->seq_parameter_set_id);
   TRUE_OR_RETURN(sps);
+  active_sps_id_ = pps->seq_parameter_set_id;
 
   if (sps->separate_colour_plane_flag) {
     return kUnsupportedStream;
@@ -1305,11 +1455,152 @@ H264Parser::Result H264Parser::ParseSliceHeader(const H264NALU& nalu,
   return kOk;
 }
 
+H264Parser::Result H264Parser::ParseBufferingPeriod(
+    H264SEIBufferingPeriod* buffering_period) {
+  // See D.1.2.
+  READ_UE_OR_RETURN(&buffering_period->seq_parameter_set_id);
+  IN_RANGE_OR_RETURN(buffering_period->seq_parameter_set_id, 0, kMaxSPSs - 1);
+  // The delays are sized by the SPS, without it they can't be read and are
+  // left for ParseSEI() to skip, like pic_timing.
+  const H264SPS* sps = GetSPS(buffering_period->seq_parameter_set_id);
+  if (!sps)
+    return kOk;
+  active_sps_id_ = buffering_period->seq_parameter_set_id;
+
+  const int length = sps->initial_cpb_removal_delay_length_minus_1 + 1;
+  Result res;
+  if (sps->nal_hrd_parameters_present_flag) {
+    for (int i = 0; i <= sps->cpb_cnt_minus1; ++i) {
+      res = ReadLongBits(
+          length, &buffering_period->nal_initial_cpb_removal_delay[i]);
+      if (res != kOk)
+        return res;
+      res = ReadLongBits(
+          length, &buffering_period->nal_initial_cpb_removal_delay_offset[i]);
+      if (res != kOk)
+        return res;
+    }
+  }
+  if (sps->vcl_hrd_parameters_present_flag) {
+    for (int i = 0; i <= sps->vcl_cpb_cnt_minus1; ++i) {
+      res = ReadLongBits(
+          length, &buffering_period->vcl_initial_cpb_removal_delay[i]);
+      if (res != kOk)
+        return res;
+      res = ReadLongBits(
+          length, &buffering_period->vcl_initial_cpb_removal_delay_offset[i]);
+      if (res != kOk)
+        return res;
+    }
+  }
+
+  return kOk;
+}
+
+H264Parser::Result H264Parser::ParsePicTiming(const H264SPS& sps,
+                                              H264SEIPicTiming* pic_timing) {
+  // See D.1.3.
+  Result res;
+  pic_timing->cpb_dpb_delays_present_flag =
+      sps.nal_hrd_parameters_present_flag ||
+      sps.vcl_hrd_parameters_present_flag;
+  if (pic_timing->cpb_dpb_delays_present_flag) {
+    res = ReadLongBits(sps.cpb_removal_delay_length_minus1 + 1,
+                       &pic_timing->cpb_removal_delay);
+    if (res != kOk)
+      return res;
+    res = ReadLongBits(sps.dpb_output_delay_length_minus1 + 1,
+                       &pic_timing->dpb_output_delay);
+    if (res != kOk)
+      return res;
+  }
+
+  pic_timing->pic_struct_present_flag = sps.pic_struct_present_flag;
+  if (!pic_timing->pic_struct_present_flag)
+    return kOk;
+
+  // Table D-1.
+  static const int kNumClockTS[] = {1, 1, 1, 2, 2, 3, 3, 2, 3};
+  READ_BITS_OR_RETURN(4, &pic_timing->pic_struct);
+  IN_RANGE_OR_RETURN(pic_timing->pic_struct, 0,
+                     static_cast<int>(arraysize(kNumClockTS)) - 1);
+  pic_timing->num_clock_ts = kNumClockTS[pic_timing->pic_struct];
+
+  for (int i = 0; i < pic_timing->num_clock_ts; ++i) {
+    H264SEIClockTimestamp* ts = &pic_timing->clock_timestamps[i];
+    READ_BOOL_OR_RETURN(&ts->clock_timestamp_flag);
+    if (!ts->clock_timestamp_flag)
+      continue;
+
+    READ_BITS_OR_RETURN(2, &ts->ct_type);
+    READ_BOOL_OR_RETURN(&ts->nuit_field_based_flag);
+    READ_BITS_OR_RETURN(5, &ts->counting_type);
+    READ_BOOL_OR_RETURN(&ts->full_timestamp_flag);
+    READ_BOOL_OR_RETURN(&ts->discontinuity_flag);
+    READ_BOOL_OR_RETURN(&ts->cnt_dropped_flag);
+    READ_BITS_OR_RETURN(8, &ts->n_frames);
+    if (ts->full_timestamp_flag) {
+      READ_BITS_OR_RETURN(6, &ts->seconds_value);
+      READ_BITS_OR_RETURN(6, &ts->minutes_value);
+      READ_BITS_OR_RETURN(5, &ts->hours_value);
+    } else {
+      bool flag;
+      READ_BOOL_OR_RETURN(&flag);  // seconds_flag
+      if (flag) {
+        READ_BITS_OR_RETURN(6, &ts->seconds_value);
+        READ_BOOL_OR_RETURN(&flag);  // minutes_flag
+        if (flag) {
+          READ_BITS_OR_RETURN(6, &ts->minutes_value);
+          READ_BOOL_OR_RETURN(&flag);  // hours_flag
+          if (flag)
+            READ_BITS_OR_RETURN(5, &ts->hours_value);
+        }
+      }
+    }
+    IN_RANGE_OR_RETURN(ts->seconds_value, 0, 59);
+    IN_RANGE_OR_RETURN(ts->minutes_value, 0, 59);
+    IN_RANGE_OR_RETURN(ts->hours_value, 0, 23);
+
+    if (sps.time_offset_length > 0) {
+      uint32_t time_offset;
+      res = ReadLongBits(sps.time_offset_length, &time_offset);
+      if (res != kOk)
+        return res;
+      // Signed, in time_offset_length bits.
+      const int shift = 32 - sps.time_offset_length;
+      ts->time_offset = static_cast<int32_t>(time_offset << shift) >> shift;
+    }
+  }
+
+  return kOk;
+}
+
+H264Parser::Result H264Parser::ParseUserDataUnregistered(
+    int payload_size,
+    H264SEIUserDataUnregistered* user_data_unregistered) {
+  // See D.1.7.
+  TRUE_OR_RETURN(payload_size >= 16);
+  for (int i = 0; i < 16; ++i)
+    READ_BITS_OR_RETURN(8, &user_data_unregistered->uuid_iso_iec_11578[i]);
+
+  user_data_unregistered->payload_size = payload_size - 16;
+  const int size = std::min<int>(user_data_unregistered->payload_size,
+                                 H264SEIUserDataUnregistered::kMaxPayloadSize);
+  for (int i = 0; i < size; ++i)
+    READ_BITS_OR_RETURN(8, &user_data_unregistered->payload[i]);
+
+  return kOk;
+}
+
 H264Parser::Result H264Parser::ParseSEI(H264SEIMessage* sei_msg) {
   int byte;
 
   std::memset(sei_msg, 0, sizeof(*sei_msg));
 
+  // The rest is rbsp_trailing_bits() once the messages are done.
+  if (!br_.HasMoreRBSPData())
+    return kEOStream;
+
   READ_BITS_OR_RETURN(8, &byte);
   while (byte == 0xff) {
     sei_msg->type += 255;
@@ -1324,7 +1615,30 @@ H264Parser::Result H264Parser::ParseSEI(H264SEIMessage* sei_msg) {
   }
   sei_msg->payload_size += byte;
 
+  // Where the payload starts, in bits of the RBSP, so that whatever isn't
+  // decoded below can be skipped to get to the next message.
+  const off_t payload_bits_left = br_.NumBitsLeft();
+  const size_t payload_emulation_prevention_bytes =
+      br_.NumEmulationPreventionBytesRead();
+
+  Result res = kOk;
   switch (sei_msg->type) {
+    case H264SEIMessage::kSEIBufferingPeriod:
+      res = ParseBufferingPeriod(&sei_msg->buffering_period);
+      break;
+
+    case H264SEIMessage::kSEIPicTiming: {
+      const H264SPS* sps = GetSPS(active_sps_id_);
+      if (sps)
+        res = ParsePicTiming(*sps, &sei_msg->pic_timing);
+      break;
+    }
+
+    case H264SEIMessage::kSEIUserDataUnregistered:
+      res = ParseUserDataUnregistered(sei_msg->payload_size,
+                                      &sei_msg->user_data_unregistered);
+      break;
+
     case H264SEIMessage::kSEIRecoveryPoint:
       READ_UE_OR_RETURN(&sei_msg->recovery_point.recovery_frame_cnt);
       READ_BOOL_OR_RETURN(&sei_msg->recovery_point.exact_match_flag);
@@ -1335,6 +1649,20 @@ H264Parser::Result H264Parser::ParseSEI(H264SEIMessage* sei_msg) {
     default:
       break;
   }
+  if (res != kOk)
+    return res;
+
+  const off_t bits_read =
+      payload_bits_left - br_.NumBitsLeft() -
+      8 * static_cast<off_t>(br_.NumEmulationPreventionBytesRead() -
+                             payload_emulation_prevention_bytes);
+  off_t bits_to_skip = 8 * static_cast<off_t>(sei_msg->payload_size) - bits_read;
+  TRUE_OR_RETURN(bits_to_skip >= 0);
+  while (bits_to_skip > 0) {
+    const int bits = static_cast<int>(std::min<off_t>(bits_to_skip, 31));
+    READ_BITS_OR_RETURN(bits, &byte);
+    bits_to_skip -= bits;
+  }
 
   return kOk;
 }
@@ -35,7 +35,7 @@
 #include <stdint.h>
 #include <sys/types.h>
 
-#include <map>
+#include <memory>
 #include <vector>
 
 #include "ranges.h"
@@ -89,6 +89,15 @@ struct H264NALU {
   int nal_unit_type;
 };
 
+// Where a NALU is in a buffer indexed by H264Parser::IndexNALUs().
+struct H264NALUEntry {
+  off_t offset;  // Of the NALU header byte, after the start code.
+  off_t size;    // Same as H264NALU::size.
+  int start_code_size;
+  int nal_ref_idc;
+  int nal_unit_type;
+};
+
 enum {
   kH264ScalingList4x4Length = 16,
   kH264ScalingList8x8Length = 64,
@@ -177,9 +186,12 @@ struct H264SPS {
   int time_scale;
   bool fixed_frame_rate_flag;
 
-  // TODO(posciak): actually parse these instead of ParseAndIgnoreHRDParameters.
+  // The CPB specifications are from the NAL HRD if there is one, from the
+  // VCL HRD otherwise. The delay lengths are the same for both.
   bool nal_hrd_parameters_present_flag;
+  bool vcl_hrd_parameters_present_flag;
   int cpb_cnt_minus1;
+  int vcl_cpb_cnt_minus1;
   int bit_rate_scale;
   int cpb_size_scale;
   int bit_rate_value_minus1[32];
@@ -191,6 +203,7 @@ struct H264SPS {
   int time_offset_length;
 
   bool low_delay_hrd_flag;
+  bool pic_struct_present_flag;
 
   int chroma_array_type;
 };
@@ -330,6 +343,66 @@ struct H264SliceHeader {
   size_t pic_order_cnt_bit_size;
 };
 
+struct H264SEIBufferingPeriod {
+  int seq_parameter_set_id;
+  // Indexed by SchedSelIdx, up to the cpb_cnt_minus1 of the respective HRD
+  // in the SPS.
+  uint32_t nal_initial_cpb_removal_delay[32];
+  uint32_t nal_initial_cpb_removal_delay_offset[32];
+  uint32_t vcl_initial_cpb_removal_delay[32];
+  uint32_t vcl_initial_cpb_removal_delay_offset[32];
+};
+
+struct H264SEIClockTimestamp {
+  bool clock_timestamp_flag;
+  int ct_type;
+  bool nuit_field_based_flag;
+  int counting_type;
+  bool full_timestamp_flag;
+  bool discontinuity_flag;
+  bool cnt_dropped_flag;
+  int n_frames;
+  int seconds_value;
+  int minutes_value;
+  int hours_value;
+  int time_offset;
+};
+
+struct H264SEIPicTiming {
+  enum PicStruct {
+    kFrame = 0,
+    kTopField = 1,
+    kBottomField = 2,
+    kTopFieldBottomField = 3,
+    kBottomFieldTopField = 4,
+    kTopFieldBottomFieldTopField = 5,
+    kBottomFieldTopFieldBottomField = 6,
+    kFrameDoubling = 7,
+    kFrameTripling = 8,
+  };
+
+  // Only present if the SPS has HRD parameters.
+  bool cpb_dpb_delays_present_flag;
+  uint32_t cpb_removal_delay;
+  uint32_t dpb_output_delay;
+
+  // Only present if the SPS says so, the clock timestamps with it.
+  bool pic_struct_present_flag;
+  int pic_struct;
+  int num_clock_ts;  // From pic_struct, see Table D-1.
+  H264SEIClockTimestamp clock_timestamps[3];
+};
+
+struct H264SEIUserDataUnregistered {
+  enum { kMaxPayloadSize = 256 };
+
+  uint8_t uuid_iso_iec_11578[16];
+  // Size of the data after the UUID. Only the first kMaxPayloadSize bytes
+  // of it are kept in |payload|.
+  int payload_size;
+  uint8_t payload[kMaxPayloadSize];
+};
+
 struct H264SEIRecoveryPoint {
   int recovery_frame_cnt;
   bool exact_match_flag;
@@ -341,14 +414,18 @@ struct H264SEIMessage {
   H264SEIMessage();
 
   enum Type {
+    kSEIBufferingPeriod = 0,
+    kSEIPicTiming = 1,
+    kSEIUserDataUnregistered = 5,
     kSEIRecoveryPoint = 6,
   };
 
   int type;
   int payload_size;
   union {
-    // Placeholder; in future more supported types will contribute to more
-    // union members here.
+    H264SEIBufferingPeriod buffering_period;
+    H264SEIPicTiming pic_timing;
+    H264SEIUserDataUnregistered user_data_unregistered;
     H264SEIRecoveryPoint recovery_point;
   };
 };
@@ -388,6 +465,20 @@ class H264Parser {
                                          const Ranges<const uint8_t*>& ranges,
                                          off_t* offset,
                                          off_t* start_code_size);
+  // Scan |stream| once for all the NALUs in it, storing where each one is
+  // and its header fields in |entries|, at most |max_entries| of them, and
+  // their number in |*num_entries|. Boundaries are the same as
+  // AdvanceToNextNALU() finds.
+  // Returns kOk when the whole stream was indexed, kUnsupportedStream when
+  // there were more NALUs than fit and kInvalidStream when a NALU header has
+  // the forbidden bit set; the entries before that point are stored either
+  // way.
+  static Result IndexNALUs(const uint8_t* stream,
+                           off_t stream_size,
+                           H264NALUEntry* entries,
+                           size_t max_entries,
+                           size_t* num_entries);
+
   H264Parser();
   ~H264Parser();
 
@@ -409,6 +500,13 @@ class H264Parser {
   // again, instead of any NALU-type specific parse functions below.
   Result AdvanceToNextNALU(H264NALU* nalu);
 
+  // Like AdvanceToNextNALU() for a NALU found by IndexNALUs() in |stream|,
+  // without scanning for it again. NALU-specific parsing functions will
+  // parse it. Doesn't change where AdvanceToNextNALU() continues from.
+  Result SetNALU(const uint8_t* stream,
+                 const H264NALUEntry& entry,
+                 H264NALU* nalu);
+
   // NALU-specific parsing functions.
   // These should be called after AdvanceToNextNALU().
 
@@ -441,7 +539,15 @@ class H264Parser {
   Result ParseSliceHeader(const H264NALU& nalu, H264SliceHeader* shdr);
 
   // Parse a SEI message, returning it in |*sei_msg|, provided and managed
-  // by the caller.
+  // by the caller. A SEI NALU can hold several messages, call this until it
+  // returns kEOStream to get all of them. Only the types in
+  // H264SEIMessage::Type are decoded, the others just have their type and
+  // size set. pic_timing depends on the SPS in use, which is taken to be
+  // the one last parsed or referred to by a slice header or
+  // buffering_period. Without one it is left undecoded as well, and so is
+  // a buffering_period naming an SPS that hasn't been parsed, apart from
+  // its seq_parameter_set_id. Either way the message is skipped and the
+  // next one can be parsed.
   Result ParseSEI(H264SEIMessage* sei_msg);
 
  private:
@@ -461,15 +567,38 @@ class H264Parser {
   // Read one signed exp-Golomb code from the stream and return in |*val|.
   Result ReadSE(int* val);
 
+  // Hash of the current NALU for telling parameter sets apart.
+  uint64_t HashNALU() const;
+
+  // Whether the current NALU, with hash |hash|, is the one a slot was
+  // parsed from.
+  bool IsStoredNALU(uint64_t hash,
+                    uint64_t stored_hash,
+                    const std::vector<uint8_t>& stored) const;
+
+  // Read the id of the SPS/PPS in the current NALU without moving on.
+  bool PeekSPSId(int* sps_id) const;
+  bool PeekPPSId(int* pps_id) const;
+
   // Parse scaling lists (see spec).
   Result ParseScalingList(int size, int* scaling_list, bool* use_default);
   Result ParseSPSScalingLists(H264SPS* sps);
   Result ParsePPSScalingLists(const H264SPS& sps, H264PPS* pps);
 
+  // Read |num_bits| of up to 32 into |*out|.
+  Result ReadLongBits(int num_bits, uint32_t* out);
+
   // Parse optional VUI parameters in SPS (see spec).
   Result ParseVUIParameters(H264SPS* sps);
-  // Set |hrd_parameters_present| to true only if they are present.
-  Result ParseAndIgnoreHRDParameters(bool* hrd_parameters_present);
+  // Parse the NAL or VCL HRD parameters into |*sps|.
+  Result ParseHRDParameters(H264SPS* sps, bool vcl);
+
+  // Parse SEI payloads (see spec).
+  Result ParseBufferingPeriod(H264SEIBufferingPeriod* buffering_period);
+  Result ParsePicTiming(const H264SPS& sps, H264SEIPicTiming* pic_timing);
+  Result ParseUserDataUnregistered(
+      int payload_size,
+      H264SEIUserDataUnregistered* user_data_unregistered);
 
   // Parse reference picture lists' modifications (see spec).
   Result ParseRefPicListModifications(H264SliceHeader* shdr);
@@ -497,11 +626,33 @@ class H264Parser {
 
   H264BitReader br_;
 
-  // PPSes and SPSes stored for future reference.
-  typedef std::map<int, H264SPS*> SPSById;
-  typedef std::map<int, H264PPS*> PPSById;
-  SPSById active_SPSes_;
-  PPSById active_PPSes_;
+  // The NALU the bit reader was last set to, parameter sets are hashed
+  // from it.
+  const uint8_t* nalu_data_;
+  off_t nalu_size_;
+
+  // PPSes and SPSes stored for future reference, indexed by id. A set bit
+  // in |sps_present_|/|pps_present_| marks a slot in use. Each slot also
+  // keeps the NALU it was parsed from and its hash, 0 if unknown, so that
+  // an unchanged re-send can be skipped without parsing it again. Slots
+  // are allocated when first stored, all of them would be over 600kB to
+  // clear for every new parser.
+  enum {
+    kMaxSPSs = 32,
+    kMaxPPSs = 256,
+  };
+  std::unique_ptr<H264SPS> sps_[kMaxSPSs];
+  std::unique_ptr<H264PPS> pps_[kMaxPPSs];
+  uint64_t sps_hash_[kMaxSPSs];
+  uint64_t pps_hash_[kMaxPPSs];
+  std::vector<uint8_t> sps_nalu_[kMaxSPSs];
+  std::vector<uint8_t> pps_nalu_[kMaxPPSs];
+  uint32_t sps_present_;
+  uint64_t pps_present_[kMaxPPSs / 64];
+
+  // The SPS last parsed or referred to, for SEI messages that depend on
+  // it. -1 if there is none.
+  int active_sps_id_;
 
   // Ranges of encrypted bytes in the buffer passed to
   // SetEncryptedStream().
@@ -0,0 +1,143 @@
+#include "h264_start_code.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define H264_SCAN_X86 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define H264_SCAN_NEON 1
+#endif
+
+namespace media {
+
+namespace {
+
+inline bool IsStartCode(const uint8_t* data) {
+  return data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x01;
+}
+
+// Scans from |pos| a word at a time. A start code can only begin on a zero
+// byte so words without one are skipped whole; the rest are checked byte by
+// byte. Also finishes off the tails of the vector scans.
+off_t ScanScalar(const uint8_t* data, off_t pos, off_t data_size) {
+  const uint64_t kLow = 0x0101010101010101ull;
+  const uint64_t kHigh = 0x8080808080808080ull;
+
+  // each word covers the start codes beginning in it, which can reach two
+  // bytes past it
+  while (pos + 10 <= data_size) {
+    uint64_t word;
+    memcpy(&word, data + pos, sizeof(word));
+    if ((word - kLow) & ~word & kHigh) {
+      for (int i = 0; i < 8; ++i) {
+        if (IsStartCode(data + pos + i))
+          return pos + i;
+      }
+    }
+    pos += 8;
+  }
+  for (; pos + 3 <= data_size; ++pos) {
+    if (IsStartCode(data + pos))
+      return pos;
+  }
+  return -1;
+}
+
+#if defined(H264_SCAN_X86)
+
+const off_t kAVX2MinSize = 512;
+
+inline int CountTrailingZeros(uint32_t value) {
+  return __builtin_ctz(value);
+}
+
+// For every position i in the block, a[i] | b[i] | (c[i] ^ 1) is zero
+// exactly when data[i..i+2] is 00 00 01, with a, b and c the block loaded
+// at offsets 0, 1 and 2.
+#if defined(__SSE2__)
+off_t ScanSSE2(const uint8_t* data, off_t data_size) {
+  const __m128i one = _mm_set1_epi8(1);
+  const __m128i zero = _mm_setzero_si128();
+  off_t pos = 0;
+  for (; pos + 18 <= data_size; pos += 16) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + 1));
+    const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + 2));
+    const __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_xor_si128(c, one));
+    const uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(any, zero));
+    if (mask)
+      return pos + CountTrailingZeros(mask);
+  }
+  return ScanScalar(data, pos, data_size);
+}
+#endif
+
+__attribute__((target("avx2")))
+off_t ScanAVX2(const uint8_t* data, off_t data_size) {
+  const __m256i one = _mm256_set1_epi8(1);
+  const __m256i zero = _mm256_setzero_si256();
+  off_t pos = 0;
+  for (; pos + 34 <= data_size; pos += 32) {
+    const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+    const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 1));
+    const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + 2));
+    const __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_xor_si256(c, one));
+    const uint32_t mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(any, zero));
+    if (mask)
+      return pos + CountTrailingZeros(mask);
+  }
+  return ScanScalar(data, pos, data_size);
+}
+
+#elif defined(H264_SCAN_NEON)
+
+off_t ScanNEON(const uint8_t* data, off_t data_size) {
+  const uint8x16_t one = vdupq_n_u8(1);
+  off_t pos = 0;
+  for (; pos + 18 <= data_size; pos += 16) {
+    const uint8x16_t a = vld1q_u8(data + pos);
+    const uint8x16_t b = vld1q_u8(data + pos + 1);
+    const uint8x16_t c = vld1q_u8(data + pos + 2);
+    const uint8x16_t any = vorrq_u8(vorrq_u8(a, b), veorq_u8(c, one));
+    const uint8x16_t match = vceqq_u8(any, vdupq_n_u8(0));
+    // there's no movemask, narrowing by four gives a nibble per byte
+    const uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(match), 4)), 0);
+    if (mask)
+      return pos + (__builtin_ctzll(mask) >> 2);
+  }
+  return ScanScalar(data, pos, data_size);
+}
+
+#endif
+
+#if defined(H264_SCAN_X86)
+bool HasAVX2() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+}
+#endif
+
+}  // namespace
+
+off_t ScanForStartCode(const uint8_t* data, off_t data_size) {
+  if (data_size < 3)
+    return -1;
+#if defined(H264_SCAN_X86)
+  // the wider loads only pay off on longer runs, short ones are quicker
+  // without the switch to 256 bit registers
+  static const bool avx2 = HasAVX2();
+  if (avx2 && data_size >= kAVX2MinSize)
+    return ScanAVX2(data, data_size);
+#if defined(__SSE2__)
+  return ScanSSE2(data, data_size);
+#endif
+#elif defined(H264_SCAN_NEON)
+  return ScanNEON(data, data_size);
+#endif
+  return ScanScalar(data, 0, data_size);
+}
+
+}  // namespace media
@@ -0,0 +1,20 @@
+// Scanning for Annex B start codes, shared by the parser and anything
+// else that needs to split a byte stream into NAL units.
+
+#ifndef MEDIA_H264_START_CODE_H_
+#define MEDIA_H264_START_CODE_H_
+
+#include <stdint.h>
+#include <sys/types.h>
+
+namespace media {
+
+// Returns the offset of the first 00 00 01 sequence that lies entirely
+// within |data|, or -1 if there is none. Uses SSE2/AVX2 or NEON when
+// available and a word at a time scan otherwise; all of them return the
+// same thing as checking every position in turn.
+off_t ScanForStartCode(const uint8_t* data, off_t data_size);
+
+}  // namespace media
+
+#endif  // MEDIA_H264_START_CODE_H_
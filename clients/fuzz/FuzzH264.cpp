@@ -0,0 +1,20 @@
+#include "H264Targets.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// built once per target, FUZZ_TARGET is its name
+static H264Targets::Target target()
+{
+    static const int target = H264Targets::find(FUZZ_TARGET);
+    if (target < 0) {
+        fprintf(stderr, "no fuzz target %s\n", FUZZ_TARGET);
+        abort();
+    }
+    return static_cast<H264Targets::Target>(target);
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    H264Targets::run(target(), data, size);
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include "H264Targets.h"
+#include <string.h>
+#include "h264_parser.h"
+
+namespace H264Targets {
+
+// the parameter sets of the synthetic stream in bench/data
+static const uint8_t sParameterSets[] = {
+    0x00, 0x00, 0x00, 0x01, 0x67, 0x64, 0x00, 0x2a, 0xac, 0xda, 0x01, 0xe0, 0x08, 0x9f, 0x97, 0x01,
+    0x6a, 0x02, 0x02, 0x02, 0x80, 0x00, 0x00, 0x03, 0x00, 0x80, 0x00, 0x00, 0x3c, 0x46, 0xd0, 0x44,
+    0x23, 0x50,
+    0x00, 0x00, 0x00, 0x01, 0x68, 0xee, 0x3c, 0xb0
+};
+
+static const char* const sNames[NumTargets] = { "nalu", "sps", "pps", "slice", "sei", "stream" };
+
+const char* name(Target target)
+{
+    return sNames[target];
+}
+
+int find(const char* name)
+{
+    for (int i = 0; i < NumTargets; ++i) {
+        if (!strcmp(sNames[i], name))
+            return i;
+    }
+    return -1;
+}
+
+static void seed(media::H264Parser& parser)
+{
+    parser.SetStream(sParameterSets, sizeof(sParameterSets));
+    media::H264NALU nalu;
+    int id;
+    while (parser.AdvanceToNextNALU(&nalu) == media::H264Parser::kOk) {
+        if (nalu.nal_unit_type == media::H264NALU::kSPS)
+            parser.ParseSPS(&id);
+        else if (nalu.nal_unit_type == media::H264NALU::kPPS)
+            parser.ParsePPS(&id);
+    }
+}
+
+void run(Target target, const uint8_t* data, size_t size)
+{
+    media::H264Parser parser;
+    if (target == PPS || target == SliceHeader || target == SEI)
+        seed(parser);
+
+    parser.SetStream(data, size);
+    for (;;) {
+        media::H264NALU nalu;
+        if (parser.AdvanceToNextNALU(&nalu) != media::H264Parser::kOk)
+            break;
+        int id;
+        switch (nalu.nal_unit_type) {
+        case media::H264NALU::kSPS:
+            if (target == SPS || target == Stream)
+                parser.ParseSPS(&id);
+            break;
+        case media::H264NALU::kPPS:
+            if (target == PPS || target == Stream)
+                parser.ParsePPS(&id);
+            break;
+        case media::H264NALU::kIDRSlice:
+        case media::H264NALU::kNonIDRSlice:
+            if (target == SliceHeader || target == Stream) {
+                media::H264SliceHeader shdr;
+                parser.ParseSliceHeader(nalu, &shdr);
+            }
+            break;
+        case media::H264NALU::kSEIMessage:
+            if (target == SEI || target == Stream) {
+                media::H264SEIMessage sei;
+                while (parser.ParseSEI(&sei) == media::H264Parser::kOk) {
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+} // namespace H264Targets
@@ -0,0 +1,35 @@
+#ifndef H264TARGETS_H
+#define H264TARGETS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The parts of the H.264 parser that see bytes straight off the network,
+// each fed an Annex B stream. The libFuzzer targets and the corpus
+// benchmark both go through here so a faster bit reader or start code
+// search gets checked on the same inputs it's timed on.
+namespace H264Targets {
+
+enum Target {
+    // only the NALU boundaries, AdvanceToNextNALU
+    NALU,
+    // only NALUs of the one type are parsed. PPS, slice header and SEI
+    // parsing start out with a 1080p High profile SPS and PPS to refer to
+    SPS,
+    PPS,
+    SliceHeader,
+    SEI,
+    // everything, with whatever parameter sets the stream brings
+    Stream,
+    NumTargets
+};
+
+const char* name(Target target);
+// -1 if there's no target by that name
+int find(const char* name);
+
+void run(Target target, const uint8_t* data, size_t size);
+
+} // namespace H264Targets
+
+#endif
@@ -0,0 +1,199 @@
+#include "Processor.h"
+#include "Log.h"
+#include "CaptureTime.h"
+
+enum {
+    DemuxQueueSize = 256,
+    AudioQueueSize = 64,
+    VideoQueueSize = 32,
+    MaxNALUs = 64
+};
+
+Processor::Processor(const Options& options)
+    : mOptions(options), mDemuxer(options.demuxer), mSynced(false), mH264Pid(0), mAACPid(0),
+      mBytes(0), mBuffers(0), mAudioPackets(0), mVideoPackets(0), mAudioFrames(0), mAudioSamples(0),
+      mVideoFrames(0), mKeyFrames(0), mNalus(0), mParseErrors(0), mRandomAccessPoints(0), mSkippedUnits(0),
+      mDemuxStage("demux", DemuxQueueSize, [this](Buffer&& buffer) {
+              mDemuxer.feed(std::move(buffer));
+          }),
+      mAudioStage("audio", AudioQueueSize, [this](Packet&& pkt) {
+              mAAC.decode(pkt.data(), pkt.size(), pkt.pts());
+          }),
+      mVideoStage("video", VideoQueueSize, [this](Packet&& pkt) {
+              handleVideo(pkt);
+          })
+{
+    // a demuxer that can't keep up would otherwise block the socket thread
+    // with an ever growing backlog in the queue, over the mark the oldest
+    // buffers go instead
+    if (options.demuxer.highWaterMark > 0) {
+        mDemuxStage.setHighWaterMark(options.demuxer.highWaterMark,
+            [](const Buffer& buffer) { return buffer.size(); },
+            [this](size_t buffers, size_t bytes) { mDemuxer.dropped(buffers, bytes); });
+    }
+
+    // the pid filter only comes on once a stream is switched off. adding
+    // the wanted ones as they show up would drop the other stream before
+    // its first PES got through to tell us what it is
+    mDemuxer.info().connect([this](uint16_t pid, TSDemux::STREAM_TYPE type, const TSDemux::STREAM_INFO& info) {
+            Log::stdout("stream % on pid %", TSDemux::ElementaryStream::GetStreamCodecName(type), pid);
+            if (type == TSDemux::STREAM_TYPE_VIDEO_H264) {
+                Log::stdout(" %x% fps %/%\n", info.width, info.height, info.fps_rate, info.fps_scale);
+                mH264Pid = pid;
+                if (!mOptions.video)
+                    mDemuxer.removePid(pid);
+            } else if (type == TSDemux::STREAM_TYPE_AUDIO_AAC_ADTS) {
+                Log::stdout(" % channels at % Hz\n", info.channels, info.sample_rate);
+                mAACPid = pid;
+                if (!mOptions.audio)
+                    mDemuxer.removePid(pid);
+            } else {
+                Log::stdout("\n");
+            }
+        });
+    mDemuxer.pkt().connect([this](const Packet& pkt) {
+            if (pkt.pid() == mH264Pid) {
+                if (mOptions.video) {
+                    ++mVideoPackets;
+                    mVideoStage.push(Packet(pkt));
+                }
+            } else if (pkt.pid() == mAACPid) {
+                if (mOptions.audio) {
+                    ++mAudioPackets;
+                    mAudioStage.push(Packet(pkt));
+                }
+            }
+        });
+    mAAC.samples().connect([this](const void*, size_t count, size_t, uint64_t) {
+            ++mAudioFrames;
+            mAudioSamples += count;
+        });
+    mAAC.info().connect([](int rate, int channels, uint64_t) {
+            Log::stdout("aac decoder % channels at % Hz\n", channels, rate);
+        });
+}
+
+Processor::~Processor()
+{
+    stop();
+}
+
+void Processor::start()
+{
+    mDemuxStage.start();
+    mAudioStage.start();
+    mVideoStage.start();
+}
+
+void Processor::stop()
+{
+    // in pipeline order so each stage has seen everything from the
+    // previous one before it drains
+    mDemuxStage.stop();
+    mAudioStage.stop();
+    mVideoStage.stop();
+}
+
+void Processor::push(Buffer&& buffer)
+{
+    mBytes += buffer.size();
+    ++mBuffers;
+    mDemuxStage.push(std::move(buffer));
+}
+
+void Processor::handleVideo(const Packet& pkt)
+{
+    media::H264NALUEntry nalus[MaxNALUs];
+    size_t count;
+    if (media::H264Parser::IndexNALUs(pkt.data(), pkt.size(), nalus, MaxNALUs, &count) != media::H264Parser::kOk)
+        ++mParseErrors;
+    mNalus += count;
+
+    // joining mid-stream, nothing before the first IDR or recovery point
+    // can be parsed past the headers
+    if (mRandomAccess.update(pkt.data(), nalus, count, pkt.pts()) != RandomAccess::None) {
+        ++mRandomAccessPoints;
+        mSynced = true;
+    } else if (!mSynced) {
+        ++mSkippedUnits;
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        media::H264NALU nalu;
+        media::H264Parser::Result result;
+        int id;
+        switch (nalus[i].nal_unit_type) {
+        case media::H264NALU::kSPS:
+            result = mParser.SetNALU(pkt.data(), nalus[i], &nalu);
+            if (result == media::H264Parser::kOk)
+                result = mParser.ParseSPS(&id);
+            break;
+        case media::H264NALU::kPPS:
+            result = mParser.SetNALU(pkt.data(), nalus[i], &nalu);
+            if (result == media::H264Parser::kOk)
+                result = mParser.ParsePPS(&id);
+            break;
+        case media::H264NALU::kIDRSlice:
+        case media::H264NALU::kNonIDRSlice: {
+            media::H264SliceHeader shdr;
+            result = mParser.SetNALU(pkt.data(), nalus[i], &nalu);
+            if (result == media::H264Parser::kOk)
+                result = mParser.ParseSliceHeader(nalu, &shdr);
+            if (result == media::H264Parser::kOk && shdr.first_mb_in_slice == 0) {
+                ++mVideoFrames;
+                if (shdr.idr_pic_flag)
+                    ++mKeyFrames;
+            }
+            break; }
+        case media::H264NALU::kSEIMessage:
+            result = mParser.SetNALU(pkt.data(), nalus[i], &nalu);
+            while (result == media::H264Parser::kOk) {
+                media::H264SEIMessage sei;
+                result = mParser.ParseSEI(&sei);
+                uint64_t captured;
+                if (result == media::H264Parser::kOk && sei.type == media::H264SEIMessage::kSEIUserDataUnregistered
+                    && CaptureTime::read(sei.user_data_unregistered, &captured)) {
+                    // a clock behind the server's shows up as 0 rather than wrapping
+                    const uint64_t now = CaptureTime::now();
+                    mLatency.record(now > captured ? (now - captured) * 1000 : 0);
+                }
+            }
+            if (result == media::H264Parser::kEOStream)
+                result = media::H264Parser::kOk;
+            break;
+        default:
+            result = media::H264Parser::kOk;
+            break;
+        }
+        if (result != media::H264Parser::kOk)
+            ++mParseErrors;
+    }
+}
+
+Processor::Stats Processor::stats() const
+{
+    Stats stats;
+    stats.bytes = mBytes.load();
+    stats.buffers = mBuffers.load();
+    stats.audioPackets = mAudioPackets.load();
+    stats.videoPackets = mVideoPackets.load();
+    stats.audioFrames = mAudioFrames.load();
+    stats.audioSamples = mAudioSamples.load();
+    stats.videoFrames = mVideoFrames.load();
+    stats.keyFrames = mKeyFrames.load();
+    stats.nalus = mNalus.load();
+    stats.parseErrors = mParseErrors.load();
+    stats.randomAccessPoints = mRandomAccessPoints.load();
+    stats.skippedUnits = mSkippedUnits.load();
+    stats.latencyFrames = mLatency.count();
+    stats.latencyP50 = mLatency.percentile(50);
+    stats.latencyP99 = mLatency.percentile(99);
+    stats.latencyMax = mLatency.max();
+    return stats;
+}
+
+std::vector<StageStats> Processor::stageStats() const
+{
+    return { mDemuxStage.stats(), mAudioStage.stats(), mVideoStage.stats() };
+}
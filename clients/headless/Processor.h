@@ -0,0 +1,99 @@
+#ifndef PROCESSOR_H
+#define PROCESSOR_H
+
+#include <atomic>
+#include <vector>
+#include <rct/Buffer.h>
+#include "Demuxer.h"
+#include "AAC.h"
+#include "Pipeline.h"
+#include "Histogram.h"
+#include "RandomAccess.h"
+#include "h264_parser.h"
+
+// The platform independent part of the client: demuxes whatever is pushed
+// into it, decodes the audio and parses the video down to slice headers,
+// counting as it goes. There is no output, this is what we load-test and
+// measure on machines that can't render.
+class Processor
+{
+public:
+    struct Options
+    {
+        Demuxer::Options demuxer;
+        // skip decoding/parsing of either stream, the pid filter drops
+        // their TS packets before they are demuxed
+        bool audio, video;
+
+        Options() : audio(true), video(true) { }
+    };
+
+    struct Stats
+    {
+        Stats()
+            : bytes(0), buffers(0), audioPackets(0), videoPackets(0), audioFrames(0), audioSamples(0),
+              videoFrames(0), keyFrames(0), nalus(0), parseErrors(0), randomAccessPoints(0), skippedUnits(0),
+              latencyFrames(0), latencyP50(0), latencyP99(0), latencyMax(0)
+        {
+        }
+
+        // what was pushed in
+        uint64_t bytes, buffers;
+        // demuxed PES packets
+        uint64_t audioPackets, videoPackets;
+        // decoded AAC frames and the 16 bit samples they produced
+        uint64_t audioFrames, audioSamples;
+        // pictures, counted on the first slice of each
+        uint64_t videoFrames, keyFrames;
+        uint64_t nalus, parseErrors;
+        // IDR pictures and recovery points, and the access units before
+        // the first of them that had to be thrown away
+        uint64_t randomAccessPoints, skippedUnits;
+        // pictures carrying a capture time and nanoseconds from capture
+        // until their SEI was parsed here, see CaptureTime
+        uint64_t latencyFrames, latencyP50, latencyP99, latencyMax;
+    };
+
+    Processor(const Options& options);
+    ~Processor();
+
+    void start();
+    // finishes everything already pushed before returning
+    void stop();
+
+    // call from one thread only
+    void push(Buffer&& buffer);
+
+    Stats stats() const;
+    std::vector<StageStats> stageStats() const;
+
+    // not synchronized with the demux thread, only call this when stopped
+    const Demuxer::Stats& demuxerStats() const { return mDemuxer.stats(); }
+
+private:
+    void handleVideo(const Packet& pkt);
+
+private:
+    Options mOptions;
+    Demuxer mDemuxer;
+    AAC mAAC;
+    media::H264Parser mParser;
+    RandomAccess mRandomAccess;
+    bool mSynced;
+
+    std::atomic<uint16_t> mH264Pid, mAACPid;
+
+    std::atomic<uint64_t> mBytes, mBuffers;
+    std::atomic<uint64_t> mAudioPackets, mVideoPackets;
+    std::atomic<uint64_t> mAudioFrames, mAudioSamples;
+    std::atomic<uint64_t> mVideoFrames, mKeyFrames, mNalus, mParseErrors;
+    std::atomic<uint64_t> mRandomAccessPoints, mSkippedUnits;
+    Histogram mLatency;
+
+    // these have threads calling into the members above, keep them last
+    // so they go away first
+    PipelineStage<Buffer> mDemuxStage;
+    PipelineStage<Packet> mAudioStage, mVideoStage;
+};
+
+#endif
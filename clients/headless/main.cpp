@@ -0,0 +1,144 @@
+#include <rct/EventLoop.h>
+#include <rct/SocketClient.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <thread>
+#include "Log.h"
+#include "Processor.h"
+#include "Options.h"
+
+static std::atomic<bool> sQuit(false);
+
+static void handleSignal(int)
+{
+    sQuit = true;
+}
+
+static void printStats(const Processor& processor, const Processor::Stats& stats, const Processor::Stats& last, double seconds)
+{
+    std::printf("%.1f MB/s  %.0f buffers/s  %.0f audio frames/s  %.1f video frames/s  (%llu keyframes, %llu parse errors)\n",
+                (stats.bytes - last.bytes) / seconds / (1024. * 1024.),
+                (stats.buffers - last.buffers) / seconds,
+                (stats.audioFrames - last.audioFrames) / seconds,
+                (stats.videoFrames - last.videoFrames) / seconds,
+                static_cast<unsigned long long>(stats.keyFrames),
+                static_cast<unsigned long long>(stats.parseErrors));
+    if (stats.latencyFrames) {
+        std::printf("  capture to client %llu frames  p50 %.3f p99 %.3f max %.3f ms\n",
+                    static_cast<unsigned long long>(stats.latencyFrames),
+                    stats.latencyP50 / 1e6, stats.latencyP99 / 1e6, stats.latencyMax / 1e6);
+    }
+    for (const StageStats& stage : processor.stageStats()) {
+        std::printf("  %-6s depth %zu/%zu max %zu  stalls %llu  dropped %llu  latency p50 %.3f p99 %.3f max %.3f ms  service p50 %.3f p99 %.3f ms\n",
+                    stage.name.c_str(), stage.depth, stage.capacity, stage.maxDepth,
+                    static_cast<unsigned long long>(stage.stalls),
+                    static_cast<unsigned long long>(stage.dropped),
+                    stage.latencyP50 / 1e6, stage.latencyP99 / 1e6, stage.latencyMax / 1e6,
+                    stage.serviceP50 / 1e6, stage.serviceP99 / 1e6);
+    }
+    std::fflush(stdout);
+}
+
+int main(int argc, char** argv)
+{
+    Processor::Options processorOptions;
+
+    const Options options = Options::parse(argc, argv);
+    const auto host = options.get<std::string>("&host");
+    if (!host) {
+        std::printf("Need to pass --host name\n");
+        return 1;
+    }
+    const uint16_t port = options.get<int>("&port", 5198);
+    processorOptions.demuxer.highWaterMark = options.get<int>("high-water-mark", processorOptions.demuxer.highWaterMark);
+    // --no-audio is stored as audio=false
+    processorOptions.audio = options.get<bool>("audio", true);
+    processorOptions.video = options.get<bool>("video", true);
+    // seconds between reports and how long to run, 0 runs until interrupted
+    const int interval = std::max(options.get<int>("&interval", 1), 1);
+    const int duration = options.get<int>("&duration", 0);
+    const bool verbose = options.enabled("&verbose");
+    Log::addSink(
+        [verbose](const std::string& msg) {
+            if (verbose) {
+                std::fprintf(stdout, "%s", msg.c_str());
+            }
+        },
+        [](const std::string& msg) {
+            std::fprintf(stderr, "%s", msg.c_str());
+        });
+
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+
+    Processor processor(processorOptions);
+    processor.start();
+
+    std::shared_ptr<EventLoop> loop;
+    std::atomic<bool> ready(false);
+    std::thread socketThread([&]() {
+            loop = std::make_shared<EventLoop>();
+            loop->init(EventLoop::MainEventLoop);
+
+            auto client = std::make_shared<SocketClient>();
+            client->readyRead().connect([&processor](const SocketClient::SharedPtr&, Buffer&& buffer) {
+                    processor.push(std::move(buffer));
+                });
+            client->connected().connect([](const SocketClient::SharedPtr&) {
+                    Log::stdout("connected\n");
+                });
+            client->disconnected().connect([](const SocketClient::SharedPtr&) {
+                    Log::stderr("disconnected\n");
+                    sQuit = true;
+                });
+            if (!client->connect(*host, port)) {
+                Log::stderr("unable to connect to %:%\n", *host, port);
+                sQuit = true;
+            }
+            ready = true;
+
+            loop->exec();
+        });
+
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point started = Clock::now();
+    Clock::time_point lastReport = started;
+    Processor::Stats last;
+    while (!sQuit.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        const Clock::time_point now = Clock::now();
+        if (now - lastReport >= std::chrono::seconds(interval)) {
+            const Processor::Stats stats = processor.stats();
+            printStats(processor, stats, last, std::chrono::duration<double>(now - lastReport).count());
+            last = stats;
+            lastReport = now;
+        }
+        if (duration > 0 && now - started >= std::chrono::seconds(duration))
+            break;
+    }
+
+    while (!ready.load())
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    loop->quit();
+    socketThread.join();
+    processor.stop();
+
+    const double total = std::chrono::duration<double>(Clock::now() - started).count();
+    std::printf("total over %.1f s:\n", total);
+    const Processor::Stats stats = processor.stats();
+    printStats(processor, stats, Processor::Stats(), total);
+    std::printf("  random access points %llu  skipped %llu access units before the first\n",
+                static_cast<unsigned long long>(stats.randomAccessPoints),
+                static_cast<unsigned long long>(stats.skippedUnits));
+    const Demuxer::Stats& demux = processor.demuxerStats();
+    std::printf("  demuxer reads %llu (%llu stitched)  filtered packets %llu  dropped %llu bytes in %llu buffers\n",
+                static_cast<unsigned long long>(demux.reads),
+                static_cast<unsigned long long>(demux.stitchedReads),
+                static_cast<unsigned long long>(demux.filteredPackets),
+                static_cast<unsigned long long>(demux.droppedBytes),
+                static_cast<unsigned long long>(demux.droppedBuffers));
+    return 0;
+}
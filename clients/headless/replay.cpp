@@ -0,0 +1,252 @@
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Log.h"
+#include "Processor.h"
+#include "Options.h"
+
+// Picks the size of each chunk fed to the processor. The spec is a comma
+// separated list of sizes or inclusive ranges, each with an optional
+// weight, e.g. "65536" or "1316@3,4096-65536@1". A range picks uniformly
+// within itself. The generator is seeded so runs are repeatable.
+class ChunkSizes
+{
+public:
+    ChunkSizes(unsigned int seed) : mRandom(seed), mTotalWeight(0) { }
+
+    bool parse(const std::string& spec);
+    size_t next();
+
+private:
+    struct Entry
+    {
+        size_t min, max;
+        unsigned int weight;
+    };
+
+    std::mt19937 mRandom;
+    std::vector<Entry> mEntries;
+    unsigned int mTotalWeight;
+};
+
+bool ChunkSizes::parse(const std::string& spec)
+{
+    size_t start = 0;
+    while (start <= spec.size()) {
+        size_t end = spec.find(',', start);
+        if (end == std::string::npos)
+            end = spec.size();
+        const std::string item = spec.substr(start, end - start);
+        start = end + 1;
+
+        Entry entry;
+        char* cur;
+        entry.min = entry.max = std::strtoul(item.c_str(), &cur, 10);
+        if (*cur == '-')
+            entry.max = std::strtoul(cur + 1, &cur, 10);
+        entry.weight = 1;
+        if (*cur == '@')
+            entry.weight = std::strtoul(cur + 1, &cur, 10);
+        if (*cur != '\0' || !entry.min || entry.max < entry.min || !entry.weight)
+            return false;
+        mEntries.push_back(entry);
+        mTotalWeight += entry.weight;
+    }
+    return !mEntries.empty();
+}
+
+size_t ChunkSizes::next()
+{
+    const Entry* entry = &mEntries.front();
+    if (mEntries.size() > 1) {
+        unsigned int pick = std::uniform_int_distribution<unsigned int>(0, mTotalWeight - 1)(mRandom);
+        for (const Entry& e : mEntries) {
+            if (pick < e.weight) {
+                entry = &e;
+                break;
+            }
+            pick -= e.weight;
+        }
+    }
+    if (entry->min == entry->max)
+        return entry->min;
+    return std::uniform_int_distribution<size_t>(entry->min, entry->max)(mRandom);
+}
+
+// Where the chunks come from, either read() straight from the file like
+// the socket would or copied out of a mapping of it.
+class Source
+{
+public:
+    Source() : mFd(-1), mMap(0), mSize(0), mOffset(0) { }
+    ~Source();
+
+    bool open(const char* path, bool map);
+    uint64_t size() const { return mSize; }
+    void rewind() { mOffset = 0; lseek(mFd, 0, SEEK_SET); }
+
+    // fills buffer with up to size bytes, false at the end of the file
+    bool read(size_t size, Buffer& buffer);
+
+private:
+    int mFd;
+    const uint8_t* mMap;
+    uint64_t mSize, mOffset;
+};
+
+Source::~Source()
+{
+    if (mMap)
+        munmap(const_cast<uint8_t*>(mMap), mSize);
+    if (mFd != -1)
+        ::close(mFd);
+}
+
+bool Source::open(const char* path, bool map)
+{
+    mFd = ::open(path, O_RDONLY);
+    if (mFd == -1)
+        return false;
+    struct stat st;
+    if (fstat(mFd, &st) == -1)
+        return false;
+    mSize = st.st_size;
+    if (map && mSize) {
+        void* mapped = mmap(0, mSize, PROT_READ, MAP_PRIVATE, mFd, 0);
+        if (mapped == MAP_FAILED)
+            return false;
+        mMap = static_cast<const uint8_t*>(mapped);
+    }
+    return true;
+}
+
+bool Source::read(size_t size, Buffer& buffer)
+{
+    if (mMap) {
+        size = std::min<uint64_t>(size, mSize - mOffset);
+        if (!size)
+            return false;
+        buffer.resize(size);
+        memcpy(buffer.data(), mMap + mOffset, size);
+        mOffset += size;
+        return true;
+    }
+    buffer.resize(size);
+    ssize_t r;
+    do {
+        r = ::read(mFd, buffer.data(), size);
+    } while (r == -1 && errno == EINTR);
+    if (r <= 0)
+        return false;
+    buffer.resize(r);
+    mOffset += r;
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    Processor::Options processorOptions;
+
+    const Options options = Options::parse(argc, argv);
+    auto file = options.get<std::string>("&file");
+    if (!file)
+        file = options.standalones().at<std::string>(0);
+    if (!file) {
+        std::printf("Usage: %s [options] --file file.ts\n"
+                    "  --mmap              map the file instead of reading it\n"
+                    "  --chunks <spec>     chunk sizes, e.g. 65536 or 1316@3,4096-65536 (default 1316-65536)\n"
+                    "  --seed <n>          seed for picking chunk sizes (default 1)\n"
+                    "  --loops <n>         replay the file n times (default 1)\n"
+                    "  --no-audio          don't decode audio\n"
+                    "  --no-video          don't parse video\n"
+                    "  --high-water-mark <n> drop demux input over n bytes instead of waiting (default 0)\n"
+                    "  --verbose           log stream info\n", argv[0]);
+        return 1;
+    }
+    // the file is read faster than it can be demuxed, dropping would make
+    // every run measure something else. back pressure unless asked for
+    processorOptions.demuxer.highWaterMark = options.get<int>("high-water-mark", 0);
+    // --no-audio is stored as audio=false
+    processorOptions.audio = options.get<bool>("audio", true);
+    processorOptions.video = options.get<bool>("video", true);
+    const bool map = options.enabled("mmap");
+    const int loops = std::max(options.get<int>("loops", 1), 1);
+    const bool verbose = options.enabled("&verbose");
+    Log::addSink(
+        [verbose](const std::string& msg) {
+            if (verbose) {
+                std::fprintf(stdout, "%s", msg.c_str());
+            }
+        },
+        [](const std::string& msg) {
+            std::fprintf(stderr, "%s", msg.c_str());
+        });
+
+    ChunkSizes chunks(options.get<int>("seed", 1));
+    const std::string spec = options.get<std::string>("chunks").value_or("1316-65536");
+    if (!chunks.parse(spec)) {
+        std::fprintf(stderr, "invalid chunk spec %s\n", spec.c_str());
+        return 1;
+    }
+
+    Source source;
+    if (!source.open(file->c_str(), map)) {
+        std::fprintf(stderr, "unable to open %s: %s\n", file->c_str(), strerror(errno));
+        return 1;
+    }
+
+    Processor processor(processorOptions);
+    processor.start();
+
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point started = Clock::now();
+    for (int loop = 0; loop < loops; ++loop) {
+        if (loop)
+            source.rewind();
+        for (;;) {
+            Buffer buffer;
+            if (!source.read(chunks.next(), buffer))
+                break;
+            processor.push(std::move(buffer));
+        }
+    }
+    processor.stop();
+    const double seconds = std::chrono::duration<double>(Clock::now() - started).count();
+
+    const Processor::Stats stats = processor.stats();
+    const Demuxer::Stats& demux = processor.demuxerStats();
+    std::printf("%s: %.1f MB in %llu chunks (%s), %.3f s\n", file->c_str(),
+                stats.bytes / (1024. * 1024.), static_cast<unsigned long long>(stats.buffers),
+                map ? "mmap" : "read", seconds);
+    std::printf("  %.1f MB/s  %.0f TS packets/s  %.0f PES packets/s\n",
+                stats.bytes / seconds / (1024. * 1024.), demux.packets / seconds,
+                (stats.audioPackets + stats.videoPackets) / seconds);
+    std::printf("  %.0f audio frames/s (%llu)  %.0f video frames/s (%llu, %llu keyframes)  %llu parse errors\n",
+                stats.audioFrames / seconds, static_cast<unsigned long long>(stats.audioFrames),
+                stats.videoFrames / seconds, static_cast<unsigned long long>(stats.videoFrames),
+                static_cast<unsigned long long>(stats.keyFrames), static_cast<unsigned long long>(stats.parseErrors));
+    std::printf("  random access points %llu  skipped %llu access units before the first\n",
+                static_cast<unsigned long long>(stats.randomAccessPoints),
+                static_cast<unsigned long long>(stats.skippedUnits));
+    std::printf("  demuxer reads %llu (%llu stitched)  filtered packets %llu  dropped %llu bytes\n",
+                static_cast<unsigned long long>(demux.reads), static_cast<unsigned long long>(demux.stitchedReads),
+                static_cast<unsigned long long>(demux.filteredPackets), static_cast<unsigned long long>(demux.droppedBytes));
+    for (const StageStats& stage : processor.stageStats()) {
+        std::printf("  %-6s %9llu items  stalls %llu  latency p50 %.1f p99 %.1f max %.1f us  service p50 %.1f p99 %.1f us\n",
+                    stage.name.c_str(), static_cast<unsigned long long>(stage.processed),
+                    static_cast<unsigned long long>(stage.stalls),
+                    stage.latencyP50 / 1e3, stage.latencyP99 / 1e3, stage.latencyMax / 1e3,
+                    stage.serviceP50 / 1e3, stage.serviceP99 / 1e3);
+    }
+    return 0;
+}
@@ -1,5 +1,18 @@
 #include "Renderer.h"
 #include "Log.h"
+#include "AVCC.h"
+#include "CaptureTime.h"
+
+enum {
+    DemuxQueueSize = 256,
+    AudioQueueSize = 64,
+    VideoQueueSize = 32,
+    // NALUs in one access unit, the HD60 sends a handful of slices per
+    // picture plus AUD/SPS/PPS/SEI
+    MaxNALUs = 64,
+    // pictures between the latency lines in the log, ~10s at 60fps
+    LatencyLogInterval = 600
+};
 
 static inline int stream_identifier(int composition_id, int ancillary_id)
 {
@@ -13,34 +26,71 @@ void Renderer::decoded(void *decompressionOutputRefCon, void *sourceFrameRefCon,
                        CVImageBufferRef imageBuffer, CMTime presentationTimeStamp, CMTime presentationDuration)
 {
     //printf("decoded\n");
-    Renderer* r = static_cast<Renderer*>(sourceFrameRefCon);
+    Renderer* r = static_cast<Renderer*>(decompressionOutputRefCon);
+    r->mDropPolicy.completed();
+    // nothing for failed frames or the ones decoded with DoNotOutputFrame
+    if (!imageBuffer)
+        return;
     r->mImage(ImageBuffer(imageBuffer), presentationTimeStamp, presentationDuration, r->currentPts());
+
+    // the frame refcon is the capture time of the picture, 0 if it had none
+    const uint64_t captured = reinterpret_cast<uintptr_t>(sourceFrameRefCon);
+    if (!captured)
+        return;
+    // a clock behind the server's shows up as 0 rather than wrapping
+    const uint64_t now = CaptureTime::now();
+    r->mLatency.record(now > captured ? (now - captured) * 1000 : 0);
+    if (r->mLatency.count() % LatencyLogInterval == 0) {
+        Log::stdout("glass to glass latency p50 % p99 % max % ms\n",
+                    r->mLatency.percentile(50) / 1e6, r->mLatency.percentile(99) / 1e6, r->mLatency.max() / 1e6);
+    }
 }
 
 Renderer::Renderer(Options opts)
-    : mOptions(opts), mClient(std::make_shared<SocketClient>()), mWidth(-1), mHeight(-1),
-      mDecoder(0), mH264Pid(0), mAACPid(0), mCurrentPts(0)
+    : mOptions(opts), mClient(std::make_shared<SocketClient>()), mDemuxer(opts.demuxer),
+      mSynced(false), mRecoveryFrames(0), mDropPolicy(opts.drop), mWidth(-1), mHeight(-1), mVideoFormat(0), mDecoder(0), mH264Pid(0), mAACPid(0), mCurrentPts(0),
+      mDemuxStage("demux", DemuxQueueSize, [this](Buffer&& buffer) {
+              mDemuxer.feed(std::move(buffer));
+          }),
+      mAudioStage("audio", AudioQueueSize, [this](Packet&& pkt) {
+              mAAC.decode(pkt.data(), pkt.size(), pkt.pts());
+          }),
+      mVideoStage("video", VideoQueueSize, [this](Packet&& pkt) {
+              handleVideo(pkt);
+          })
 {
+    // a demuxer that can't keep up would otherwise block the socket thread
+    // with an ever growing backlog in the queue, over the mark the oldest
+    // buffers go instead
+    if (opts.demuxer.highWaterMark > 0) {
+        mDemuxStage.setHighWaterMark(opts.demuxer.highWaterMark,
+            [](const Buffer& buffer) { return buffer.size(); },
+            [this](size_t buffers, size_t bytes) { mDemuxer.dropped(buffers, bytes); });
+    }
 }
 
 Renderer::~Renderer()
 {
-    if (mDecoder) {
-        VTDecompressionSessionFinishDelayedFrames(mDecoder);
-        /* Block until our callback has been called with the last frame. */
-        VTDecompressionSessionWaitForAsynchronousFrames(mDecoder);
+    mDemuxStage.stop();
+    mAudioStage.stop();
+    mVideoStage.stop();
 
-        /* Clean up. */
-        VTDecompressionSessionInvalidate(mDecoder);
-        CFRelease(mDecoder);
-        CFRelease(mVideoFormat);
-    }
+    destroyDecoder();
+}
+
+std::vector<StageStats> Renderer::stageStats() const
+{
+    return { mDemuxStage.stats(), mAudioStage.stats(), mVideoStage.stats() };
 }
 
 void Renderer::exec()
 {
+    mDemuxStage.start();
+    mAudioStage.start();
+    mVideoStage.start();
+
     mClient->readyRead().connect([this](const SocketClient::SharedPtr&, Buffer&& buffer) {
-            mDemuxer.feed(std::move(buffer));
+            mDemuxStage.push(std::move(buffer));
         });
     mClient->connected().connect([](const SocketClient::SharedPtr&) {
             Log::stdout("connected\n");
@@ -66,11 +116,8 @@ void Renderer::exec()
             Log::stdout("\n");
 
             if (type == TSDemux::STREAM_TYPE_VIDEO_H264) {
-                mWidth = info.width;
-                mHeight = info.height;
+                // the geometry comes from the SPS, see formatChanged below
                 mH264Pid = pid;
-
-                mGeometryChange(mWidth, mHeight);
             } else if (type == TSDemux::STREAM_TYPE_AUDIO_AAC_ADTS) {
                 mAACPid = pid;
 
@@ -80,24 +127,22 @@ void Renderer::exec()
                 //printf("eh %d\n", type);
             }
         });
-    mDemuxer.pkt().connect([this](const TSDemux::STREAM_PKT& pkt) {
-            if (pkt.pid == mH264Pid) {
-                if (mDecoder) {
-                    handlePacket(pkt);
-                } else {
-                    if (mWidth > 0 && mHeight > 0) {
-                        createDecoder(pkt);
-                        if (mDecoder)
-                            handlePacket(pkt);
-                    } else {
-                        return;
-                    }
-                }
-            } else if (pkt.pid == mAACPid) {
-                //mAudio(pkt.data, pkt.size);
-                mAAC.decode(pkt.data, pkt.size, pkt.pts);
+    mDemuxer.pkt().connect([this](const Packet& pkt) {
+            if (pkt.pid() == mH264Pid) {
+                mVideoStage.push(Packet(pkt));
+            } else if (pkt.pid() == mAACPid) {
+                //mAudio(pkt.data(), pkt.size());
+                mAudioStage.push(Packet(pkt));
             }
         });
+    mParameterSets.formatChanged().connect([this](const ParameterSets::Format& format) {
+            Log::stdout("video format %x%%, profile % level %\n", format.width, format.height,
+                        format.interlaced ? "i" : "p", format.profile, format.level);
+            mWidth = format.width;
+            mHeight = format.height;
+
+            mGeometryChange(format.width, format.height);
+        });
     mAAC.samples().connect([this](const void* samples, size_t count, size_t bps, uint64_t pts) {
             mAudio(static_cast<const uint8_t*>(samples), count * bps, pts);
         });
@@ -106,69 +151,148 @@ void Renderer::exec()
         });
 }
 
-void Renderer::handlePacket(const TSDemux::STREAM_PKT& pkt)
+void Renderer::handleVideo(Packet& pkt)
 {
-    size_t size = 0;
-    std::vector<media::H264NALU> nalus;
-    mParser.SetStream(pkt.data, pkt.size);
-    mCurrentPts = pkt.pts;
-    while (true) {
-        media::H264NALU nalu;
-        media::H264Parser::Result result = mParser.AdvanceToNextNALU(&nalu);
-        if (result == media::H264Parser::kEOStream)
-            break;
-        if (result != media::H264Parser::kOk) {
-            // bad
-            break;
-        }
-        switch (nalu.nal_unit_type) {
-        case media::H264NALU::kSPS:
-        case media::H264NALU::kSPSExt:
-        case media::H264NALU::kPPS:
-            break;
-        default:
-            size += 4 + nalu.size;
-            nalus.push_back(nalu);
-            break;
-        }
+    // one scan for the boundaries of all the NALUs, both the decoder setup
+    // and the frame work from that. anything after a bad NALU is dropped
+    media::H264NALUEntry nalus[MaxNALUs];
+    size_t count;
+    media::H264Parser::IndexNALUs(pkt.data(), pkt.size(), nalus, MaxNALUs, &count);
+
+    // the parameter sets come with every IDR picture, the decoder is only
+    // touched when they're actually different
+    switch (mParameterSets.update(pkt.data(), nalus, count)) {
+    case ParameterSets::None:
+        if (!mDecoder && mParameterSets.isValid())
+            createDecoder();
+        break;
+    case ParameterSets::ParameterSetsChanged:
+        updateFormat();
+        break;
+    case ParameterSets::FormatChanged:
+        createDecoder();
+        break;
+    }
+    const RandomAccess::Type type = mRandomAccess.update(pkt.data(), nalus, count, pkt.pts());
+    if (!mDecoder)
+        return;
+    // a new decoder, or one that joined mid-stream, starts at the next IDR
+    // or recovery point. what comes before would only decode to garbage
+    if (!mSynced) {
+        if (type == RandomAccess::None)
+            return;
+        mSynced = true;
+        mRecoveryFrames = mRandomAccess.latest()->recoveryFrames;
     }
 
-    if (!size)
+    // when VideoToolbox can't keep up, leave out what nothing else needs
+    // first and only give up on everything up to the next IDR after that
+    const DropPolicy::Picture picture = DropPolicy::classify(pkt.data(), nalus, count);
+    if (!picture.slices)
         return;
+    const uint64_t skips = mDropPolicy.stats().skips;
+    switch (mDropPolicy.decide(picture)) {
+    case DropPolicy::Decode:
+        break;
+    case DropPolicy::DropNonReference:
+        return;
+    case DropPolicy::Skip:
+        if (mDropPolicy.stats().skips != skips)
+            Log::stderr("decoder % frames behind, skipping to the next IDR\n", mDropPolicy.depth());
+        return;
+    }
+    handlePacket(pkt, nalus, count);
+}
+
+static void releasePacket(void* refCon, void* /*doomedMemoryBlock*/, size_t /*sizeInBytes*/)
+{
+    delete static_cast<Packet*>(refCon);
+}
 
-    CMBlockBufferRef data;
+// a block buffer over the spans of pkt without copying anything, it holds on
+// to its own copy of pkt until the decoder is done with it
+static OSStatus wrapPacket(const Packet& pkt, const AVCC::Span* spans, size_t numSpans, CMBlockBufferRef* data)
+{
+    CMBlockBufferCustomBlockSource source = { kCMBlockBufferCustomBlockSourceVersion, NULL, releasePacket, new Packet(pkt) };
+    CMBlockBufferRef whole;
     OSStatus status = CMBlockBufferCreateWithMemoryBlock(
         kCFAllocatorDefault,
-        NULL,                 // &memory_block
-        size,                 // block_length
-        kCFAllocatorDefault,  // block_allocator
-        NULL,                 // &custom_block_source
-        0,                    // offset_to_data
-        size,                 // data_length
-        0,                    // flags
-        &data);
+        const_cast<uint8_t*>(pkt.data()),  // &memory_block
+        pkt.size(),                         // block_length
+        kCFAllocatorNull,                   // block_allocator
+        &source,                            // &custom_block_source
+        0,                                  // offset_to_data
+        pkt.size(),                         // data_length
+        0,                                  // flags
+        &whole);
     if (status != noErr) {
-        // ugh
-        Log::stderr("couldn't create block buffer\n");
-        return;
+        delete static_cast<Packet*>(source.refCon);
+        return status;
+    }
+    status = CMBlockBufferCreateEmpty(kCFAllocatorDefault, numSpans, 0, data);
+    for (size_t i = 0; status == noErr && i < numSpans; ++i)
+        status = CMBlockBufferAppendBufferReference(*data, whole, spans[i].offset, spans[i].size, 0);
+    if (status != noErr && *data) {
+        CFRelease(*data);
+        *data = 0;
     }
-    size_t offset = 0;
-    for (size_t i = 0; i < nalus.size(); i++) {
-        media::H264NALU& nalu = nalus[i];
-        uint32_t header = htonl(nalu.size);
-        status = CMBlockBufferReplaceDataBytes(
-            &header, data, offset, 4);
+    // the references keep it alive
+    CFRelease(whole);
+    return status;
+}
+
+void Renderer::handlePacket(Packet& pkt, const media::H264NALUEntry* nalus, size_t count)
+{
+    // the parameter sets went into mVideoFormat
+    static const AVCC avcc((1u << media::H264NALU::kSPS)
+                           | (1u << media::H264NALU::kSPSExt)
+                           | (1u << media::H264NALU::kPPS));
+
+    mCurrentPts = pkt.pts();
+    const size_t size = avcc.size(nalus, count);
+    if (!size)
+        return;
+    // before the start codes get overwritten below
+    const uint64_t captured = captureTime(pkt.data(), nalus, count);
+
+    // the start codes become the sizes in place when we have the only copy
+    // of the packet, which is the common case since the demuxer lets go of
+    // its copy right after queuing it. otherwise, or when a 3 byte start
+    // code leaves no room for a size, the frame gets copied once
+    CMBlockBufferRef data = 0;
+    AVCC::Span spans[MaxNALUs];
+    size_t numSpans;
+    OSStatus status;
+    if (pkt.unique() && avcc.convertInPlace(pkt.mutableData(), nalus, count, spans, &numSpans)) {
+        status = wrapPacket(pkt, spans, numSpans, &data);
+        if (status != noErr) {
+            Log::stderr("couldn't wrap packet\n");
+            return;
+        }
+    } else {
+        status = CMBlockBufferCreateWithMemoryBlock(
+            kCFAllocatorDefault,
+            NULL,                 // &memory_block
+            size,                 // block_length
+            kCFAllocatorDefault,  // block_allocator
+            NULL,                 // &custom_block_source
+            0,                    // offset_to_data
+            size,                 // data_length
+            kCMBlockBufferAssureMemoryNowFlag,
+            &data);
         if (status != noErr) {
-            Log::stderr("couldn't replace data bytes (1)\n");
+            // ugh
+            Log::stderr("couldn't create block buffer\n");
             return;
         }
-        offset += 4;
-        status = CMBlockBufferReplaceDataBytes(nalu.data, data, offset, nalu.size);
+        char* dst;
+        status = CMBlockBufferGetDataPointer(data, 0, NULL, NULL, &dst);
         if (status != noErr) {
-            Log::stderr("couldn't replace data bytes (2)\n");
+            Log::stderr("couldn't get block buffer data\n");
+            CFRelease(data);
             return;
         }
-        offset += nalu.size;
+        avcc.convert(pkt.data(), nalus, count, reinterpret_cast<uint8_t*>(dst));
     }
 
     CMSampleBufferRef frame;
@@ -191,116 +315,158 @@ void Renderer::handlePacket(const TSDemux::STREAM_PKT& pkt)
         return;
     }
 
-    const VTDecodeFrameFlags decode_flags =
+    VTDecodeFrameFlags decode_flags =
         kVTDecodeFrame_EnableAsynchronousDecompression;
+    // until the recovery point is reached the pictures are only decoded
+    // for reference, they're not right yet
+    if (mRecoveryFrames > 0) {
+        decode_flags |= kVTDecodeFrame_DoNotOutputFrame;
+        --mRecoveryFrames;
+    }
 
+    mDropPolicy.submitted();
     status = VTDecompressionSessionDecodeFrame(
         mDecoder,
         frame,                                  // sample_buffer
         decode_flags,                           // decode_flags
-        this,                                   // source_frame_refcon
+        reinterpret_cast<void*>(static_cast<uintptr_t>(captured)), // source_frame_refcon
         NULL);                                  // &info_flags_out
     if (status != noErr) {
         Log::stderr("unable to decode frame\n");
-        //return;
+        // the callback won't come for this one
+        mDropPolicy.completed();
     }
     CFRelease(frame);
     CFRelease(data);
 }
 
-void Renderer::createDecoder(const TSDemux::STREAM_PKT& pkt)
+// the time the server captured the picture at, from its SEI, 0 if it
+// doesn't say
+uint64_t Renderer::captureTime(const uint8_t* data, const media::H264NALUEntry* nalus, size_t count)
 {
-    struct NaluData
-    {
-        NaluData() : data(0), size(0) { }
-
-        void assign(const uint8_t* d, size_t s) { data = d; size = s; }
-
-        const uint8_t* data;
-        size_t size;
-    };
-    NaluData lastSps, lastPps;
-
-    media::H264NALU nalu;
-    mParser.SetStream(pkt.data, pkt.size);
-    while (true) {
-        media::H264Parser::Result result = mParser.AdvanceToNextNALU(&nalu);
-        if (result == media::H264Parser::kEOStream)
-            break;
-        if (result != media::H264Parser::kOk) {
-            // bad
-            break;
-        }
-        switch (nalu.nal_unit_type) {
-        case media::H264NALU::kSPS:
-            lastSps.assign(nalu.data, nalu.size);
-            break;
-        case media::H264NALU::kPPS:
-            lastPps.assign(nalu.data, nalu.size);
-            break;
+    for (size_t i = 0; i < count; ++i) {
+        if (nalus[i].nal_unit_type != media::H264NALU::kSEIMessage)
+            continue;
+        media::H264NALU nalu;
+        media::H264Parser::Result result = mParser.SetNALU(data, nalus[i], &nalu);
+        while (result == media::H264Parser::kOk) {
+            media::H264SEIMessage sei;
+            result = mParser.ParseSEI(&sei);
+            uint64_t captured;
+            if (result == media::H264Parser::kOk && sei.type == media::H264SEIMessage::kSEIUserDataUnregistered
+                && CaptureTime::read(sei.user_data_unregistered, &captured)) {
+                return captured;
+            }
         }
     }
+    return 0;
+}
+
+CMVideoFormatDescriptionRef Renderer::createFormat() const
+{
+    const std::vector<uint8_t>& sps = mParameterSets.sps();
+    const std::vector<uint8_t>& pps = mParameterSets.pps();
+    Log::stdout("sps of % and pps of %\n", sps.size(), pps.size());
+    const uint8_t* const parameterSetPointers[2] = { sps.data(), pps.data() };
+    const size_t parameterSetSizes[2] = { sps.size(), pps.size() };
+    CMVideoFormatDescriptionRef format;
+    const OSStatus status = CMVideoFormatDescriptionCreateFromH264ParameterSets(NULL,
+                                                                                2,
+                                                                                parameterSetPointers,
+                                                                                parameterSetSizes,
+                                                                                4,
+                                                                                &format);
+    if (status != noErr) {
+        Log::stderr("ugh, format failure %\n", status);
+        return 0;
+    }
+    return format;
+}
 
-    if (!lastSps.data || !lastPps.data) {
-        Log::stderr("no sps and/or pps\n");
+void Renderer::updateFormat()
+{
+    // new parameter sets for the same format, the session can usually take
+    // them as they are
+    CMVideoFormatDescriptionRef format = createFormat();
+    if (!format)
+        return;
+    if (mDecoder && VTDecompressionSessionCanAcceptFormatDescription(mDecoder, format)) {
+        CFRelease(mVideoFormat);
+        mVideoFormat = format;
         return;
     }
+    CFRelease(format);
+    createDecoder();
+}
 
-    OSStatus status;
+void Renderer::destroyDecoder()
+{
+    if (mDecoder) {
+        VTDecompressionSessionFinishDelayedFrames(mDecoder);
+        /* Block until our callback has been called with the last frame. */
+        VTDecompressionSessionWaitForAsynchronousFrames(mDecoder);
 
-    Log::stdout("sps of % and pps of %\n", lastSps.size, lastPps.size);
-    const uint8_t* const parameterSetPointers[2] = { lastSps.data, lastPps.data };
-    const size_t parameterSetSizes[2] = { lastSps.size, lastPps.size };
-    status = CMVideoFormatDescriptionCreateFromH264ParameterSets(NULL,
-                                                                 2,
-                                                                 parameterSetPointers,
-                                                                 parameterSetSizes,
-                                                                 4,
-                                                                 &mVideoFormat);
-
-    if (status == noErr) {
-        Log::stdout("format descr created!\n");
-        // Set the pixel attributes for the destination buffer
-        CFMutableDictionaryRef destinationPixelBufferAttributes = CFDictionaryCreateMutable(
-            NULL, // CFAllocatorRef allocator
-            0,    // CFIndex capacity
-            &kCFTypeDictionaryKeyCallBacks,
-            &kCFTypeDictionaryValueCallBacks);
-
-        //SInt32 destinationPixelType = kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange;
-        SInt32 destinationPixelType = kCVPixelFormatType_422YpCbCr8;
-        CFDictionarySetValue(destinationPixelBufferAttributes, kCVPixelBufferPixelFormatTypeKey, CFNumberCreate(NULL, kCFNumberSInt32Type, &destinationPixelType));
-        CFDictionarySetValue(destinationPixelBufferAttributes, kCVPixelBufferWidthKey, CFNumberCreate(NULL, kCFNumberSInt32Type, &mWidth));
-        CFDictionarySetValue(destinationPixelBufferAttributes, kCVPixelBufferHeightKey, CFNumberCreate(NULL, kCFNumberSInt32Type, &mHeight));
-        CFDictionarySetValue(destinationPixelBufferAttributes, kCVPixelBufferOpenGLCompatibilityKey, kCFBooleanTrue);
-
-        // Set the Decoder Parameters
-        CFMutableDictionaryRef decoderParameters = CFDictionaryCreateMutable(
-            NULL, // CFAllocatorRef allocator
-            0,    // CFIndex capacity
-            &kCFTypeDictionaryKeyCallBacks,
-            &kCFTypeDictionaryValueCallBacks);
-
-        CFDictionarySetValue(decoderParameters, kVTDecompressionPropertyKey_RealTime, kCFBooleanTrue);
-
-        // Create the decompression session
-        // Throws Error -8971 (codecExtensionNotFoundErr)
-
-        const VTDecompressionOutputCallbackRecord callback = { decoded, this };
-
-        status = VTDecompressionSessionCreate(NULL, mVideoFormat, decoderParameters, destinationPixelBufferAttributes, &callback, &mDecoder);
-
-        // release the dictionaries
-        CFRelease(destinationPixelBufferAttributes);
-        CFRelease(decoderParameters);
-
-        // Check the Status
-        if(status != noErr) {
-            Log::stderr("error creating session %\n", status);
-            return;
-        }
-        Log::stdout("decoder created\n");
-    } else {
-        Log::stderr("ugh, format failure %\n", status);
+        /* Clean up. */
+        VTDecompressionSessionInvalidate(mDecoder);
+        CFRelease(mDecoder);
+        mDecoder = 0;
+    }
+    mSynced = false;
+    if (mVideoFormat) {
+        CFRelease(mVideoFormat);
+        mVideoFormat = 0;
+    }
+}
+
+void Renderer::createDecoder()
+{
+    destroyDecoder();
+
+    mVideoFormat = createFormat();
+    if (!mVideoFormat)
+        return;
+
+    Log::stdout("format descr created!\n");
+    // Set the pixel attributes for the destination buffer
+    CFMutableDictionaryRef destinationPixelBufferAttributes = CFDictionaryCreateMutable(
+        NULL, // CFAllocatorRef allocator
+        0,    // CFIndex capacity
+        &kCFTypeDictionaryKeyCallBacks,
+        &kCFTypeDictionaryValueCallBacks);
+
+    //SInt32 destinationPixelType = kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange;
+    SInt32 destinationPixelType = kCVPixelFormatType_422YpCbCr8;
+    CFDictionarySetValue(destinationPixelBufferAttributes, kCVPixelBufferPixelFormatTypeKey, CFNumberCreate(NULL, kCFNumberSInt32Type, &destinationPixelType));
+    const int width = mWidth, height = mHeight;
+    CFDictionarySetValue(destinationPixelBufferAttributes, kCVPixelBufferWidthKey, CFNumberCreate(NULL, kCFNumberSInt32Type, &width));
+    CFDictionarySetValue(destinationPixelBufferAttributes, kCVPixelBufferHeightKey, CFNumberCreate(NULL, kCFNumberSInt32Type, &height));
+    CFDictionarySetValue(destinationPixelBufferAttributes, kCVPixelBufferOpenGLCompatibilityKey, kCFBooleanTrue);
+
+    // Set the Decoder Parameters
+    CFMutableDictionaryRef decoderParameters = CFDictionaryCreateMutable(
+        NULL, // CFAllocatorRef allocator
+        0,    // CFIndex capacity
+        &kCFTypeDictionaryKeyCallBacks,
+        &kCFTypeDictionaryValueCallBacks);
+
+    CFDictionarySetValue(decoderParameters, kVTDecompressionPropertyKey_RealTime, kCFBooleanTrue);
+
+    // Create the decompression session
+    // Throws Error -8971 (codecExtensionNotFoundErr)
+
+    const VTDecompressionOutputCallbackRecord callback = { decoded, this };
+
+    const OSStatus status = VTDecompressionSessionCreate(NULL, mVideoFormat, decoderParameters, destinationPixelBufferAttributes, &callback, &mDecoder);
+
+    // release the dictionaries
+    CFRelease(destinationPixelBufferAttributes);
+    CFRelease(decoderParameters);
+
+    // Check the Status
+    if(status != noErr) {
+        Log::stderr("error creating session %\n", status);
+        mDecoder = 0;
+        return;
     }
+    Log::stdout("decoder created\n");
 }
@@ -1,14 +1,21 @@
 #ifndef RENDERER_H
 #define RENDERER_H
 
+#include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 #include <VideoToolbox.h>
 #include <AudioToolbox.h>
 #include <rct/SocketClient.h>
 #include <rct/SignalSlot.h>
 #include "Demuxer.h"
 #include "AAC.h"
+#include "Pipeline.h"
+#include "DropPolicy.h"
+#include "Histogram.h"
+#include "ParameterSets.h"
+#include "RandomAccess.h"
 #include "h264_parser.h"
 
 class Renderer
@@ -18,6 +25,9 @@ public:
     {
         std::string host;
         uint16_t port;
+        Demuxer::Options demuxer;
+        // when to drop pictures as the decoder falls behind
+        DropPolicy::Options drop;
     };
 
     Renderer(Options opts);
@@ -55,9 +65,21 @@ public:
 
     uint64_t currentPts() const { return mCurrentPts; }
 
+    // nanoseconds from capture on the server to the decoded picture being
+    // handed on for display, for the pictures tagged with a CaptureTime
+    const Histogram& latency() const { return mLatency; }
+
+    // queue depth and stall counts for the demux, audio and video stages
+    std::vector<StageStats> stageStats() const;
+
 private:
-    void createDecoder(const TSDemux::STREAM_PKT& pkt);
-    void handlePacket(const TSDemux::STREAM_PKT& pkt);
+    void handleVideo(Packet& pkt);
+    CMVideoFormatDescriptionRef createFormat() const;
+    void updateFormat();
+    void createDecoder();
+    void destroyDecoder();
+    void handlePacket(Packet& pkt, const media::H264NALUEntry* nalus, size_t count);
+    uint64_t captureTime(const uint8_t* data, const media::H264NALUEntry* nalus, size_t count);
 
     static void decoded(void *decompressionOutputRefCon, void *sourceFrameRefCon, OSStatus status, VTDecodeInfoFlags infoFlags,
                         CVImageBufferRef imageBuffer, CMTime presentationTimeStamp, CMTime presentationDuration);
@@ -67,14 +89,28 @@ private:
     std::shared_ptr<SocketClient> mClient;
     Demuxer mDemuxer;
     AAC mAAC;
+    ParameterSets mParameterSets;
+    RandomAccess mRandomAccess;
+    // false until the decoder has been given a random access point, and
+    // the pictures still to be decoded without output after a recovery point
+    bool mSynced;
+    int mRecoveryFrames;
+    DropPolicy mDropPolicy;
+    // only for the SEI, the parameter sets are parsed by mParameterSets
+    media::H264Parser mParser;
+    Histogram mLatency;
 
-    int mWidth, mHeight;
+    std::atomic<int> mWidth, mHeight;
     CMVideoFormatDescriptionRef mVideoFormat;
     VTDecompressionSessionRef mDecoder;
     uint16_t mH264Pid, mAACPid;
-    uint64_t mCurrentPts;
+    std::atomic<uint64_t> mCurrentPts;
 
-    media::H264Parser mParser;
+    // socket -> demux -> audio decode / video decode, each stage on its own
+    // thread. declared after everything the handlers touch so that the
+    // stage threads are gone before any of it is destroyed
+    PipelineStage<Buffer> mDemuxStage;
+    PipelineStage<Packet> mAudioStage, mVideoStage;
 
     Signal<std::function<void(int, int)> > mGeometryChange;
     Signal<std::function<void(ImageBuffer&& image, CMTime timestamp, CMTime duration, uint64_t pts)> > mImage;
@@ -1,15 +1,17 @@
 #include "View.h"
 #include "Renderer.h"
+#include "PcmRing.h"
 #include "Log.h"
 
 #import <Cocoa/Cocoa.h>
 #include <OpenGL/gl.h>
 #include <AudioToolbox/AudioQueue.h>
-#include <vector>
-#include <mutex>
+#include <atomic>
 
 static const int NumAudioBuffers = 3;
 static const float AudioBufferSeconds = 0.2;
+// a little over 2.5 seconds of 48kHz 16 bit stereo
+static const size_t AudioRingBytes = 512 * 1024;
 
 class ScopedPool
 {
@@ -110,8 +112,8 @@ public:
     struct {
         AudioQueueBufferRef ref;
     } audioBuffers[NumAudioBuffers];
-    std::mutex audioMutex;
-    std::vector<std::vector<uint8_t> > audioPending;
+    PcmRing audioRing;
+    std::atomic<uint64_t> audioOverruns;
 
     void init();
 
@@ -120,7 +122,7 @@ public:
 };
 
 ViewPrivate::ViewPrivate()
-    : audioQueue(0)
+    : glview(0), textureCache(0), audioQueue(0), audioRing(AudioRingBytes), audioOverruns(0)
 {
     for (int i = 0; i < NumAudioBuffers; ++i) {
         audioBuffers[i].ref = 0;
@@ -132,30 +134,10 @@ void ViewPrivate::audioOutput(void *inClientData, AudioQueueRef inAQ,
 {
     //printf("want audio output\n");
     ViewPrivate* priv = static_cast<ViewPrivate*>(inClientData);
-    // see if we have any pending data
-    std::unique_lock<std::mutex> locker(priv->audioMutex);
-    if (!priv->audioPending.empty()) {
-        // take as much as possible
-        size_t total = 0;
-        do {
-            // can we take the entire current block?
-            auto& data = priv->audioPending.front();
-            const size_t taken = std::min<size_t>(data.size(), inBuffer->mAudioDataBytesCapacity - total);
-            memcpy(static_cast<uint8_t*>(inBuffer->mAudioData) + total, &data[0], taken);
-            total += taken;
-            if (taken == data.size()) {
-                // yep
-                priv->audioPending.erase(priv->audioPending.begin());
-                if (priv->audioPending.empty()) {
-                    // done
-                    break;
-                }
-            } else {
-                // no, we'll have to memmove sadly
-                memmove(&data[0], &data[taken], data.size() - taken);
-                data.resize(data.size() - taken);
-            }
-        } while (total < inBuffer->mAudioDataBytesCapacity);
+    // take as much as possible, this runs on the realtime audio thread so
+    // the ring never locks or allocates
+    const size_t total = priv->audioRing.read(inBuffer->mAudioData, inBuffer->mAudioDataBytesCapacity);
+    if (total > 0) {
         inBuffer->mAudioDataByteSize = total;
         OSStatus err = AudioQueueEnqueueBuffer(priv->audioQueue, inBuffer, 0, NULL);
         if (err != noErr) {
@@ -212,6 +194,14 @@ View::View(Renderer* r)
     mRenderer->geometryChange().connect([this](int w, int h) {
         dispatch_sync(dispatch_get_main_queue(), ^{
                 ScopedPool pool;
+                if (mPriv->glview) {
+                    // the stream changed format, keep the window we have
+                    mPriv->glview->width = w;
+                    mPriv->glview->height = h;
+                    [[mPriv->glview window] setContentSize:NSMakeSize(w, h)];
+                    return;
+                }
+
                 NSApplication* app = [NSApplication sharedApplication];
 
                 NSRect rect = NSMakeRect(0, 0, w, h);
@@ -311,13 +301,11 @@ View::View(Renderer* r)
                 return;
 
             //printf("audio pts %llu\n", pts);
-            dispatch_sync(dispatch_get_main_queue(), ^{
-                    std::vector<uint8_t> pending;
-                    pending.resize(size);
-                    memcpy(&pending[0], data, size);
-                    std::unique_lock<std::mutex> locker(mPriv->audioMutex);
-                    mPriv->audioPending.push_back(std::move(pending));
-                });
+            if (!mPriv->audioRing.write(data, size)) {
+                // output isn't keeping up, drop this block rather than wait
+                const uint64_t overruns = ++mPriv->audioOverruns;
+                Log::stdout("audio overrun, dropped % bytes (% total overruns)\n", size, overruns);
+            }
         });
 }
 
@@ -28,6 +28,9 @@ int main(int argc, char** argv)
         return 1;
     }
     renderOptions.port = options.get<int>("&port", 5198);
+    renderOptions.demuxer.highWaterMark = options.get<int>("high-water-mark", renderOptions.demuxer.highWaterMark);
+    renderOptions.drop.dropNonReference = options.get<int>("drop-non-reference", renderOptions.drop.dropNonReference);
+    renderOptions.drop.skipToIDR = options.get<int>("skip-to-idr", renderOptions.drop.skipToIDR);
     const bool verbose = options.enabled("&verbose");
     Log::addSink(
         [verbose](const std::string& msg) {
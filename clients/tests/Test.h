@@ -0,0 +1,50 @@
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+
+// Just enough of a test framework for the portable client pieces. Each test
+// is its own executable, CHECK() reports what failed and keeps going, and
+// main returns Test::result() so ctest sees the failure.
+//
+//     static void testThing()
+//     {
+//         CHECK(thing() == 1);
+//     }
+//
+//     int main()
+//     {
+//         testThing();
+//         return Test::result();
+//     }
+namespace Test {
+
+inline int& failures()
+{
+    static int count = 0;
+    return count;
+}
+
+inline bool check(bool ok, const char* expression, const char* file, int line)
+{
+    if (!ok) {
+        fprintf(stderr, "%s:%d: CHECK(%s) failed\n", file, line, expression);
+        ++failures();
+    }
+    return ok;
+}
+
+inline int result()
+{
+    if (failures()) {
+        fprintf(stderr, "%d check(s) failed\n", failures());
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace Test
+
+#define CHECK(expression) Test::check((expression), #expression, __FILE__, __LINE__)
+
+#endif
@@ -0,0 +1,190 @@
+#include "Test.h"
+#include "DropPolicy.h"
+#include <deque>
+#include <vector>
+
+// Stands in for VTDecompressionSession: takes whatever the policy lets
+// through and finishes frames only when told to, so the test decides how
+// far behind it is.
+class FakeDecoder
+{
+public:
+    FakeDecoder(DropPolicy& policy) : mPolicy(policy) { }
+
+    DropPolicy::Decision submit(const DropPolicy::Picture& picture)
+    {
+        const DropPolicy::Decision decision = mPolicy.decide(picture);
+        if (decision == DropPolicy::Decode) {
+            mPolicy.submitted();
+            mQueue.push_back(picture);
+        }
+        return decision;
+    }
+
+    void complete(size_t frames)
+    {
+        for (; frames && !mQueue.empty(); --frames) {
+            mQueue.pop_front();
+            mPolicy.completed();
+        }
+    }
+
+    size_t queued() const { return mQueue.size(); }
+
+private:
+    DropPolicy& mPolicy;
+    std::deque<DropPolicy::Picture> mQueue;
+};
+
+static DropPolicy::Picture picture(bool idr, bool reference, int sliceType)
+{
+    DropPolicy::Picture picture;
+    picture.slices = 1;
+    picture.idr = idr;
+    picture.reference = reference;
+    picture.sliceType = sliceType;
+    return picture;
+}
+
+static const DropPolicy::Picture IDR = picture(true, true, media::H264SliceHeader::kISlice);
+static const DropPolicy::Picture P = picture(false, true, media::H264SliceHeader::kPSlice);
+static const DropPolicy::Picture B = picture(false, false, media::H264SliceHeader::kBSlice);
+
+static DropPolicy::Options options()
+{
+    DropPolicy::Options opts;
+    opts.dropNonReference = 4;
+    opts.skipToIDR = 8;
+    return opts;
+}
+
+// a decoder that keeps up never has anything dropped
+static void testKeepingUp()
+{
+    DropPolicy policy(options());
+    FakeDecoder decoder(policy);
+    const DropPolicy::Picture gop[] = { IDR, P, B, B, P, B, B, P, B, B };
+    for (int i = 0; i < 100; ++i) {
+        CHECK(decoder.submit(gop[i % 10]) == DropPolicy::Decode);
+        decoder.complete(1);
+    }
+    CHECK(policy.depth() == 0);
+    CHECK(policy.stats().decoded == 100);
+    CHECK(policy.stats().droppedNonReference == 0);
+    CHECK(policy.stats().skipped == 0);
+}
+
+// once dropNonReference frames are in flight the B pictures go, the
+// reference pictures still get decoded
+static void testDropNonReference()
+{
+    DropPolicy policy(options());
+    FakeDecoder decoder(policy);
+
+    CHECK(decoder.submit(IDR) == DropPolicy::Decode);
+    CHECK(decoder.submit(P) == DropPolicy::Decode);
+    CHECK(decoder.submit(B) == DropPolicy::Decode);
+    CHECK(decoder.submit(P) == DropPolicy::Decode);
+    CHECK(policy.depth() == 4);
+
+    CHECK(decoder.submit(B) == DropPolicy::DropNonReference);
+    CHECK(decoder.submit(B) == DropPolicy::DropNonReference);
+    CHECK(policy.depth() == 4);
+    CHECK(decoder.submit(P) == DropPolicy::Decode);
+    CHECK(policy.depth() == 5);
+    CHECK(policy.stats().droppedNonReference == 2);
+    CHECK(policy.stats().droppedB == 2);
+
+    // caught up again, B pictures are back
+    decoder.complete(2);
+    CHECK(decoder.submit(B) == DropPolicy::Decode);
+    CHECK(policy.stats().skipped == 0);
+}
+
+// at skipToIDR everything is skipped up to the next IDR picture, also after
+// the decoder has caught up since what follows a skipped reference picture
+// can't be decoded
+static void testSkipToIDR()
+{
+    DropPolicy policy(options());
+    FakeDecoder decoder(policy);
+
+    CHECK(decoder.submit(IDR) == DropPolicy::Decode);
+    for (int i = 0; i < 7; ++i)
+        CHECK(decoder.submit(P) == DropPolicy::Decode);
+    CHECK(policy.depth() == 8);
+
+    CHECK(decoder.submit(P) == DropPolicy::Skip);
+    CHECK(policy.stats().skips == 1);
+    CHECK(policy.depth() == 8);
+
+    decoder.complete(8);
+    CHECK(policy.depth() == 0);
+    CHECK(decoder.submit(P) == DropPolicy::Skip);
+    CHECK(decoder.submit(B) == DropPolicy::Skip);
+    CHECK(decoder.submit(P) == DropPolicy::Skip);
+    CHECK(policy.stats().skipped == 4);
+    CHECK(policy.stats().skips == 1);
+
+    // the next IDR ends it
+    CHECK(decoder.submit(IDR) == DropPolicy::Decode);
+    CHECK(decoder.submit(P) == DropPolicy::Decode);
+    CHECK(decoder.submit(B) == DropPolicy::Decode);
+    CHECK(policy.stats().skips == 1);
+    CHECK(policy.stats().skipped == 4);
+}
+
+// an IDR picture is decoded however far behind the decoder is
+static void testIDRAlwaysDecoded()
+{
+    DropPolicy policy(options());
+    FakeDecoder decoder(policy);
+    for (int i = 0; i < 20; ++i)
+        CHECK(decoder.submit(IDR) == DropPolicy::Decode);
+    CHECK(policy.depth() == 20);
+    CHECK(policy.stats().skipped == 0);
+}
+
+// classify() reads nal_ref_idc and the slice type of the first slice
+static void testClassify()
+{
+    // NALU header, then first_mb_in_slice 0 and slice_type as ue(v):
+    // 7 (I, all slices) for the IDR, 1 (B) for the non-reference slice
+    const uint8_t data[] = {
+        0x65, 0x88, 0x80,
+        0x01, 0xa8
+    };
+    media::H264NALUEntry nalus[2];
+    nalus[0].offset = 0;
+    nalus[0].size = 3;
+    nalus[0].start_code_size = 4;
+    nalus[0].nal_ref_idc = 3;
+    nalus[0].nal_unit_type = media::H264NALU::kIDRSlice;
+    nalus[1].offset = 3;
+    nalus[1].size = 2;
+    nalus[1].start_code_size = 4;
+    nalus[1].nal_ref_idc = 0;
+    nalus[1].nal_unit_type = media::H264NALU::kNonIDRSlice;
+
+    const DropPolicy::Picture idr = DropPolicy::classify(data, nalus, 1);
+    CHECK(idr.slices == 1);
+    CHECK(idr.idr);
+    CHECK(idr.reference);
+    CHECK(idr.sliceType == media::H264SliceHeader::kISlice);
+
+    const DropPolicy::Picture b = DropPolicy::classify(data, nalus + 1, 1);
+    CHECK(b.slices == 1);
+    CHECK(!b.idr);
+    CHECK(!b.reference);
+    CHECK(b.sliceType == media::H264SliceHeader::kBSlice);
+}
+
+int main()
+{
+    testKeepingUp();
+    testDropNonReference();
+    testSkipToIDR();
+    testIDRAlwaysDecoded();
+    testClassify();
+    return Test::result();
+}
@@ -0,0 +1,146 @@
+#include "Test.h"
+#include "PcmRing.h"
+#include <thread>
+#include <vector>
+
+// the byte at stream offset pos, so a reader can tell where its data
+// came from
+static inline uint8_t pattern(uint64_t pos)
+{
+    return static_cast<uint8_t>(pos * 7 + (pos >> 8));
+}
+
+static void fill(std::vector<uint8_t>& data, uint64_t pos)
+{
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = pattern(pos + i);
+}
+
+static bool matches(const uint8_t* data, size_t size, uint64_t pos)
+{
+    for (size_t i = 0; i < size; ++i) {
+        if (data[i] != pattern(pos + i))
+            return false;
+    }
+    return true;
+}
+
+static void testCapacity()
+{
+    PcmRing ring(10);
+    CHECK(ring.capacity() == 16);
+    CHECK(ring.available() == 0);
+    CHECK(ring.space() == 16);
+
+    PcmRing exact(64);
+    CHECK(exact.capacity() == 64);
+}
+
+static void testWrapAround()
+{
+    PcmRing ring(16);
+    std::vector<uint8_t> in;
+    uint8_t out[16];
+    uint64_t written = 0, read = 0;
+
+    // go round the ring a few times with sizes that never line up with
+    // its end
+    const size_t sizes[] = { 12, 10, 7, 16, 3, 13, 9 };
+    for (int round = 0; round < 10; ++round) {
+        for (size_t size : sizes) {
+            in.resize(std::min(size, ring.space()));
+            fill(in, written);
+            CHECK(ring.write(in.data(), in.size()));
+            written += in.size();
+            CHECK(ring.available() == written - read);
+
+            const size_t got = ring.read(out, size / 2 + 1);
+            CHECK(got == std::min<size_t>(size / 2 + 1, written - read));
+            CHECK(matches(out, got, read));
+            read += got;
+        }
+    }
+
+    // and drain what's left in one go, across the end of the ring
+    const size_t left = ring.available();
+    CHECK(ring.read(out, sizeof(out)) == left);
+    CHECK(matches(out, left, read));
+    CHECK(ring.available() == 0);
+}
+
+static void testAllOrNothing()
+{
+    PcmRing ring(16);
+    std::vector<uint8_t> in(16);
+    uint8_t out[16];
+    fill(in, 0);
+
+    CHECK(ring.write(in.data(), 10));
+    // doesn't fit, nothing of it may show up
+    CHECK(!ring.write(in.data() + 10, 7));
+    CHECK(ring.available() == 10);
+    CHECK(ring.space() == 6);
+    CHECK(ring.write(in.data() + 10, 6));
+    CHECK(!ring.write(in.data(), 1));
+    CHECK(ring.space() == 0);
+
+    CHECK(ring.read(out, sizeof(out)) == 16);
+    CHECK(matches(out, 16, 0));
+    CHECK(!ring.write(in.data(), 17));
+    CHECK(ring.available() == 0);
+
+    // reading an empty ring reads nothing
+    CHECK(ring.read(out, sizeof(out)) == 0);
+}
+
+// one producer and one consumer hammering a small ring, the consumer has
+// to see every byte exactly once and in order
+static void testThreaded()
+{
+    enum { Total = 16 * 1024 * 1024 };
+    PcmRing ring(256);
+
+    std::thread producer([&ring]() {
+        std::vector<uint8_t> frame;
+        uint64_t pos = 0;
+        size_t size = 1;
+        while (pos < Total) {
+            // frames of 1 to 96 bytes, like a short stretch of samples
+            size = size * 37 % 97;
+            frame.resize(std::min<uint64_t>(size ? size : 1, Total - pos));
+            fill(frame, pos);
+            while (!ring.write(frame.data(), frame.size()))
+                std::this_thread::yield();
+            pos += frame.size();
+        }
+    });
+
+    uint8_t out[200];
+    uint64_t pos = 0;
+    size_t size = 1;
+    bool ok = true;
+    while (pos < Total) {
+        size = size * 31 % sizeof(out);
+        const size_t got = ring.read(out, size ? size : 1);
+        if (!got) {
+            std::this_thread::yield();
+            continue;
+        }
+        ok = ok && matches(out, got, pos);
+        pos += got;
+    }
+    producer.join();
+
+    CHECK(ok);
+    CHECK(pos == Total);
+    CHECK(ring.available() == 0);
+}
+
+int main()
+{
+    testCapacity();
+    testWrapAround();
+    testAllOrNothing();
+    testThreaded();
+    return Test::result();
+}
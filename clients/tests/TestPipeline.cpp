@@ -0,0 +1,134 @@
+#include "Test.h"
+#include "Pipeline.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+// A demux stage stand-in: items are strings whose size is their length, the
+// handler can be held on its first item so the test decides how far behind
+// the stage is. Everything the stage thread sees goes into mEvents, read
+// only after stop().
+class SlowStage
+{
+public:
+    SlowStage(size_t capacity)
+        : mHold(true), mBusy(false),
+          mStage("test", capacity, [this](std::string&& item) {
+                  mBusy = true;
+                  while (mHold.load())
+                      std::this_thread::sleep_for(std::chrono::microseconds(100));
+                  mEvents.push_back(item);
+              })
+    {
+    }
+
+    void setHighWaterMark(size_t bytes)
+    {
+        mStage.setHighWaterMark(bytes,
+            [](const std::string& item) { return item.size(); },
+            [this](size_t items, size_t bytes) {
+                mEvents.push_back("dropped " + std::to_string(items) + " " + std::to_string(bytes));
+            });
+    }
+
+    // pushes one item and waits for the handler to be stuck on it
+    void block()
+    {
+        mStage.start();
+        mStage.push(std::string(100, 'a'));
+        while (!mBusy.load())
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    void release() { mHold = false; }
+
+    PipelineStage<std::string>& stage() { return mStage; }
+    const std::vector<std::string>& events() const { return mEvents; }
+
+private:
+    std::atomic<bool> mHold, mBusy;
+    std::vector<std::string> mEvents;
+    PipelineStage<std::string> mStage;
+};
+
+static std::string item(char c)
+{
+    return std::string(100, c);
+}
+
+// without a high-water mark nothing is dropped, the producer waits
+static void testBackPressure()
+{
+    SlowStage slow(4);
+    slow.block();
+    std::thread releaser([&slow]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            slow.release();
+        });
+    for (char c = 'b'; c <= 'k'; ++c)
+        slow.stage().push(item(c));
+    releaser.join();
+    slow.stage().stop();
+
+    CHECK(slow.events().size() == 11);
+    CHECK(slow.events().back() == item('k'));
+    CHECK(slow.stage().stats().stalls > 0);
+    CHECK(slow.stage().stats().dropped == 0);
+}
+
+// over the mark the oldest items go, the drop handler hears about them
+// right before the first one that gets handled
+static void testOldestDropped()
+{
+    SlowStage slow(64);
+    slow.setHighWaterMark(1000);
+    slow.block();
+    // 30 items of 100 bytes behind the one being handled
+    for (int i = 0; i < 30; ++i)
+        slow.stage().push(item('b' + i));
+    slow.release();
+    slow.stage().stop();
+
+    // the first 20 take it over 1000 bytes, the last 10 fit
+    const std::vector<std::string>& events = slow.events();
+    CHECK(events.size() == 12);
+    CHECK(events[0] == item('a'));
+    CHECK(events[1] == "dropped 20 2000");
+    CHECK(events[2] == item('b' + 20));
+    CHECK(events.back() == item('b' + 29));
+    CHECK(slow.stage().stats().dropped == 20);
+    CHECK(slow.stage().stats().droppedBytes == 2000);
+    CHECK(slow.stage().stats().stalls == 0);
+}
+
+// a full queue under the mark can't wait for the stage either, the new
+// items go and the next one that makes it in carries the gap
+static void testQueueFull()
+{
+    SlowStage slow(4);
+    slow.setHighWaterMark(1 << 20);
+    slow.block();
+    for (char c = 'b'; c <= 'k'; ++c)
+        slow.stage().push(item(c));
+    CHECK(slow.stage().stats().dropped == 6);
+    slow.release();
+    while (slow.stage().stats().processed < 5)
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    slow.stage().push(item('z'));
+    slow.stage().stop();
+
+    const std::vector<std::string>& events = slow.events();
+    CHECK(events.size() == 7);
+    CHECK(events[4] == item('e'));
+    CHECK(events[5] == "dropped 6 600");
+    CHECK(events[6] == item('z'));
+    CHECK(slow.stage().stats().stalls == 0);
+}
+
+int main()
+{
+    testBackPressure();
+    testOldestDropped();
+    testQueueFull();
+    return Test::result();
+}
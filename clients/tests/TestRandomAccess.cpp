@@ -0,0 +1,233 @@
+#include "Test.h"
+#include "RandomAccess.h"
+#include <vector>
+
+// Writes the RBSP of a NALU bit by bit and turns it into Annex B, enough to
+// put together the access units the tests need
+class NALUWriter
+{
+public:
+    NALUWriter(int nalRefIdc, int nalUnitType)
+        : mCache(0), mBits(0)
+    {
+        mRBSP.push_back(static_cast<uint8_t>((nalRefIdc << 5) | nalUnitType));
+    }
+
+    void bits(int count, uint32_t value)
+    {
+        while (count--) {
+            mCache = (mCache << 1) | ((value >> count) & 1);
+            if (++mBits == 8) {
+                mRBSP.push_back(mCache);
+                mCache = 0;
+                mBits = 0;
+            }
+        }
+    }
+
+    void ue(uint32_t value)
+    {
+        ++value;
+        int length = 0;
+        while (value >> (length + 1))
+            ++length;
+        bits(length, 0);
+        bits(length + 1, value);
+    }
+
+    // a SEI payload ends with a one bit and zeros up to the next byte
+    void alignPayload()
+    {
+        if (mBits) {
+            bits(1, 1);
+            while (mBits)
+                bits(1, 0);
+        }
+    }
+
+    // rbsp_trailing_bits(), then the start code and emulation prevention
+    // bytes around it all
+    void appendTo(std::vector<uint8_t>& stream)
+    {
+        bits(1, 1);
+        while (mBits)
+            bits(1, 0);
+        const uint8_t startCode[] = { 0, 0, 0, 1 };
+        stream.insert(stream.end(), startCode, startCode + sizeof(startCode));
+        int zeros = 0;
+        for (uint8_t byte : mRBSP) {
+            if (zeros == 2 && byte <= 3) {
+                stream.push_back(3);
+                zeros = 0;
+            }
+            stream.push_back(byte);
+            zeros = byte ? 0 : zeros + 1;
+        }
+    }
+
+private:
+    std::vector<uint8_t> mRBSP;
+    uint8_t mCache;
+    int mBits;
+};
+
+// 1280x720 baseline with NAL HRD parameters, the buffering_period delays
+// are 24 bits each
+static void sps(std::vector<uint8_t>& stream)
+{
+    NALUWriter nalu(3, media::H264NALU::kSPS);
+    nalu.bits(8, 66);  // profile_idc
+    nalu.bits(8, 0);   // constraint flags
+    nalu.bits(8, 31);  // level_idc
+    nalu.ue(0);        // seq_parameter_set_id
+    nalu.ue(0);        // log2_max_frame_num_minus4
+    nalu.ue(2);        // pic_order_cnt_type
+    nalu.ue(1);        // max_num_ref_frames
+    nalu.bits(1, 0);   // gaps_in_frame_num_value_allowed_flag
+    nalu.ue(79);       // pic_width_in_mbs_minus1
+    nalu.ue(44);       // pic_height_in_map_units_minus1
+    nalu.bits(1, 1);   // frame_mbs_only_flag
+    nalu.bits(1, 1);   // direct_8x8_inference_flag
+    nalu.bits(1, 0);   // frame_cropping_flag
+    nalu.bits(1, 1);   // vui_parameters_present_flag
+    nalu.bits(1, 0);   // aspect_ratio_info_present_flag
+    nalu.bits(1, 0);   // overscan_info_present_flag
+    nalu.bits(1, 0);   // video_signal_type_present_flag
+    nalu.bits(1, 0);   // chroma_loc_info_present_flag
+    nalu.bits(1, 0);   // timing_info_present_flag
+    nalu.bits(1, 1);   // nal_hrd_parameters_present_flag
+    nalu.ue(0);        // cpb_cnt_minus1
+    nalu.bits(4, 0);   // bit_rate_scale
+    nalu.bits(4, 0);   // cpb_size_scale
+    nalu.ue(1000);     // bit_rate_value_minus1
+    nalu.ue(1000);     // cpb_size_value_minus1
+    nalu.bits(1, 0);   // cbr_flag
+    nalu.bits(5, 23);  // initial_cpb_removal_delay_length_minus1
+    nalu.bits(5, 23);  // cpb_removal_delay_length_minus1
+    nalu.bits(5, 23);  // dpb_output_delay_length_minus1
+    nalu.bits(5, 24);  // time_offset_length
+    nalu.bits(1, 0);   // vcl_hrd_parameters_present_flag
+    nalu.bits(1, 0);   // low_delay_hrd_flag
+    nalu.bits(1, 0);   // pic_struct_present_flag
+    nalu.bits(1, 0);   // bitstream_restriction_flag
+    nalu.appendTo(stream);
+}
+
+static void bufferingPeriod(NALUWriter& nalu)
+{
+    nalu.bits(8, media::H264SEIMessage::kSEIBufferingPeriod);
+    nalu.bits(8, 7);        // payload_size, ue(0) and the two delays
+    nalu.ue(0);             // seq_parameter_set_id
+    nalu.bits(24, 90000);   // initial_cpb_removal_delay
+    nalu.bits(24, 0);       // initial_cpb_removal_delay_offset
+    nalu.alignPayload();
+}
+
+static void recoveryPoint(NALUWriter& nalu, int frames)
+{
+    nalu.bits(8, media::H264SEIMessage::kSEIRecoveryPoint);
+    nalu.bits(8, 2);        // payload_size
+    nalu.ue(frames);        // recovery_frame_cnt
+    nalu.bits(1, 1);        // exact_match_flag
+    nalu.bits(1, 0);        // broken_link_flag
+    nalu.bits(2, 0);        // changing_slice_group_idc
+    nalu.alignPayload();
+}
+
+// a P slice header, enough for the NALU type to count
+static void slice(std::vector<uint8_t>& stream, int nalUnitType)
+{
+    NALUWriter nalu(2, nalUnitType);
+    nalu.ue(0);  // first_mb_in_slice
+    nalu.ue(5);  // slice_type
+    nalu.appendTo(stream);
+}
+
+static RandomAccess::Type update(RandomAccess& index, const std::vector<uint8_t>& stream, uint64_t pts)
+{
+    media::H264NALUEntry nalus[16];
+    size_t count;
+    CHECK(media::H264Parser::IndexNALUs(stream.data(), stream.size(), nalus, 16, &count) == media::H264Parser::kOk);
+    return index.update(stream.data(), nalus, count, pts);
+}
+
+static void testRecoveryPoint()
+{
+    std::vector<uint8_t> stream;
+    NALUWriter sei(0, media::H264NALU::kSEIMessage);
+    recoveryPoint(sei, 3);
+    sei.appendTo(stream);
+    slice(stream, media::H264NALU::kNonIDRSlice);
+
+    RandomAccess index;
+    CHECK(update(index, stream, 1000) == RandomAccess::RecoveryPoint);
+    CHECK(index.count() == 1);
+    CHECK(index.latest()->recoveryFrames == 3);
+    CHECK(index.latest()->exact);
+    CHECK(!index.latest()->brokenLink);
+    CHECK(index.latest()->pts == 1000);
+}
+
+// where the spec puts it, behind a buffering_period in the same NALU. the
+// parser has never seen the SPS it names so it can only skip it
+static void testBufferingPeriodWithoutSPS()
+{
+    std::vector<uint8_t> stream;
+    NALUWriter sei(0, media::H264NALU::kSEIMessage);
+    bufferingPeriod(sei);
+    recoveryPoint(sei, 2);
+    sei.appendTo(stream);
+    slice(stream, media::H264NALU::kNonIDRSlice);
+
+    RandomAccess index;
+    CHECK(update(index, stream, 0) == RandomAccess::RecoveryPoint);
+    CHECK(index.latest() && index.latest()->recoveryFrames == 2);
+}
+
+// and with the SPS in the access unit the buffering_period gets decoded
+// on the way to the recovery point
+static void testBufferingPeriodWithSPS()
+{
+    std::vector<uint8_t> stream;
+    sps(stream);
+    NALUWriter sei(0, media::H264NALU::kSEIMessage);
+    bufferingPeriod(sei);
+    recoveryPoint(sei, 4);
+    sei.appendTo(stream);
+    slice(stream, media::H264NALU::kNonIDRSlice);
+
+    RandomAccess index;
+    CHECK(update(index, stream, 0) == RandomAccess::RecoveryPoint);
+    CHECK(index.latest() && index.latest()->recoveryFrames == 4);
+
+    // the same again, now the SPS is a re-send
+    CHECK(update(index, stream, 1) == RandomAccess::RecoveryPoint);
+    CHECK(index.count() == 2);
+}
+
+static void testIDRAndNone()
+{
+    std::vector<uint8_t> idr, p;
+    sps(idr);
+    slice(idr, media::H264NALU::kIDRSlice);
+    slice(p, media::H264NALU::kNonIDRSlice);
+
+    RandomAccess index;
+    CHECK(update(index, p, 0) == RandomAccess::None);
+    CHECK(!index.latest());
+    CHECK(update(index, idr, 1) == RandomAccess::IDR);
+    CHECK(update(index, p, 2) == RandomAccess::None);
+    CHECK(index.accessUnits() == 3);
+    CHECK(index.count() == 1);
+    CHECK(index.latest()->accessUnit == 1);
+    CHECK(index.latest()->recoveryFrames == 0);
+}
+
+int main()
+{
+    testRecoveryPoint();
+    testBufferingPeriodWithoutSPS();
+    testBufferingPeriodWithSPS();
+    testIDRAndNone();
+    return Test::result();
+}
@@ -64,7 +64,7 @@ void faad_initbits(bitfile *ld, const void *_buffer, const uint32_t buffer_size)
         tmp = getdword_n((uint32_t*)ld->buffer, ld->bytes_left);
         ld->bytes_left = 0;
     }
-    ld->bufa = tmp;
+    ld->cache = (uint64_t)tmp << 32;
 
     if (ld->bytes_left >= 4)
     {
@@ -74,7 +74,7 @@ void faad_initbits(bitfile *ld, const void *_buffer, const uint32_t buffer_size)
         tmp = getdword_n((uint32_t*)ld->buffer + 1, ld->bytes_left);
         ld->bytes_left = 0;
     }
-    ld->bufb = tmp;
+    ld->cache |= tmp;
 
     ld->start = (uint32_t*)ld->buffer;
     ld->tail = ((uint32_t*)ld->buffer + 2);
@@ -110,7 +110,6 @@ void faad_flushbits_ex(bitfile *ld, uint32_t bits)
 {
     uint32_t tmp;
 
-    ld->bufa = ld->bufb;
     if (ld->bytes_left >= 4)
     {
         tmp = getdword(ld->tail);
@@ -119,7 +118,7 @@ void faad_flushbits_ex(bitfile *ld, uint32_t bits)
         tmp = getdword_n(ld->tail, ld->bytes_left);
         ld->bytes_left = 0;
     }
-    ld->bufb = tmp;
+    ld->cache = (ld->cache << 32) | tmp;
     ld->tail++;
     ld->bits_left += (32 - bits);
     //ld->bytes_left -= 4;
@@ -144,7 +143,7 @@ void faad_rewindbits(bitfile *ld)
         tmp = getdword_n((uint32_t*)&ld->start[0], ld->bytes_left);
         ld->bytes_left = 0;
     }
-    ld->bufa = tmp;
+    ld->cache = (uint64_t)tmp << 32;
 
     if (ld->bytes_left >= 4)
     {
@@ -154,7 +153,7 @@ void faad_rewindbits(bitfile *ld)
         tmp = getdword_n((uint32_t*)&ld->start[1], ld->bytes_left);
         ld->bytes_left = 0;
     }
-    ld->bufb = tmp;
+    ld->cache |= tmp;
 
     ld->bits_left = 32;
     ld->tail = &ld->start[2];
@@ -177,7 +176,7 @@ void faad_resetbits(bitfile *ld, int bits)
         tmp = getdword_n(&ld->start[words], ld->bytes_left);
         ld->bytes_left = 0;
     }
-    ld->bufa = tmp;
+    ld->cache = (uint64_t)tmp << 32;
 
     if (ld->bytes_left >= 4)
     {
@@ -187,7 +186,7 @@ void faad_resetbits(bitfile *ld, int bits)
         tmp = getdword_n(&ld->start[words+1], ld->bytes_left);
         ld->bytes_left = 0;
     }
-    ld->bufb = tmp;
+    ld->cache |= tmp;
 
     ld->bits_left = 32 - remainder;
     ld->tail = &ld->start[words+2];
@@ -253,10 +252,10 @@ void faad_initbits_rev(bitfile *ld, void *buffer,
     ld->start = (uint32_t*)buffer + index - 2;
 
     tmp = getdword((uint32_t*)buffer + index);
-    ld->bufa = tmp;
+    ld->cache = (uint64_t)tmp << 32;
 
     tmp = getdword((uint32_t*)buffer + index - 1);
-    ld->bufb = tmp;
+    ld->cache |= tmp;
 
     ld->tail = (uint32_t*)buffer + index;
 
@@ -47,9 +47,9 @@ extern "C" {
 
 typedef struct _bitfile
 {
-    /* bit input */
-    uint32_t bufa;
-    uint32_t bufb;
+    /* bit input, the current word in the upper and the next one in the
+       lower 32 bits */
+    uint64_t cache;
     uint32_t bits_left;
     uint32_t buffer_size; /* size of the buffer in bytes */
     uint32_t bytes_left;
@@ -88,20 +88,26 @@ void *faad_origbitbuffer(bitfile *ld);
 uint32_t faad_origbitbuffer_size(bitfile *ld);
 #endif
 
-/* circumvent memory alignment errors on ARM */
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))
+#define faad_bswap32(x) __builtin_bswap32(x)
+#elif defined(_MSC_VER)
+#define faad_bswap32(x) _byteswap_ulong(x)
+#else
+static INLINE uint32_t faad_bswap32(uint32_t x)
+{
+    return (x >> 24) | ((x >> 8) & 0xFF00) | ((x << 8) & 0xFF0000) | (x << 24);
+}
+#endif
+
+/* circumvent memory alignment errors on ARM, memcpy becomes a single
+   unaligned load wherever the target has one */
 static INLINE uint32_t getdword(void *mem)
 {
     uint32_t tmp;
+
+    memcpy(&tmp, mem, 4);
 #ifndef ARCH_IS_BIG_ENDIAN
-    ((uint8_t*)&tmp)[0] = ((uint8_t*)mem)[3];
-    ((uint8_t*)&tmp)[1] = ((uint8_t*)mem)[2];
-    ((uint8_t*)&tmp)[2] = ((uint8_t*)mem)[1];
-    ((uint8_t*)&tmp)[3] = ((uint8_t*)mem)[0];
-#else
-    ((uint8_t*)&tmp)[0] = ((uint8_t*)mem)[0];
-    ((uint8_t*)&tmp)[1] = ((uint8_t*)mem)[1];
-    ((uint8_t*)&tmp)[2] = ((uint8_t*)mem)[2];
-    ((uint8_t*)&tmp)[3] = ((uint8_t*)mem)[3];
+    tmp = faad_bswap32(tmp);
 #endif
 
     return tmp;
@@ -140,17 +146,11 @@ static /*INLINE*/ uint32_t getdword_n(void *mem, int n)
     return tmp;
 }
 
+/* there are always at least 33 bits in the cache, no need to look at
+   where the word boundary is */
 static INLINE uint32_t faad_showbits(bitfile *ld, uint32_t bits)
 {
-    if (bits <= ld->bits_left)
-    {
-        //return (ld->bufa >> (ld->bits_left - bits)) & bitmask[bits];
-        return (ld->bufa << (32 - ld->bits_left)) >> (32 - bits);
-    }
-
-    bits -= ld->bits_left;
-    //return ((ld->bufa & bitmask[ld->bits_left]) << bits) | (ld->bufb >> (32 - bits));
-    return ((ld->bufa & ((1<<ld->bits_left)-1)) << bits) | (ld->bufb >> (32 - bits));
+    return (uint32_t)((ld->cache << (32 - ld->bits_left)) >> (64 - bits));
 }
 
 static INLINE void faad_flushbits(bitfile *ld, uint32_t bits)
@@ -162,7 +162,13 @@ static INLINE void faad_flushbits(bitfile *ld, uint32_t bits)
     if (bits < ld->bits_left)
     {
         ld->bits_left -= bits;
+    } else if (ld->bytes_left >= 4) {
+        ld->cache = (ld->cache << 32) | getdword(ld->tail);
+        ld->bytes_left -= 4;
+        ld->tail++;
+        ld->bits_left += (32 - bits);
     } else {
+        /* the last few bytes of the buffer */
         faad_flushbits_ex(ld, bits);
     }
 }
@@ -193,13 +199,13 @@ static INLINE uint8_t faad_get1bit(bitfile *ld DEBUGDEC)
     if (ld->bits_left > 0)
     {
         ld->bits_left--;
-        r = (uint8_t)((ld->bufa >> ld->bits_left) & 1);
+        r = (uint8_t)((ld->cache >> (32 + ld->bits_left)) & 1);
         return r;
     }
 
     /* bits_left == 0 */
 #if 0
-    r = (uint8_t)(ld->bufb >> 31);
+    r = (uint8_t)((ld->cache >> 31) & 1);
     faad_flushbits_ex(ld, 1);
 #else
     r = (uint8_t)faad_getbits(ld, 1);
@@ -212,24 +218,26 @@ static INLINE uint32_t faad_showbits_rev(bitfile *ld, uint32_t bits)
 {
     uint8_t i;
     uint32_t B = 0;
+    uint32_t bufa = (uint32_t)(ld->cache >> 32);
+    uint32_t bufb = (uint32_t)ld->cache;
 
     if (bits <= ld->bits_left)
     {
         for (i = 0; i < bits; i++)
         {
-            if (ld->bufa & (1 << (i + (32 - ld->bits_left))))
+            if (bufa & (1 << (i + (32 - ld->bits_left))))
                 B |= (1 << (bits - i - 1));
         }
         return B;
     } else {
         for (i = 0; i < ld->bits_left; i++)
         {
-            if (ld->bufa & (1 << (i + (32 - ld->bits_left))))
+            if (bufa & (1 << (i + (32 - ld->bits_left))))
                 B |= (1 << (bits - i - 1));
         }
         for (i = 0; i < bits - ld->bits_left; i++)
         {
-            if (ld->bufb & (1 << (i + (32-ld->bits_left))))
+            if (bufb & (1 << (i + (32-ld->bits_left))))
                 B |= (1 << (bits - ld->bits_left - i - 1));
         }
         return B;
@@ -246,11 +254,7 @@ static INLINE void faad_flushbits_rev(bitfile *ld, uint32_t bits)
     {
         ld->bits_left -= bits;
     } else {
-        uint32_t tmp;
-
-        ld->bufa = ld->bufb;
-        tmp = getdword(ld->start);
-        ld->bufb = tmp;
+        ld->cache = (ld->cache << 32) | getdword(ld->start);
         ld->start--;
         ld->bits_left += (32 - bits);
 
@@ -41,9 +41,13 @@
 #include "structs.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "cfft.h"
 #include "cfft_tab.h"
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+#include "simd.h"
+#endif
 
 
 /* static function declarations */
@@ -850,6 +854,139 @@ static INLINE void cfftf1neg(uint16_t n, complex_t *c, complex_t *ch,
     }
 }
 
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+/*----------------------------------------------------------------------
+   passf2pos, passf4pos and cfftb for SIMD. Two complex values at a time,
+   the operations are the same as above in the same order.
+  ----------------------------------------------------------------------*/
+
+/* ido is even */
+static void passf2pos_simd(const uint16_t ido, const uint16_t l1, const complex_t *cc,
+                           complex_t *ch, const complex_t *wa)
+{
+    uint16_t i, k, ah, ac;
+
+    for (k = 0; k < l1; k++)
+    {
+        ah = k*ido;
+        ac = 2*k*ido;
+
+        for (i = 0; i < ido; i += 2)
+        {
+            vec4_t a = vec_load(cc[ac+i]);
+            vec4_t b = vec_load(cc[ac+i+ido]);
+
+            vec_store(ch[ah+i], vec_add(a, b));
+            vec_store(ch[ah+i+l1*ido], vec_cmul(vec_sub(a, b), vec_load(wa[i])));
+        }
+    }
+}
+
+/* ido is 1 and l1 even, or ido is even */
+static void passf4pos_simd(const uint16_t ido, const uint16_t l1, const complex_t *cc,
+                           complex_t *ch, const complex_t *wa1, const complex_t *wa2,
+                           const complex_t *wa3)
+{
+    uint16_t i, k, ac, ah;
+
+    if (ido == 1)
+    {
+        /* the four inputs of k and k+1 are next to each other */
+        for (k = 0; k < l1; k += 2)
+        {
+            vec4_t v0, v1, v2, v3, a0, a1, a2, a3, t1, t2, t3, t4;
+
+            ac = 4*k;
+            ah = k;
+
+            v0 = vec_load(cc[ac]);
+            v1 = vec_load(cc[ac+2]);
+            v2 = vec_load(cc[ac+4]);
+            v3 = vec_load(cc[ac+6]);
+            a0 = vec_lo(v0, v2);
+            a1 = vec_hi(v0, v2);
+            a2 = vec_lo(v1, v3);
+            a3 = vec_hi(v1, v3);
+
+            t2 = vec_add(a0, a2);
+            t1 = vec_sub(a0, a2);
+            t3 = vec_add(a1, a3);
+            t4 = vec_mul_i(vec_sub(a1, a3));
+
+            vec_store(ch[ah],      vec_add(t2, t3));
+            vec_store(ch[ah+2*l1], vec_sub(t2, t3));
+            vec_store(ch[ah+l1],   vec_add(t1, t4));
+            vec_store(ch[ah+3*l1], vec_sub(t1, t4));
+        }
+    } else {
+        for (k = 0; k < l1; k++)
+        {
+            ac = 4*k*ido;
+            ah = k*ido;
+
+            for (i = 0; i < ido; i += 2)
+            {
+                vec4_t a0, a1, a2, a3, t1, t2, t3, t4;
+
+                a0 = vec_load(cc[ac+i]);
+                a1 = vec_load(cc[ac+i+ido]);
+                a2 = vec_load(cc[ac+i+2*ido]);
+                a3 = vec_load(cc[ac+i+3*ido]);
+
+                t2 = vec_add(a0, a2);
+                t1 = vec_sub(a0, a2);
+                t3 = vec_add(a1, a3);
+                t4 = vec_mul_i(vec_sub(a1, a3));
+
+                vec_store(ch[ah+i], vec_add(t2, t3));
+                vec_store(ch[ah+i+l1*ido],
+                    vec_cmul(vec_add(t1, t4), vec_load(wa1[i])));
+                vec_store(ch[ah+i+2*l1*ido],
+                    vec_cmul(vec_sub(t2, t3), vec_load(wa2[i])));
+                vec_store(ch[ah+i+3*l1*ido],
+                    vec_cmul(vec_sub(t1, t4), vec_load(wa3[i])));
+            }
+        }
+    }
+}
+
+/* only for powers of two from 8 up, all passes are radix 2 or 4 then
+   with an even ido or, for the last one, an even l1 */
+static void cfftb_simd(cfft_info *cfft, complex_t *c)
+{
+    const uint16_t n = cfft->n;
+    const uint16_t *ifac = cfft->ifac;
+    const complex_t *wa = cfft->tab;
+    complex_t *in = c, *out = cfft->work, *tmp;
+    uint16_t k1, l1, l2, ip, iw, ido;
+
+    l1 = 1;
+    iw = 0;
+
+    for (k1 = 2; k1 <= ifac[1]+1; k1++)
+    {
+        ip = ifac[k1];
+        l2 = ip*l1;
+        ido = n / l2;
+
+        if (ip == 4)
+            passf4pos_simd(ido, l1, in, out, &wa[iw], &wa[iw+ido], &wa[iw+2*ido]);
+        else
+            passf2pos_simd(ido, l1, in, out, &wa[iw]);
+
+        tmp = in;
+        in = out;
+        out = tmp;
+
+        l1 = l2;
+        iw += (ip-1) * ido;
+    }
+
+    if (in != c)
+        memcpy(c, in, n*sizeof(complex_t));
+}
+#endif
+
 void cfftf(cfft_info *cfft, complex_t *c)
 {
     cfftf1neg(cfft->n, c, cfft->work, (const uint16_t*)cfft->ifac, (const complex_t*)cfft->tab, -1);
@@ -857,6 +994,13 @@ void cfftf(cfft_info *cfft, complex_t *c)
 
 void cfftb(cfft_info *cfft, complex_t *c)
 {
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+    if (cfft->simd)
+    {
+        cfftb_simd(cfft, c);
+        return;
+    }
+#endif
     cfftf1pos(cfft->n, c, cfft->work, (const uint16_t*)cfft->ifac, (const complex_t*)cfft->tab, +1);
 }
 
@@ -963,6 +1107,11 @@ cfft_info *cffti(uint16_t n)
 
     cfft->n = n;
     cfft->work = (complex_t*)faad_malloc(n*sizeof(complex_t));
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+    cfft->simd = (n >= 8 && (n & (n - 1)) == 0);
+#else
+    cfft->simd = 0;
+#endif
 
 #ifndef FIXED_POINT
     cfft->tab = (complex_t*)faad_malloc(n*sizeof(complex_t));
@@ -41,6 +41,8 @@ typedef struct
     uint16_t ifac[15];
     complex_t *work;
     complex_t *tab;
+    /* cfftb uses the SIMD passes, set by cffti for the sizes they can do */
+    uint8_t simd;
 } cfft_info;
 
 
@@ -66,6 +66,9 @@ extern "C" {
  *    HCB_11     2-Step
  *    HCB_SF     Binary
  *
+ *   In front of both, the spectral data codebooks have single lookup
+ *   tables that decode the shorter codewords and their sign bits in one
+ *   step, see hcb_fast.h
  */
 
 
@@ -124,6 +127,9 @@ uint8_t unsigned_cb[];
 int hcb_2_quad_table_size[];
 int hcb_2_pair_table_size[];
 int hcb_bin_table_size[];
+hcb_2_quad *hcb_fast_quad_table[];
+hcb_2_pair *hcb_fast_pair_table[];
+uint8_t hcb_fast_bits[];
 
 #include "codebook/hcb_1.h"
 #include "codebook/hcb_2.h"
@@ -137,6 +143,7 @@ int hcb_bin_table_size[];
 #include "codebook/hcb_10.h"
 #include "codebook/hcb_11.h"
 #include "codebook/hcb_sf.h"
+#include "codebook/hcb_fast.h"
 
 
 #ifdef __cplusplus
@@ -0,0 +1,2775 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**  
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software 
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**
+** $Id: hcb_fast.h $
+**/
+
+/* Single lookup tables for the spectral data codebooks
+ *
+ * Indexed with the next hcb_fast_bits[cb] bits of the bitstream. An entry
+ * is the whole codeword decoded: the values with their sign bits applied
+ * for the unsigned codebooks, and in bits the length of the codeword plus
+ * the sign bits. bits is 0 when that doesn't fit in the index, decoding
+ * falls back to the 2-step or binary search tables then.
+ *
+ * Derived from the tables of HCB_1 to HCB_11, by running their decoders on
+ * every possible index. Escapes in HCB_11 come out as +-16 and are read
+ * after the lookup as before.
+ */
+
+/* HCB_1, 9 bits, 504 of 512 entries decode in one step */
+static hcb_2_quad hcb1_fast[] = {
+    /*    0 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*    4 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*    8 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   12 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   16 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   20 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   24 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   28 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   32 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   36 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   40 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   44 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   48 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   52 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   56 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   60 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   64 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   68 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   72 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   76 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   80 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   84 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   88 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   92 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   96 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  100 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  104 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  108 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  112 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  116 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  120 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  124 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  128 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  132 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  136 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  140 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  144 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  148 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  152 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  156 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  160 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  164 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  168 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  172 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  176 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  180 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  184 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  188 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  192 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  196 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  200 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  204 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  208 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  212 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  216 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  220 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  224 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  228 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  232 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  236 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  240 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  244 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  248 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  252 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  256 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  260 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  264 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  268 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  272 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  276 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  280 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  284 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  288 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /*  292 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /*  296 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /*  300 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /*  304 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /*  308 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /*  312 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /*  316 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /*  320 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /*  324 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /*  328 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /*  332 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /*  336 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /*  340 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /*  344 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /*  348 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /*  352 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /*  356 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /*  360 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /*  364 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /*  368 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /*  372 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /*  376 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /*  380 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /*  384 */ {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 },
+    /*  388 */ {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 },
+    /*  392 */ {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 },
+    /*  396 */ {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 },
+    /*  400 */ {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 },
+    /*  404 */ {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 },
+    /*  408 */ {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 },
+    /*  412 */ {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 },
+    /*  416 */ {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 },
+    /*  420 */ {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 },
+    /*  424 */ {  7,  1,  0, -1,  0 }, {  7,  1,  0, -1,  0 }, {  7,  1,  0, -1,  0 }, {  7,  1,  0, -1,  0 },
+    /*  428 */ {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 },
+    /*  432 */ {  7, -1,  0,  1,  0 }, {  7, -1,  0,  1,  0 }, {  7, -1,  0,  1,  0 }, {  7, -1,  0,  1,  0 },
+    /*  436 */ {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 },
+    /*  440 */ {  7,  1,  0,  1,  0 }, {  7,  1,  0,  1,  0 }, {  7,  1,  0,  1,  0 }, {  7,  1,  0,  1,  0 },
+    /*  444 */ {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 },
+    /*  448 */ {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 },
+    /*  452 */ {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 },
+    /*  456 */ {  7, -1,  0, -1,  0 }, {  7, -1,  0, -1,  0 }, {  7, -1,  0, -1,  0 }, {  7, -1,  0, -1,  0 },
+    /*  460 */ {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 },
+    /*  464 */ {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 },
+    /*  468 */ {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 },
+    /*  472 */ {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 },
+    /*  476 */ {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 },
+    /*  480 */ {  9,  1,  1, -1,  0 }, {  9, -1,  1, -1,  0 }, {  9,  1, -1,  1,  0 }, {  9,  0,  1,  1, -1 },
+    /*  484 */ {  9,  0,  1, -1,  1 }, {  9,  0, -1,  1,  1 }, {  9,  0, -1,  1, -1 }, {  9,  1, -1, -1,  0 },
+    /*  488 */ {  9,  1,  0, -1,  1 }, {  9,  0,  1, -1, -1 }, {  9, -1,  1,  1,  0 }, {  9, -1,  0,  1, -1 },
+    /*  492 */ {  9, -1, -1,  1,  0 }, {  9,  0, -1, -1,  1 }, {  9,  1, -1,  0,  1 }, {  9,  1, -1,  0, -1 },
+    /*  496 */ {  9, -1,  1,  0, -1 }, {  9, -1, -1, -1,  0 }, {  9,  0, -1, -1, -1 }, {  9,  0,  1,  1,  1 },
+    /*  500 */ {  9,  1,  0,  1, -1 }, {  9,  1,  1,  0,  1 }, {  9, -1,  1,  0,  1 }, {  9,  1,  1,  1,  0 },
+    /*  504 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /*  508 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }
+};
+
+/* HCB_2, 9 bits, 512 of 512 entries decode in one step */
+static hcb_2_quad hcb2_fast[] = {
+    /*    0 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*    4 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*    8 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   12 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   16 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   20 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   24 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   28 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   32 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   36 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   40 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   44 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   48 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   52 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   56 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   60 */ {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 }, {  3,  0,  0,  0,  0 },
+    /*   64 */ {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 },
+    /*   68 */ {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 },
+    /*   72 */ {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 },
+    /*   76 */ {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 },
+    /*   80 */ {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 },
+    /*   84 */ {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 },
+    /*   88 */ {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 },
+    /*   92 */ {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 }, {  4,  1,  0,  0,  0 },
+    /*   96 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  100 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  104 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  108 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  112 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /*  116 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /*  120 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /*  124 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /*  128 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /*  132 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /*  136 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /*  140 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /*  144 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /*  148 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /*  152 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /*  156 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /*  160 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /*  164 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /*  168 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /*  172 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /*  176 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /*  180 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /*  184 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /*  188 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /*  192 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /*  196 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /*  200 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /*  204 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /*  208 */ {  6,  0, -1,  1,  0 }, {  6,  0, -1,  1,  0 }, {  6,  0, -1,  1,  0 }, {  6,  0, -1,  1,  0 },
+    /*  212 */ {  6,  0, -1,  1,  0 }, {  6,  0, -1,  1,  0 }, {  6,  0, -1,  1,  0 }, {  6,  0, -1,  1,  0 },
+    /*  216 */ {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 },
+    /*  220 */ {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 },
+    /*  224 */ {  6,  0,  1, -1,  0 }, {  6,  0,  1, -1,  0 }, {  6,  0,  1, -1,  0 }, {  6,  0,  1, -1,  0 },
+    /*  228 */ {  6,  0,  1, -1,  0 }, {  6,  0,  1, -1,  0 }, {  6,  0,  1, -1,  0 }, {  6,  0,  1, -1,  0 },
+    /*  232 */ {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 },
+    /*  236 */ {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 },
+    /*  240 */ {  6,  0,  1,  0, -1 }, {  6,  0,  1,  0, -1 }, {  6,  0,  1,  0, -1 }, {  6,  0,  1,  0, -1 },
+    /*  244 */ {  6,  0,  1,  0, -1 }, {  6,  0,  1,  0, -1 }, {  6,  0,  1,  0, -1 }, {  6,  0,  1,  0, -1 },
+    /*  248 */ {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 },
+    /*  252 */ {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 },
+    /*  256 */ {  6, -1,  0,  0, -1 }, {  6, -1,  0,  0, -1 }, {  6, -1,  0,  0, -1 }, {  6, -1,  0,  0, -1 },
+    /*  260 */ {  6, -1,  0,  0, -1 }, {  6, -1,  0,  0, -1 }, {  6, -1,  0,  0, -1 }, {  6, -1,  0,  0, -1 },
+    /*  264 */ {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 },
+    /*  268 */ {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 },
+    /*  272 */ {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 },
+    /*  276 */ {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 },
+    /*  280 */ {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 },
+    /*  284 */ {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 },
+    /*  288 */ {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 },
+    /*  292 */ {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 },
+    /*  296 */ {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 },
+    /*  300 */ {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 },
+    /*  304 */ {  6,  1,  0,  0,  1 }, {  6,  1,  0,  0,  1 }, {  6,  1,  0,  0,  1 }, {  6,  1,  0,  0,  1 },
+    /*  308 */ {  6,  1,  0,  0,  1 }, {  6,  1,  0,  0,  1 }, {  6,  1,  0,  0,  1 }, {  6,  1,  0,  0,  1 },
+    /*  312 */ {  6,  0, -1,  0,  1 }, {  6,  0, -1,  0,  1 }, {  6,  0, -1,  0,  1 }, {  6,  0, -1,  0,  1 },
+    /*  316 */ {  6,  0, -1,  0,  1 }, {  6,  0, -1,  0,  1 }, {  6,  0, -1,  0,  1 }, {  6,  0, -1,  0,  1 },
+    /*  320 */ {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 },
+    /*  324 */ {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 },
+    /*  328 */ {  6,  0,  1,  0,  1 }, {  6,  0,  1,  0,  1 }, {  6,  0,  1,  0,  1 }, {  6,  0,  1,  0,  1 },
+    /*  332 */ {  6,  0,  1,  0,  1 }, {  6,  0,  1,  0,  1 }, {  6,  0,  1,  0,  1 }, {  6,  0,  1,  0,  1 },
+    /*  336 */ {  6,  0, -1, -1,  0 }, {  6,  0, -1, -1,  0 }, {  6,  0, -1, -1,  0 }, {  6,  0, -1, -1,  0 },
+    /*  340 */ {  6,  0, -1, -1,  0 }, {  6,  0, -1, -1,  0 }, {  6,  0, -1, -1,  0 }, {  6,  0, -1, -1,  0 },
+    /*  344 */ {  6, -1,  0,  0,  1 }, {  6, -1,  0,  0,  1 }, {  6, -1,  0,  0,  1 }, {  6, -1,  0,  0,  1 },
+    /*  348 */ {  6, -1,  0,  0,  1 }, {  6, -1,  0,  0,  1 }, {  6, -1,  0,  0,  1 }, {  6, -1,  0,  0,  1 },
+    /*  352 */ {  6,  0, -1,  0, -1 }, {  6,  0, -1,  0, -1 }, {  6,  0, -1,  0, -1 }, {  6,  0, -1,  0, -1 },
+    /*  356 */ {  6,  0, -1,  0, -1 }, {  6,  0, -1,  0, -1 }, {  6,  0, -1,  0, -1 }, {  6,  0, -1,  0, -1 },
+    /*  360 */ {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 },
+    /*  364 */ {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 },
+    /*  368 */ {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 },
+    /*  372 */ {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 },
+    /*  376 */ {  6,  0,  1,  1,  0 }, {  6,  0,  1,  1,  0 }, {  6,  0,  1,  1,  0 }, {  6,  0,  1,  1,  0 },
+    /*  380 */ {  6,  0,  1,  1,  0 }, {  6,  0,  1,  1,  0 }, {  6,  0,  1,  1,  0 }, {  6,  0,  1,  1,  0 },
+    /*  384 */ {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 },
+    /*  388 */ {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 },
+    /*  392 */ {  6,  1,  0,  0, -1 }, {  6,  1,  0,  0, -1 }, {  6,  1,  0,  0, -1 }, {  6,  1,  0,  0, -1 },
+    /*  396 */ {  6,  1,  0,  0, -1 }, {  6,  1,  0,  0, -1 }, {  6,  1,  0,  0, -1 }, {  6,  1,  0,  0, -1 },
+    /*  400 */ {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 },
+    /*  404 */ {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 },
+    /*  408 */ {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 },
+    /*  412 */ {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 },
+    /*  416 */ {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 },
+    /*  420 */ {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 },
+    /*  424 */ {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 },
+    /*  428 */ {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 },
+    /*  432 */ {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 },
+    /*  436 */ {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 },
+    /*  440 */ {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 },
+    /*  444 */ {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 },
+    /*  448 */ {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 },
+    /*  452 */ {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 },
+    /*  456 */ {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 },
+    /*  460 */ {  8,  1, -1,  0,  1 }, {  8,  1, -1,  0,  1 }, {  8, -1,  1,  0, -1 }, {  8, -1,  1,  0, -1 },
+    /*  464 */ {  8, -1, -1,  1,  0 }, {  8, -1, -1,  1,  0 }, {  8, -1,  0,  1,  1 }, {  8, -1,  0,  1,  1 },
+    /*  468 */ {  8, -1, -1,  0,  1 }, {  8, -1, -1,  0,  1 }, {  8, -1, -1,  0, -1 }, {  8, -1, -1,  0, -1 },
+    /*  472 */ {  8,  0, -1, -1, -1 }, {  8,  0, -1, -1, -1 }, {  8,  1,  0,  1, -1 }, {  8,  1,  0,  1, -1 },
+    /*  476 */ {  8,  1,  0, -1, -1 }, {  8,  1,  0, -1, -1 }, {  8,  0,  1, -1, -1 }, {  8,  0,  1, -1, -1 },
+    /*  480 */ {  8,  0,  1,  1,  1 }, {  8,  0,  1,  1,  1 }, {  8, -1,  1,  0,  1 }, {  8, -1,  1,  0,  1 },
+    /*  484 */ {  8, -1,  0, -1, -1 }, {  8, -1,  0, -1, -1 }, {  8,  0,  1,  1, -1 }, {  8,  0,  1,  1, -1 },
+    /*  488 */ {  8,  1, -1,  0, -1 }, {  8,  1, -1,  0, -1 }, {  8,  0, -1,  1,  1 }, {  8,  0, -1,  1,  1 },
+    /*  492 */ {  8,  1,  1,  0,  1 }, {  8,  1,  1,  0,  1 }, {  8,  1, -1,  1, -1 }, {  8,  1, -1,  1, -1 },
+    /*  496 */ {  8, -1,  1, -1,  1 }, {  8, -1,  1, -1,  1 }, {  9,  1, -1, -1,  1 }, {  9, -1, -1, -1, -1 },
+    /*  500 */ {  9, -1,  1,  1, -1 }, {  9, -1,  1,  1,  1 }, {  9,  1,  1,  1,  1 }, {  9, -1, -1,  1, -1 },
+    /*  504 */ {  9,  1, -1,  1,  1 }, {  9, -1,  1, -1, -1 }, {  9, -1, -1,  1,  1 }, {  9,  1,  1, -1, -1 },
+    /*  508 */ {  9,  1, -1, -1, -1 }, {  9, -1, -1, -1,  1 }, {  9,  1,  1, -1,  1 }, {  9,  1,  1,  1, -1 }
+};
+
+/* HCB_3, 11 bits, 1976 of 2048 entries decode in one step */
+static hcb_2_quad hcb3_fast[] = {
+    /*    0 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*    4 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*    8 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   12 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   16 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   20 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   24 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   28 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   32 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   36 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   40 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   44 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   48 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   52 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   56 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   60 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   64 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   68 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   72 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   76 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   80 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   84 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   88 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   92 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*   96 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  100 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  104 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  108 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  112 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  116 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  120 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  124 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  128 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  132 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  136 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  140 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  144 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  148 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  152 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  156 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  160 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  164 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  168 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  172 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  176 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  180 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  184 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  188 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  192 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  196 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  200 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  204 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  208 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  212 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  216 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  220 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  224 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  228 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  232 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  236 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  240 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  244 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  248 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  252 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  256 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  260 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  264 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  268 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  272 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  276 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  280 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  284 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  288 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  292 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  296 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  300 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  304 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  308 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  312 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  316 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  320 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  324 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  328 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  332 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  336 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  340 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  344 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  348 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  352 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  356 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  360 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  364 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  368 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  372 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  376 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  380 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  384 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  388 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  392 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  396 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  400 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  404 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  408 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  412 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  416 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  420 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  424 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  428 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  432 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  436 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  440 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  444 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  448 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  452 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  456 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  460 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  464 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  468 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  472 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  476 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  480 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  484 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  488 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  492 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  496 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  500 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  504 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  508 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  512 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  516 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  520 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  524 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  528 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  532 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  536 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  540 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  544 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  548 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  552 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  556 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  560 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  564 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  568 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  572 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  576 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  580 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  584 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  588 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  592 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  596 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  600 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  604 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  608 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  612 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  616 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  620 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  624 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  628 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  632 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  636 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  640 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  644 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  648 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  652 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  656 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  660 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  664 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  668 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  672 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  676 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  680 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  684 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  688 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  692 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  696 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  700 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  704 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  708 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  712 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  716 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  720 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  724 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  728 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  732 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  736 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  740 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  744 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  748 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  752 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  756 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  760 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  764 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  768 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  772 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  776 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  780 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  784 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  788 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  792 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  796 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  800 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  804 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  808 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  812 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  816 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  820 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  824 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  828 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  832 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  836 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  840 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  844 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  848 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  852 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  856 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  860 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  864 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  868 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  872 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  876 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  880 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  884 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  888 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  892 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  896 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  900 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  904 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  908 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  912 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  916 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  920 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  924 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  928 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  932 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  936 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  940 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  944 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  948 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  952 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  956 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  960 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  964 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  968 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  972 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  976 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  980 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  984 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  988 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  992 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /*  996 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /* 1000 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /* 1004 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /* 1008 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /* 1012 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /* 1016 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /* 1020 */ {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 }, {  1,  0,  0,  0,  0 },
+    /* 1024 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1028 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1032 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1036 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1040 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1044 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1048 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1052 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1056 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1060 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1064 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1068 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1072 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1076 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1080 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1084 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /* 1088 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1092 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1096 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1100 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1104 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1108 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1112 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1116 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1120 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1124 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1128 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1132 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1136 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1140 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1144 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1148 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /* 1152 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1156 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1160 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1164 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1168 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1172 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1176 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1180 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1184 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1188 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1192 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1196 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1200 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1204 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1208 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1212 */ {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 }, {  5,  0,  0,  0,  1 },
+    /* 1216 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1220 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1224 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1228 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1232 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1236 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1240 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1244 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1248 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1252 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1256 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1260 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1264 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1268 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1272 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1276 */ {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 }, {  5,  0,  0,  0, -1 },
+    /* 1280 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1284 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1288 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1292 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1296 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1300 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1304 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1308 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1312 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1316 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1320 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1324 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1328 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1332 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1336 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1340 */ {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 }, {  5,  0,  1,  0,  0 },
+    /* 1344 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1348 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1352 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1356 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1360 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1364 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1368 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1372 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1376 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1380 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1384 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1388 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1392 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1396 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1400 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1404 */ {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 }, {  5,  0, -1,  0,  0 },
+    /* 1408 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1412 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1416 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1420 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1424 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1428 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1432 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1436 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1440 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1444 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1448 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1452 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1456 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1460 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1464 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1468 */ {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 }, {  5,  0,  0,  1,  0 },
+    /* 1472 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1476 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1480 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1484 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1488 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1492 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1496 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1500 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1504 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1508 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1512 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1516 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1520 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1524 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1528 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1532 */ {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 }, {  5,  0,  0, -1,  0 },
+    /* 1536 */ {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 },
+    /* 1540 */ {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 },
+    /* 1544 */ {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 },
+    /* 1548 */ {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 }, {  7,  1,  1,  0,  0 },
+    /* 1552 */ {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 },
+    /* 1556 */ {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 },
+    /* 1560 */ {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 },
+    /* 1564 */ {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 }, {  7,  1, -1,  0,  0 },
+    /* 1568 */ {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 },
+    /* 1572 */ {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 },
+    /* 1576 */ {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 },
+    /* 1580 */ {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 }, {  7, -1,  1,  0,  0 },
+    /* 1584 */ {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 },
+    /* 1588 */ {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 },
+    /* 1592 */ {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 },
+    /* 1596 */ {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 }, {  7, -1, -1,  0,  0 },
+    /* 1600 */ {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 },
+    /* 1604 */ {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 },
+    /* 1608 */ {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 },
+    /* 1612 */ {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 }, {  7,  0,  0,  1,  1 },
+    /* 1616 */ {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 },
+    /* 1620 */ {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 },
+    /* 1624 */ {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 },
+    /* 1628 */ {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 }, {  7,  0,  0,  1, -1 },
+    /* 1632 */ {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 },
+    /* 1636 */ {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 },
+    /* 1640 */ {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 },
+    /* 1644 */ {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 }, {  7,  0,  0, -1,  1 },
+    /* 1648 */ {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 },
+    /* 1652 */ {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 },
+    /* 1656 */ {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 },
+    /* 1660 */ {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 }, {  7,  0,  0, -1, -1 },
+    /* 1664 */ {  8,  0,  1,  1,  0 }, {  8,  0,  1,  1,  0 }, {  8,  0,  1,  1,  0 }, {  8,  0,  1,  1,  0 },
+    /* 1668 */ {  8,  0,  1,  1,  0 }, {  8,  0,  1,  1,  0 }, {  8,  0,  1,  1,  0 }, {  8,  0,  1,  1,  0 },
+    /* 1672 */ {  8,  0,  1, -1,  0 }, {  8,  0,  1, -1,  0 }, {  8,  0,  1, -1,  0 }, {  8,  0,  1, -1,  0 },
+    /* 1676 */ {  8,  0,  1, -1,  0 }, {  8,  0,  1, -1,  0 }, {  8,  0,  1, -1,  0 }, {  8,  0,  1, -1,  0 },
+    /* 1680 */ {  8,  0, -1,  1,  0 }, {  8,  0, -1,  1,  0 }, {  8,  0, -1,  1,  0 }, {  8,  0, -1,  1,  0 },
+    /* 1684 */ {  8,  0, -1,  1,  0 }, {  8,  0, -1,  1,  0 }, {  8,  0, -1,  1,  0 }, {  8,  0, -1,  1,  0 },
+    /* 1688 */ {  8,  0, -1, -1,  0 }, {  8,  0, -1, -1,  0 }, {  8,  0, -1, -1,  0 }, {  8,  0, -1, -1,  0 },
+    /* 1692 */ {  8,  0, -1, -1,  0 }, {  8,  0, -1, -1,  0 }, {  8,  0, -1, -1,  0 }, {  8,  0, -1, -1,  0 },
+    /* 1696 */ {  8,  0,  1,  0,  1 }, {  8,  0,  1,  0,  1 }, {  8,  0,  1,  0,  1 }, {  8,  0,  1,  0,  1 },
+    /* 1700 */ {  8,  0,  1,  0,  1 }, {  8,  0,  1,  0,  1 }, {  8,  0,  1,  0,  1 }, {  8,  0,  1,  0,  1 },
+    /* 1704 */ {  8,  0,  1,  0, -1 }, {  8,  0,  1,  0, -1 }, {  8,  0,  1,  0, -1 }, {  8,  0,  1,  0, -1 },
+    /* 1708 */ {  8,  0,  1,  0, -1 }, {  8,  0,  1,  0, -1 }, {  8,  0,  1,  0, -1 }, {  8,  0,  1,  0, -1 },
+    /* 1712 */ {  8,  0, -1,  0,  1 }, {  8,  0, -1,  0,  1 }, {  8,  0, -1,  0,  1 }, {  8,  0, -1,  0,  1 },
+    /* 1716 */ {  8,  0, -1,  0,  1 }, {  8,  0, -1,  0,  1 }, {  8,  0, -1,  0,  1 }, {  8,  0, -1,  0,  1 },
+    /* 1720 */ {  8,  0, -1,  0, -1 }, {  8,  0, -1,  0, -1 }, {  8,  0, -1,  0, -1 }, {  8,  0, -1,  0, -1 },
+    /* 1724 */ {  8,  0, -1,  0, -1 }, {  8,  0, -1,  0, -1 }, {  8,  0, -1,  0, -1 }, {  8,  0, -1,  0, -1 },
+    /* 1728 */ {  8,  1,  0,  1,  0 }, {  8,  1,  0,  1,  0 }, {  8,  1,  0,  1,  0 }, {  8,  1,  0,  1,  0 },
+    /* 1732 */ {  8,  1,  0,  1,  0 }, {  8,  1,  0,  1,  0 }, {  8,  1,  0,  1,  0 }, {  8,  1,  0,  1,  0 },
+    /* 1736 */ {  8,  1,  0, -1,  0 }, {  8,  1,  0, -1,  0 }, {  8,  1,  0, -1,  0 }, {  8,  1,  0, -1,  0 },
+    /* 1740 */ {  8,  1,  0, -1,  0 }, {  8,  1,  0, -1,  0 }, {  8,  1,  0, -1,  0 }, {  8,  1,  0, -1,  0 },
+    /* 1744 */ {  8, -1,  0,  1,  0 }, {  8, -1,  0,  1,  0 }, {  8, -1,  0,  1,  0 }, {  8, -1,  0,  1,  0 },
+    /* 1748 */ {  8, -1,  0,  1,  0 }, {  8, -1,  0,  1,  0 }, {  8, -1,  0,  1,  0 }, {  8, -1,  0,  1,  0 },
+    /* 1752 */ {  8, -1,  0, -1,  0 }, {  8, -1,  0, -1,  0 }, {  8, -1,  0, -1,  0 }, {  8, -1,  0, -1,  0 },
+    /* 1756 */ {  8, -1,  0, -1,  0 }, {  8, -1,  0, -1,  0 }, {  8, -1,  0, -1,  0 }, {  8, -1,  0, -1,  0 },
+    /* 1760 */ {  9,  0,  1,  1,  1 }, {  9,  0,  1,  1,  1 }, {  9,  0,  1,  1,  1 }, {  9,  0,  1,  1,  1 },
+    /* 1764 */ {  9,  0,  1,  1, -1 }, {  9,  0,  1,  1, -1 }, {  9,  0,  1,  1, -1 }, {  9,  0,  1,  1, -1 },
+    /* 1768 */ {  9,  0,  1, -1,  1 }, {  9,  0,  1, -1,  1 }, {  9,  0,  1, -1,  1 }, {  9,  0,  1, -1,  1 },
+    /* 1772 */ {  9,  0,  1, -1, -1 }, {  9,  0,  1, -1, -1 }, {  9,  0,  1, -1, -1 }, {  9,  0,  1, -1, -1 },
+    /* 1776 */ {  9,  0, -1,  1,  1 }, {  9,  0, -1,  1,  1 }, {  9,  0, -1,  1,  1 }, {  9,  0, -1,  1,  1 },
+    /* 1780 */ {  9,  0, -1,  1, -1 }, {  9,  0, -1,  1, -1 }, {  9,  0, -1,  1, -1 }, {  9,  0, -1,  1, -1 },
+    /* 1784 */ {  9,  0, -1, -1,  1 }, {  9,  0, -1, -1,  1 }, {  9,  0, -1, -1,  1 }, {  9,  0, -1, -1,  1 },
+    /* 1788 */ {  9,  0, -1, -1, -1 }, {  9,  0, -1, -1, -1 }, {  9,  0, -1, -1, -1 }, {  9,  0, -1, -1, -1 },
+    /* 1792 */ {  8,  1,  0,  0,  1 }, {  8,  1,  0,  0,  1 }, {  8,  1,  0,  0,  1 }, {  8,  1,  0,  0,  1 },
+    /* 1796 */ {  8,  1,  0,  0,  1 }, {  8,  1,  0,  0,  1 }, {  8,  1,  0,  0,  1 }, {  8,  1,  0,  0,  1 },
+    /* 1800 */ {  8,  1,  0,  0, -1 }, {  8,  1,  0,  0, -1 }, {  8,  1,  0,  0, -1 }, {  8,  1,  0,  0, -1 },
+    /* 1804 */ {  8,  1,  0,  0, -1 }, {  8,  1,  0,  0, -1 }, {  8,  1,  0,  0, -1 }, {  8,  1,  0,  0, -1 },
+    /* 1808 */ {  8, -1,  0,  0,  1 }, {  8, -1,  0,  0,  1 }, {  8, -1,  0,  0,  1 }, {  8, -1,  0,  0,  1 },
+    /* 1812 */ {  8, -1,  0,  0,  1 }, {  8, -1,  0,  0,  1 }, {  8, -1,  0,  0,  1 }, {  8, -1,  0,  0,  1 },
+    /* 1816 */ {  8, -1,  0,  0, -1 }, {  8, -1,  0,  0, -1 }, {  8, -1,  0,  0, -1 }, {  8, -1,  0,  0, -1 },
+    /* 1820 */ {  8, -1,  0,  0, -1 }, {  8, -1,  0,  0, -1 }, {  8, -1,  0,  0, -1 }, {  8, -1,  0,  0, -1 },
+    /* 1824 */ {  9,  1,  1,  1,  0 }, {  9,  1,  1,  1,  0 }, {  9,  1,  1,  1,  0 }, {  9,  1,  1,  1,  0 },
+    /* 1828 */ {  9,  1,  1, -1,  0 }, {  9,  1,  1, -1,  0 }, {  9,  1,  1, -1,  0 }, {  9,  1,  1, -1,  0 },
+    /* 1832 */ {  9,  1, -1,  1,  0 }, {  9,  1, -1,  1,  0 }, {  9,  1, -1,  1,  0 }, {  9,  1, -1,  1,  0 },
+    /* 1836 */ {  9,  1, -1, -1,  0 }, {  9,  1, -1, -1,  0 }, {  9,  1, -1, -1,  0 }, {  9,  1, -1, -1,  0 },
+    /* 1840 */ {  9, -1,  1,  1,  0 }, {  9, -1,  1,  1,  0 }, {  9, -1,  1,  1,  0 }, {  9, -1,  1,  1,  0 },
+    /* 1844 */ {  9, -1,  1, -1,  0 }, {  9, -1,  1, -1,  0 }, {  9, -1,  1, -1,  0 }, {  9, -1,  1, -1,  0 },
+    /* 1848 */ {  9, -1, -1,  1,  0 }, {  9, -1, -1,  1,  0 }, {  9, -1, -1,  1,  0 }, {  9, -1, -1,  1,  0 },
+    /* 1852 */ {  9, -1, -1, -1,  0 }, {  9, -1, -1, -1,  0 }, {  9, -1, -1, -1,  0 }, {  9, -1, -1, -1,  0 },
+    /* 1856 */ { 11,  1,  1,  1,  1 }, { 11,  1,  1,  1, -1 }, { 11,  1,  1, -1,  1 }, { 11,  1,  1, -1, -1 },
+    /* 1860 */ { 11,  1, -1,  1,  1 }, { 11,  1, -1,  1, -1 }, { 11,  1, -1, -1,  1 }, { 11,  1, -1, -1, -1 },
+    /* 1864 */ { 11, -1,  1,  1,  1 }, { 11, -1,  1,  1, -1 }, { 11, -1,  1, -1,  1 }, { 11, -1,  1, -1, -1 },
+    /* 1868 */ { 11, -1, -1,  1,  1 }, { 11, -1, -1,  1, -1 }, { 11, -1, -1, -1,  1 }, { 11, -1, -1, -1, -1 },
+    /* 1872 */ { 10,  1,  0,  1,  1 }, { 10,  1,  0,  1,  1 }, { 10,  1,  0,  1, -1 }, { 10,  1,  0,  1, -1 },
+    /* 1876 */ { 10,  1,  0, -1,  1 }, { 10,  1,  0, -1,  1 }, { 10,  1,  0, -1, -1 }, { 10,  1,  0, -1, -1 },
+    /* 1880 */ { 10, -1,  0,  1,  1 }, { 10, -1,  0,  1,  1 }, { 10, -1,  0,  1, -1 }, { 10, -1,  0,  1, -1 },
+    /* 1884 */ { 10, -1,  0, -1,  1 }, { 10, -1,  0, -1,  1 }, { 10, -1,  0, -1, -1 }, { 10, -1,  0, -1, -1 },
+    /* 1888 */ { 10,  1,  1,  0,  1 }, { 10,  1,  1,  0,  1 }, { 10,  1,  1,  0, -1 }, { 10,  1,  1,  0, -1 },
+    /* 1892 */ { 10,  1, -1,  0,  1 }, { 10,  1, -1,  0,  1 }, { 10,  1, -1,  0, -1 }, { 10,  1, -1,  0, -1 },
+    /* 1896 */ { 10, -1,  1,  0,  1 }, { 10, -1,  1,  0,  1 }, { 10, -1,  1,  0, -1 }, { 10, -1,  1,  0, -1 },
+    /* 1900 */ { 10, -1, -1,  0,  1 }, { 10, -1, -1,  0,  1 }, { 10, -1, -1,  0, -1 }, { 10, -1, -1,  0, -1 },
+    /* 1904 */ {  9,  2,  0,  0,  0 }, {  9,  2,  0,  0,  0 }, {  9,  2,  0,  0,  0 }, {  9,  2,  0,  0,  0 },
+    /* 1908 */ {  9, -2,  0,  0,  0 }, {  9, -2,  0,  0,  0 }, {  9, -2,  0,  0,  0 }, {  9, -2,  0,  0,  0 },
+    /* 1912 */ {  9,  0,  0,  0,  2 }, {  9,  0,  0,  0,  2 }, {  9,  0,  0,  0,  2 }, {  9,  0,  0,  0,  2 },
+    /* 1916 */ {  9,  0,  0,  0, -2 }, {  9,  0,  0,  0, -2 }, {  9,  0,  0,  0, -2 }, {  9,  0,  0,  0, -2 },
+    /* 1920 */ { 10,  0,  0,  1,  2 }, { 10,  0,  0,  1,  2 }, { 10,  0,  0,  1, -2 }, { 10,  0,  0,  1, -2 },
+    /* 1924 */ { 10,  0,  0, -1,  2 }, { 10,  0,  0, -1,  2 }, { 10,  0,  0, -1, -2 }, { 10,  0,  0, -1, -2 },
+    /* 1928 */ { 10,  2,  1,  0,  0 }, { 10,  2,  1,  0,  0 }, { 10,  2, -1,  0,  0 }, { 10,  2, -1,  0,  0 },
+    /* 1932 */ { 10, -2,  1,  0,  0 }, { 10, -2,  1,  0,  0 }, { 10, -2, -1,  0,  0 }, { 10, -2, -1,  0,  0 },
+    /* 1936 */ { 11,  1,  2,  1,  0 }, { 11,  1,  2, -1,  0 }, { 11,  1, -2,  1,  0 }, { 11,  1, -2, -1,  0 },
+    /* 1940 */ { 11, -1,  2,  1,  0 }, { 11, -1,  2, -1,  0 }, { 11, -1, -2,  1,  0 }, { 11, -1, -2, -1,  0 },
+    /* 1944 */ { 11,  0,  0,  2,  1 }, { 11,  0,  0,  2, -1 }, { 11,  0,  0, -2,  1 }, { 11,  0,  0, -2, -1 },
+    /* 1948 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 1952 */ { 11,  1,  2,  0,  0 }, { 11,  1, -2,  0,  0 }, { 11, -1,  2,  0,  0 }, { 11, -1, -2,  0,  0 },
+    /* 1956 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 1960 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 1964 */ { 10,  0,  0,  2,  0 }, { 10,  0,  0,  2,  0 }, { 10,  0,  0, -2,  0 }, { 10,  0,  0, -2,  0 },
+    /* 1968 */ { 11,  0,  2,  1,  0 }, { 11,  0,  2, -1,  0 }, { 11,  0, -2,  1,  0 }, { 11,  0, -2, -1,  0 },
+    /* 1972 */ { 11,  0,  1,  2,  0 }, { 11,  0,  1, -2,  0 }, { 11,  0, -1,  2,  0 }, { 11,  0, -1, -2,  0 },
+    /* 1976 */ { 10,  0,  2,  0,  0 }, { 10,  0,  2,  0,  0 }, { 10,  0, -2,  0,  0 }, { 10,  0, -2,  0,  0 },
+    /* 1980 */ { 11,  0,  1,  0,  2 }, { 11,  0,  1,  0, -2 }, { 11,  0, -1,  0,  2 }, { 11,  0, -1,  0, -2 },
+    /* 1984 */ { 11,  2,  0,  1,  0 }, { 11,  2,  0, -1,  0 }, { 11, -2,  0,  1,  0 }, { 11, -2,  0, -1,  0 },
+    /* 1988 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 1992 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 1996 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2000 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2004 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2008 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2012 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2016 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2020 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2024 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2028 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2032 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2036 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2040 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2044 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }
+};
+
+/* HCB_4, 11 bits, 1984 of 2048 entries decode in one step */
+static hcb_2_quad hcb4_fast[] = {
+    /*    0 */ {  8,  1,  1,  1,  1 }, {  8,  1,  1,  1,  1 }, {  8,  1,  1,  1,  1 }, {  8,  1,  1,  1,  1 },
+    /*    4 */ {  8,  1,  1,  1,  1 }, {  8,  1,  1,  1,  1 }, {  8,  1,  1,  1,  1 }, {  8,  1,  1,  1,  1 },
+    /*    8 */ {  8,  1,  1,  1, -1 }, {  8,  1,  1,  1, -1 }, {  8,  1,  1,  1, -1 }, {  8,  1,  1,  1, -1 },
+    /*   12 */ {  8,  1,  1,  1, -1 }, {  8,  1,  1,  1, -1 }, {  8,  1,  1,  1, -1 }, {  8,  1,  1,  1, -1 },
+    /*   16 */ {  8,  1,  1, -1,  1 }, {  8,  1,  1, -1,  1 }, {  8,  1,  1, -1,  1 }, {  8,  1,  1, -1,  1 },
+    /*   20 */ {  8,  1,  1, -1,  1 }, {  8,  1,  1, -1,  1 }, {  8,  1,  1, -1,  1 }, {  8,  1,  1, -1,  1 },
+    /*   24 */ {  8,  1,  1, -1, -1 }, {  8,  1,  1, -1, -1 }, {  8,  1,  1, -1, -1 }, {  8,  1,  1, -1, -1 },
+    /*   28 */ {  8,  1,  1, -1, -1 }, {  8,  1,  1, -1, -1 }, {  8,  1,  1, -1, -1 }, {  8,  1,  1, -1, -1 },
+    /*   32 */ {  8,  1, -1,  1,  1 }, {  8,  1, -1,  1,  1 }, {  8,  1, -1,  1,  1 }, {  8,  1, -1,  1,  1 },
+    /*   36 */ {  8,  1, -1,  1,  1 }, {  8,  1, -1,  1,  1 }, {  8,  1, -1,  1,  1 }, {  8,  1, -1,  1,  1 },
+    /*   40 */ {  8,  1, -1,  1, -1 }, {  8,  1, -1,  1, -1 }, {  8,  1, -1,  1, -1 }, {  8,  1, -1,  1, -1 },
+    /*   44 */ {  8,  1, -1,  1, -1 }, {  8,  1, -1,  1, -1 }, {  8,  1, -1,  1, -1 }, {  8,  1, -1,  1, -1 },
+    /*   48 */ {  8,  1, -1, -1,  1 }, {  8,  1, -1, -1,  1 }, {  8,  1, -1, -1,  1 }, {  8,  1, -1, -1,  1 },
+    /*   52 */ {  8,  1, -1, -1,  1 }, {  8,  1, -1, -1,  1 }, {  8,  1, -1, -1,  1 }, {  8,  1, -1, -1,  1 },
+    /*   56 */ {  8,  1, -1, -1, -1 }, {  8,  1, -1, -1, -1 }, {  8,  1, -1, -1, -1 }, {  8,  1, -1, -1, -1 },
+    /*   60 */ {  8,  1, -1, -1, -1 }, {  8,  1, -1, -1, -1 }, {  8,  1, -1, -1, -1 }, {  8,  1, -1, -1, -1 },
+    /*   64 */ {  8, -1,  1,  1,  1 }, {  8, -1,  1,  1,  1 }, {  8, -1,  1,  1,  1 }, {  8, -1,  1,  1,  1 },
+    /*   68 */ {  8, -1,  1,  1,  1 }, {  8, -1,  1,  1,  1 }, {  8, -1,  1,  1,  1 }, {  8, -1,  1,  1,  1 },
+    /*   72 */ {  8, -1,  1,  1, -1 }, {  8, -1,  1,  1, -1 }, {  8, -1,  1,  1, -1 }, {  8, -1,  1,  1, -1 },
+    /*   76 */ {  8, -1,  1,  1, -1 }, {  8, -1,  1,  1, -1 }, {  8, -1,  1,  1, -1 }, {  8, -1,  1,  1, -1 },
+    /*   80 */ {  8, -1,  1, -1,  1 }, {  8, -1,  1, -1,  1 }, {  8, -1,  1, -1,  1 }, {  8, -1,  1, -1,  1 },
+    /*   84 */ {  8, -1,  1, -1,  1 }, {  8, -1,  1, -1,  1 }, {  8, -1,  1, -1,  1 }, {  8, -1,  1, -1,  1 },
+    /*   88 */ {  8, -1,  1, -1, -1 }, {  8, -1,  1, -1, -1 }, {  8, -1,  1, -1, -1 }, {  8, -1,  1, -1, -1 },
+    /*   92 */ {  8, -1,  1, -1, -1 }, {  8, -1,  1, -1, -1 }, {  8, -1,  1, -1, -1 }, {  8, -1,  1, -1, -1 },
+    /*   96 */ {  8, -1, -1,  1,  1 }, {  8, -1, -1,  1,  1 }, {  8, -1, -1,  1,  1 }, {  8, -1, -1,  1,  1 },
+    /*  100 */ {  8, -1, -1,  1,  1 }, {  8, -1, -1,  1,  1 }, {  8, -1, -1,  1,  1 }, {  8, -1, -1,  1,  1 },
+    /*  104 */ {  8, -1, -1,  1, -1 }, {  8, -1, -1,  1, -1 }, {  8, -1, -1,  1, -1 }, {  8, -1, -1,  1, -1 },
+    /*  108 */ {  8, -1, -1,  1, -1 }, {  8, -1, -1,  1, -1 }, {  8, -1, -1,  1, -1 }, {  8, -1, -1,  1, -1 },
+    /*  112 */ {  8, -1, -1, -1,  1 }, {  8, -1, -1, -1,  1 }, {  8, -1, -1, -1,  1 }, {  8, -1, -1, -1,  1 },
+    /*  116 */ {  8, -1, -1, -1,  1 }, {  8, -1, -1, -1,  1 }, {  8, -1, -1, -1,  1 }, {  8, -1, -1, -1,  1 },
+    /*  120 */ {  8, -1, -1, -1, -1 }, {  8, -1, -1, -1, -1 }, {  8, -1, -1, -1, -1 }, {  8, -1, -1, -1, -1 },
+    /*  124 */ {  8, -1, -1, -1, -1 }, {  8, -1, -1, -1, -1 }, {  8, -1, -1, -1, -1 }, {  8, -1, -1, -1, -1 },
+    /*  128 */ {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 },
+    /*  132 */ {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 },
+    /*  136 */ {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 },
+    /*  140 */ {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 }, {  7,  0,  1,  1,  1 },
+    /*  144 */ {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 },
+    /*  148 */ {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 },
+    /*  152 */ {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 },
+    /*  156 */ {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 }, {  7,  0,  1,  1, -1 },
+    /*  160 */ {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 },
+    /*  164 */ {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 },
+    /*  168 */ {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 },
+    /*  172 */ {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 }, {  7,  0,  1, -1,  1 },
+    /*  176 */ {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 },
+    /*  180 */ {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 },
+    /*  184 */ {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 },
+    /*  188 */ {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 }, {  7,  0,  1, -1, -1 },
+    /*  192 */ {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 },
+    /*  196 */ {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 },
+    /*  200 */ {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 },
+    /*  204 */ {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 }, {  7,  0, -1,  1,  1 },
+    /*  208 */ {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 },
+    /*  212 */ {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 },
+    /*  216 */ {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 },
+    /*  220 */ {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 }, {  7,  0, -1,  1, -1 },
+    /*  224 */ {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 },
+    /*  228 */ {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 },
+    /*  232 */ {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 },
+    /*  236 */ {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 }, {  7,  0, -1, -1,  1 },
+    /*  240 */ {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 },
+    /*  244 */ {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 },
+    /*  248 */ {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 },
+    /*  252 */ {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 }, {  7,  0, -1, -1, -1 },
+    /*  256 */ {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 },
+    /*  260 */ {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 },
+    /*  264 */ {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 },
+    /*  268 */ {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 }, {  7,  1,  1,  0,  1 },
+    /*  272 */ {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 },
+    /*  276 */ {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 },
+    /*  280 */ {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 },
+    /*  284 */ {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 }, {  7,  1,  1,  0, -1 },
+    /*  288 */ {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 },
+    /*  292 */ {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 },
+    /*  296 */ {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 },
+    /*  300 */ {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 }, {  7,  1, -1,  0,  1 },
+    /*  304 */ {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 },
+    /*  308 */ {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 },
+    /*  312 */ {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 },
+    /*  316 */ {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 }, {  7,  1, -1,  0, -1 },
+    /*  320 */ {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 },
+    /*  324 */ {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 },
+    /*  328 */ {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 },
+    /*  332 */ {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 }, {  7, -1,  1,  0,  1 },
+    /*  336 */ {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 },
+    /*  340 */ {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 },
+    /*  344 */ {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 },
+    /*  348 */ {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 }, {  7, -1,  1,  0, -1 },
+    /*  352 */ {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 },
+    /*  356 */ {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 },
+    /*  360 */ {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 },
+    /*  364 */ {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 }, {  7, -1, -1,  0,  1 },
+    /*  368 */ {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 },
+    /*  372 */ {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 },
+    /*  376 */ {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 },
+    /*  380 */ {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 }, {  7, -1, -1,  0, -1 },
+    /*  384 */ {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 },
+    /*  388 */ {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 },
+    /*  392 */ {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 },
+    /*  396 */ {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 }, {  7,  1,  1,  1,  0 },
+    /*  400 */ {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 },
+    /*  404 */ {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 },
+    /*  408 */ {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 },
+    /*  412 */ {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 }, {  7,  1,  1, -1,  0 },
+    /*  416 */ {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 },
+    /*  420 */ {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 },
+    /*  424 */ {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 },
+    /*  428 */ {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 }, {  7,  1, -1,  1,  0 },
+    /*  432 */ {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 },
+    /*  436 */ {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 },
+    /*  440 */ {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 },
+    /*  444 */ {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 }, {  7,  1, -1, -1,  0 },
+    /*  448 */ {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 },
+    /*  452 */ {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 },
+    /*  456 */ {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 },
+    /*  460 */ {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 }, {  7, -1,  1,  1,  0 },
+    /*  464 */ {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 },
+    /*  468 */ {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 },
+    /*  472 */ {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 },
+    /*  476 */ {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 }, {  7, -1,  1, -1,  0 },
+    /*  480 */ {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 },
+    /*  484 */ {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 },
+    /*  488 */ {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 },
+    /*  492 */ {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 }, {  7, -1, -1,  1,  0 },
+    /*  496 */ {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 },
+    /*  500 */ {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 },
+    /*  504 */ {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 },
+    /*  508 */ {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 }, {  7, -1, -1, -1,  0 },
+    /*  512 */ {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 },
+    /*  516 */ {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 },
+    /*  520 */ {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 },
+    /*  524 */ {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 }, {  7,  1,  0,  1,  1 },
+    /*  528 */ {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 },
+    /*  532 */ {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 },
+    /*  536 */ {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 },
+    /*  540 */ {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 }, {  7,  1,  0,  1, -1 },
+    /*  544 */ {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 },
+    /*  548 */ {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 },
+    /*  552 */ {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 },
+    /*  556 */ {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 }, {  7,  1,  0, -1,  1 },
+    /*  560 */ {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 },
+    /*  564 */ {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 },
+    /*  568 */ {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 },
+    /*  572 */ {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 }, {  7,  1,  0, -1, -1 },
+    /*  576 */ {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 },
+    /*  580 */ {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 },
+    /*  584 */ {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 },
+    /*  588 */ {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 }, {  7, -1,  0,  1,  1 },
+    /*  592 */ {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 },
+    /*  596 */ {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 },
+    /*  600 */ {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 },
+    /*  604 */ {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 }, {  7, -1,  0,  1, -1 },
+    /*  608 */ {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 },
+    /*  612 */ {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 },
+    /*  616 */ {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 },
+    /*  620 */ {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 }, {  7, -1,  0, -1,  1 },
+    /*  624 */ {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 },
+    /*  628 */ {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 },
+    /*  632 */ {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 },
+    /*  636 */ {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 }, {  7, -1,  0, -1, -1 },
+    /*  640 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  644 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  648 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  652 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  656 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  660 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  664 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  668 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  672 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  676 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  680 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  684 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  688 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  692 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  696 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  700 */ {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 }, {  5,  1,  0,  0,  0 },
+    /*  704 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  708 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  712 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  716 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  720 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  724 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  728 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  732 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  736 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  740 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  744 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  748 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  752 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  756 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  760 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  764 */ {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 }, {  5, -1,  0,  0,  0 },
+    /*  768 */ {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 },
+    /*  772 */ {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 },
+    /*  776 */ {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 },
+    /*  780 */ {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 },
+    /*  784 */ {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 },
+    /*  788 */ {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 },
+    /*  792 */ {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 },
+    /*  796 */ {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 }, {  6,  1,  1,  0,  0 },
+    /*  800 */ {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 },
+    /*  804 */ {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 },
+    /*  808 */ {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 },
+    /*  812 */ {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 },
+    /*  816 */ {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 },
+    /*  820 */ {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 },
+    /*  824 */ {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 },
+    /*  828 */ {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 }, {  6,  1, -1,  0,  0 },
+    /*  832 */ {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 },
+    /*  836 */ {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 },
+    /*  840 */ {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 },
+    /*  844 */ {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 },
+    /*  848 */ {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 },
+    /*  852 */ {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 },
+    /*  856 */ {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 },
+    /*  860 */ {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 }, {  6, -1,  1,  0,  0 },
+    /*  864 */ {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 },
+    /*  868 */ {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 },
+    /*  872 */ {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 },
+    /*  876 */ {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 },
+    /*  880 */ {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 },
+    /*  884 */ {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 },
+    /*  888 */ {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 },
+    /*  892 */ {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 }, {  6, -1, -1,  0,  0 },
+    /*  896 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  900 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  904 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  908 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  912 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  916 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  920 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  924 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  928 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  932 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  936 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  940 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  944 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  948 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  952 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  956 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  960 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  964 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  968 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  972 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  976 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  980 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  984 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  988 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  992 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /*  996 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /* 1000 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /* 1004 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /* 1008 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /* 1012 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /* 1016 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /* 1020 */ {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 }, {  4,  0,  0,  0,  0 },
+    /* 1024 */ {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 },
+    /* 1028 */ {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 },
+    /* 1032 */ {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 },
+    /* 1036 */ {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 },
+    /* 1040 */ {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 },
+    /* 1044 */ {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 },
+    /* 1048 */ {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 },
+    /* 1052 */ {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 }, {  6,  0,  0,  1,  1 },
+    /* 1056 */ {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 },
+    /* 1060 */ {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 },
+    /* 1064 */ {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 },
+    /* 1068 */ {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 },
+    /* 1072 */ {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 },
+    /* 1076 */ {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 },
+    /* 1080 */ {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 },
+    /* 1084 */ {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 }, {  6,  0,  0,  1, -1 },
+    /* 1088 */ {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 },
+    /* 1092 */ {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 },
+    /* 1096 */ {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 },
+    /* 1100 */ {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 },
+    /* 1104 */ {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 },
+    /* 1108 */ {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 },
+    /* 1112 */ {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 },
+    /* 1116 */ {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 }, {  6,  0,  0, -1,  1 },
+    /* 1120 */ {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 },
+    /* 1124 */ {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 },
+    /* 1128 */ {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 },
+    /* 1132 */ {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 },
+    /* 1136 */ {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 },
+    /* 1140 */ {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 },
+    /* 1144 */ {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 },
+    /* 1148 */ {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 }, {  6,  0,  0, -1, -1 },
+    /* 1152 */ {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 },
+    /* 1156 */ {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 },
+    /* 1160 */ {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 },
+    /* 1164 */ {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 },
+    /* 1168 */ {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 },
+    /* 1172 */ {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 },
+    /* 1176 */ {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 },
+    /* 1180 */ {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 }, {  6,  1,  0,  1,  0 },
+    /* 1184 */ {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 },
+    /* 1188 */ {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 },
+    /* 1192 */ {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 },
+    /* 1196 */ {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 },
+    /* 1200 */ {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 },
+    /* 1204 */ {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 },
+    /* 1208 */ {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 },
+    /* 1212 */ {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 }, {  6,  1,  0, -1,  0 },
+    /* 1216 */ {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 },
+    /* 1220 */ {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 },
+    /* 1224 */ {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 },
+    /* 1228 */ {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 },
+    /* 1232 */ {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 },
+    /* 1236 */ {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 },
+    /* 1240 */ {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 },
+    /* 1244 */ {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 }, {  6, -1,  0,  1,  0 },
+    /* 1248 */ {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 },
+    /* 1252 */ {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 },
+    /* 1256 */ {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 },
+    /* 1260 */ {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 },
+    /* 1264 */ {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 },
+    /* 1268 */ {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 },
+    /* 1272 */ {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 },
+    /* 1276 */ {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 }, {  6, -1,  0, -1,  0 },
+    /* 1280 */ {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 },
+    /* 1284 */ {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 },
+    /* 1288 */ {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 },
+    /* 1292 */ {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 }, {  7,  1,  0,  0,  1 },
+    /* 1296 */ {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 },
+    /* 1300 */ {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 },
+    /* 1304 */ {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 },
+    /* 1308 */ {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 }, {  7,  1,  0,  0, -1 },
+    /* 1312 */ {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 },
+    /* 1316 */ {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 },
+    /* 1320 */ {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 },
+    /* 1324 */ {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 }, {  7, -1,  0,  0,  1 },
+    /* 1328 */ {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 },
+    /* 1332 */ {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 },
+    /* 1336 */ {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 },
+    /* 1340 */ {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 }, {  7, -1,  0,  0, -1 },
+    /* 1344 */ {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 },
+    /* 1348 */ {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 },
+    /* 1352 */ {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 },
+    /* 1356 */ {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 }, {  7,  0,  1,  1,  0 },
+    /* 1360 */ {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 },
+    /* 1364 */ {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 },
+    /* 1368 */ {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 },
+    /* 1372 */ {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 }, {  7,  0,  1, -1,  0 },
+    /* 1376 */ {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 },
+    /* 1380 */ {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 },
+    /* 1384 */ {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 },
+    /* 1388 */ {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 }, {  7,  0, -1,  1,  0 },
+    /* 1392 */ {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 },
+    /* 1396 */ {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 },
+    /* 1400 */ {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 },
+    /* 1404 */ {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 }, {  7,  0, -1, -1,  0 },
+    /* 1408 */ {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 },
+    /* 1412 */ {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 },
+    /* 1416 */ {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 },
+    /* 1420 */ {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 },
+    /* 1424 */ {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 },
+    /* 1428 */ {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 },
+    /* 1432 */ {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 },
+    /* 1436 */ {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 }, {  6,  0,  0,  0,  1 },
+    /* 1440 */ {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 },
+    /* 1444 */ {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 },
+    /* 1448 */ {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 },
+    /* 1452 */ {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 },
+    /* 1456 */ {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 },
+    /* 1460 */ {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 },
+    /* 1464 */ {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 },
+    /* 1468 */ {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 }, {  6,  0,  0,  0, -1 },
+    /* 1472 */ {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 },
+    /* 1476 */ {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 },
+    /* 1480 */ {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 },
+    /* 1484 */ {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 }, {  7,  0,  1,  0,  1 },
+    /* 1488 */ {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 },
+    /* 1492 */ {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 },
+    /* 1496 */ {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 },
+    /* 1500 */ {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 }, {  7,  0,  1,  0, -1 },
+    /* 1504 */ {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 },
+    /* 1508 */ {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 },
+    /* 1512 */ {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 },
+    /* 1516 */ {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 }, {  7,  0, -1,  0,  1 },
+    /* 1520 */ {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 },
+    /* 1524 */ {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 },
+    /* 1528 */ {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 },
+    /* 1532 */ {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 }, {  7,  0, -1,  0, -1 },
+    /* 1536 */ {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 },
+    /* 1540 */ {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 },
+    /* 1544 */ {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 },
+    /* 1548 */ {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 },
+    /* 1552 */ {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 },
+    /* 1556 */ {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 },
+    /* 1560 */ {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 },
+    /* 1564 */ {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 }, {  6,  0,  0,  1,  0 },
+    /* 1568 */ {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 },
+    /* 1572 */ {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 },
+    /* 1576 */ {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 },
+    /* 1580 */ {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 },
+    /* 1584 */ {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 },
+    /* 1588 */ {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 },
+    /* 1592 */ {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 },
+    /* 1596 */ {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 }, {  6,  0,  0, -1,  0 },
+    /* 1600 */ {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 },
+    /* 1604 */ {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 },
+    /* 1608 */ {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 },
+    /* 1612 */ {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 },
+    /* 1616 */ {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 },
+    /* 1620 */ {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 },
+    /* 1624 */ {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 },
+    /* 1628 */ {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 }, {  6,  0,  1,  0,  0 },
+    /* 1632 */ {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 },
+    /* 1636 */ {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 },
+    /* 1640 */ {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 },
+    /* 1644 */ {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 },
+    /* 1648 */ {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 },
+    /* 1652 */ {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 },
+    /* 1656 */ {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 },
+    /* 1660 */ {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 }, {  6,  0, -1,  0,  0 },
+    /* 1664 */ { 11,  2,  1,  1,  1 }, { 11,  2,  1,  1, -1 }, { 11,  2,  1, -1,  1 }, { 11,  2,  1, -1, -1 },
+    /* 1668 */ { 11,  2, -1,  1,  1 }, { 11,  2, -1,  1, -1 }, { 11,  2, -1, -1,  1 }, { 11,  2, -1, -1, -1 },
+    /* 1672 */ { 11, -2,  1,  1,  1 }, { 11, -2,  1,  1, -1 }, { 11, -2,  1, -1,  1 }, { 11, -2,  1, -1, -1 },
+    /* 1676 */ { 11, -2, -1,  1,  1 }, { 11, -2, -1,  1, -1 }, { 11, -2, -1, -1,  1 }, { 11, -2, -1, -1, -1 },
+    /* 1680 */ { 11,  1,  1,  2,  1 }, { 11,  1,  1,  2, -1 }, { 11,  1,  1, -2,  1 }, { 11,  1,  1, -2, -1 },
+    /* 1684 */ { 11,  1, -1,  2,  1 }, { 11,  1, -1,  2, -1 }, { 11,  1, -1, -2,  1 }, { 11,  1, -1, -2, -1 },
+    /* 1688 */ { 11, -1,  1,  2,  1 }, { 11, -1,  1,  2, -1 }, { 11, -1,  1, -2,  1 }, { 11, -1,  1, -2, -1 },
+    /* 1692 */ { 11, -1, -1,  2,  1 }, { 11, -1, -1,  2, -1 }, { 11, -1, -1, -2,  1 }, { 11, -1, -1, -2, -1 },
+    /* 1696 */ { 11,  1,  2,  1,  1 }, { 11,  1,  2,  1, -1 }, { 11,  1,  2, -1,  1 }, { 11,  1,  2, -1, -1 },
+    /* 1700 */ { 11,  1, -2,  1,  1 }, { 11,  1, -2,  1, -1 }, { 11,  1, -2, -1,  1 }, { 11,  1, -2, -1, -1 },
+    /* 1704 */ { 11, -1,  2,  1,  1 }, { 11, -1,  2,  1, -1 }, { 11, -1,  2, -1,  1 }, { 11, -1,  2, -1, -1 },
+    /* 1708 */ { 11, -1, -2,  1,  1 }, { 11, -1, -2,  1, -1 }, { 11, -1, -2, -1,  1 }, { 11, -1, -2, -1, -1 },
+    /* 1712 */ { 11,  1,  1,  1,  2 }, { 11,  1,  1,  1, -2 }, { 11,  1,  1, -1,  2 }, { 11,  1,  1, -1, -2 },
+    /* 1716 */ { 11,  1, -1,  1,  2 }, { 11,  1, -1,  1, -2 }, { 11,  1, -1, -1,  2 }, { 11,  1, -1, -1, -2 },
+    /* 1720 */ { 11, -1,  1,  1,  2 }, { 11, -1,  1,  1, -2 }, { 11, -1,  1, -1,  2 }, { 11, -1,  1, -1, -2 },
+    /* 1724 */ { 11, -1, -1,  1,  2 }, { 11, -1, -1,  1, -2 }, { 11, -1, -1, -1,  2 }, { 11, -1, -1, -1, -2 },
+    /* 1728 */ { 10,  2,  1,  1,  0 }, { 10,  2,  1,  1,  0 }, { 10,  2,  1, -1,  0 }, { 10,  2,  1, -1,  0 },
+    /* 1732 */ { 10,  2, -1,  1,  0 }, { 10,  2, -1,  1,  0 }, { 10,  2, -1, -1,  0 }, { 10,  2, -1, -1,  0 },
+    /* 1736 */ { 10, -2,  1,  1,  0 }, { 10, -2,  1,  1,  0 }, { 10, -2,  1, -1,  0 }, { 10, -2,  1, -1,  0 },
+    /* 1740 */ { 10, -2, -1,  1,  0 }, { 10, -2, -1,  1,  0 }, { 10, -2, -1, -1,  0 }, { 10, -2, -1, -1,  0 },
+    /* 1744 */ { 10,  2,  1,  0,  1 }, { 10,  2,  1,  0,  1 }, { 10,  2,  1,  0, -1 }, { 10,  2,  1,  0, -1 },
+    /* 1748 */ { 10,  2, -1,  0,  1 }, { 10,  2, -1,  0,  1 }, { 10,  2, -1,  0, -1 }, { 10,  2, -1,  0, -1 },
+    /* 1752 */ { 10, -2,  1,  0,  1 }, { 10, -2,  1,  0,  1 }, { 10, -2,  1,  0, -1 }, { 10, -2,  1,  0, -1 },
+    /* 1756 */ { 10, -2, -1,  0,  1 }, { 10, -2, -1,  0,  1 }, { 10, -2, -1,  0, -1 }, { 10, -2, -1,  0, -1 },
+    /* 1760 */ { 10,  1,  2,  1,  0 }, { 10,  1,  2,  1,  0 }, { 10,  1,  2, -1,  0 }, { 10,  1,  2, -1,  0 },
+    /* 1764 */ { 10,  1, -2,  1,  0 }, { 10,  1, -2,  1,  0 }, { 10,  1, -2, -1,  0 }, { 10,  1, -2, -1,  0 },
+    /* 1768 */ { 10, -1,  2,  1,  0 }, { 10, -1,  2,  1,  0 }, { 10, -1,  2, -1,  0 }, { 10, -1,  2, -1,  0 },
+    /* 1772 */ { 10, -1, -2,  1,  0 }, { 10, -1, -2,  1,  0 }, { 10, -1, -2, -1,  0 }, { 10, -1, -2, -1,  0 },
+    /* 1776 */ { 10,  2,  0,  1,  1 }, { 10,  2,  0,  1,  1 }, { 10,  2,  0,  1, -1 }, { 10,  2,  0,  1, -1 },
+    /* 1780 */ { 10,  2,  0, -1,  1 }, { 10,  2,  0, -1,  1 }, { 10,  2,  0, -1, -1 }, { 10,  2,  0, -1, -1 },
+    /* 1784 */ { 10, -2,  0,  1,  1 }, { 10, -2,  0,  1,  1 }, { 10, -2,  0,  1, -1 }, { 10, -2,  0,  1, -1 },
+    /* 1788 */ { 10, -2,  0, -1,  1 }, { 10, -2,  0, -1,  1 }, { 10, -2,  0, -1, -1 }, { 10, -2,  0, -1, -1 },
+    /* 1792 */ { 10,  0,  1,  2,  1 }, { 10,  0,  1,  2,  1 }, { 10,  0,  1,  2, -1 }, { 10,  0,  1,  2, -1 },
+    /* 1796 */ { 10,  0,  1, -2,  1 }, { 10,  0,  1, -2,  1 }, { 10,  0,  1, -2, -1 }, { 10,  0,  1, -2, -1 },
+    /* 1800 */ { 10,  0, -1,  2,  1 }, { 10,  0, -1,  2,  1 }, { 10,  0, -1,  2, -1 }, { 10,  0, -1,  2, -1 },
+    /* 1804 */ { 10,  0, -1, -2,  1 }, { 10,  0, -1, -2,  1 }, { 10,  0, -1, -2, -1 }, { 10,  0, -1, -2, -1 },
+    /* 1808 */ { 11,  0,  1,  1,  2 }, { 11,  0,  1,  1, -2 }, { 11,  0,  1, -1,  2 }, { 11,  0,  1, -1, -2 },
+    /* 1812 */ { 11,  0, -1,  1,  2 }, { 11,  0, -1,  1, -2 }, { 11,  0, -1, -1,  2 }, { 11,  0, -1, -1, -2 },
+    /* 1816 */ { 11,  1,  1,  2,  0 }, { 11,  1,  1, -2,  0 }, { 11,  1, -1,  2,  0 }, { 11,  1, -1, -2,  0 },
+    /* 1820 */ { 11, -1,  1,  2,  0 }, { 11, -1,  1, -2,  0 }, { 11, -1, -1,  2,  0 }, { 11, -1, -1, -2,  0 },
+    /* 1824 */ { 11,  0,  2,  1,  1 }, { 11,  0,  2,  1, -1 }, { 11,  0,  2, -1,  1 }, { 11,  0,  2, -1, -1 },
+    /* 1828 */ { 11,  0, -2,  1,  1 }, { 11,  0, -2,  1, -1 }, { 11,  0, -2, -1,  1 }, { 11,  0, -2, -1, -1 },
+    /* 1832 */ { 11,  1,  0,  1,  2 }, { 11,  1,  0,  1, -2 }, { 11,  1,  0, -1,  2 }, { 11,  1,  0, -1, -2 },
+    /* 1836 */ { 11, -1,  0,  1,  2 }, { 11, -1,  0,  1, -2 }, { 11, -1,  0, -1,  2 }, { 11, -1,  0, -1, -2 },
+    /* 1840 */ { 11,  1,  2,  0,  1 }, { 11,  1,  2,  0, -1 }, { 11,  1, -2,  0,  1 }, { 11,  1, -2,  0, -1 },
+    /* 1844 */ { 11, -1,  2,  0,  1 }, { 11, -1,  2,  0, -1 }, { 11, -1, -2,  0,  1 }, { 11, -1, -2,  0, -1 },
+    /* 1848 */ { 11,  1,  1,  0,  2 }, { 11,  1,  1,  0, -2 }, { 11,  1, -1,  0,  2 }, { 11,  1, -1,  0, -2 },
+    /* 1852 */ { 11, -1,  1,  0,  2 }, { 11, -1,  1,  0, -2 }, { 11, -1, -1,  0,  2 }, { 11, -1, -1,  0, -2 },
+    /* 1856 */ { 11,  1,  0,  2,  1 }, { 11,  1,  0,  2, -1 }, { 11,  1,  0, -2,  1 }, { 11,  1,  0, -2, -1 },
+    /* 1860 */ { 11, -1,  0,  2,  1 }, { 11, -1,  0,  2, -1 }, { 11, -1,  0, -2,  1 }, { 11, -1,  0, -2, -1 },
+    /* 1864 */ { 10,  2,  1,  0,  0 }, { 10,  2,  1,  0,  0 }, { 10,  2, -1,  0,  0 }, { 10,  2, -1,  0,  0 },
+    /* 1868 */ { 10, -2,  1,  0,  0 }, { 10, -2,  1,  0,  0 }, { 10, -2, -1,  0,  0 }, { 10, -2, -1,  0,  0 },
+    /* 1872 */ { 10,  2,  0,  1,  0 }, { 10,  2,  0,  1,  0 }, { 10,  2,  0, -1,  0 }, { 10,  2,  0, -1,  0 },
+    /* 1876 */ { 10, -2,  0,  1,  0 }, { 10, -2,  0,  1,  0 }, { 10, -2,  0, -1,  0 }, { 10, -2,  0, -1,  0 },
+    /* 1880 */ { 10,  1,  2,  0,  0 }, { 10,  1,  2,  0,  0 }, { 10,  1, -2,  0,  0 }, { 10,  1, -2,  0,  0 },
+    /* 1884 */ { 10, -1,  2,  0,  0 }, { 10, -1,  2,  0,  0 }, { 10, -1, -2,  0,  0 }, { 10, -1, -2,  0,  0 },
+    /* 1888 */ { 10,  2,  0,  0,  1 }, { 10,  2,  0,  0,  1 }, { 10,  2,  0,  0, -1 }, { 10,  2,  0,  0, -1 },
+    /* 1892 */ { 10, -2,  0,  0,  1 }, { 10, -2,  0,  0,  1 }, { 10, -2,  0,  0, -1 }, { 10, -2,  0,  0, -1 },
+    /* 1896 */ { 10,  0,  1,  0,  2 }, { 10,  0,  1,  0,  2 }, { 10,  0,  1,  0, -2 }, { 10,  0,  1,  0, -2 },
+    /* 1900 */ { 10,  0, -1,  0,  2 }, { 10,  0, -1,  0,  2 }, { 10,  0, -1,  0, -2 }, { 10,  0, -1,  0, -2 },
+    /* 1904 */ { 10,  0,  2,  1,  0 }, { 10,  0,  2,  1,  0 }, { 10,  0,  2, -1,  0 }, { 10,  0,  2, -1,  0 },
+    /* 1908 */ { 10,  0, -2,  1,  0 }, { 10,  0, -2,  1,  0 }, { 10,  0, -2, -1,  0 }, { 10,  0, -2, -1,  0 },
+    /* 1912 */ { 10,  0,  0,  1,  2 }, { 10,  0,  0,  1,  2 }, { 10,  0,  0,  1, -2 }, { 10,  0,  0,  1, -2 },
+    /* 1916 */ { 10,  0,  0, -1,  2 }, { 10,  0,  0, -1,  2 }, { 10,  0,  0, -1, -2 }, { 10,  0,  0, -1, -2 },
+    /* 1920 */ { 10,  0,  1,  2,  0 }, { 10,  0,  1,  2,  0 }, { 10,  0,  1, -2,  0 }, { 10,  0,  1, -2,  0 },
+    /* 1924 */ { 10,  0, -1,  2,  0 }, { 10,  0, -1,  2,  0 }, { 10,  0, -1, -2,  0 }, { 10,  0, -1, -2,  0 },
+    /* 1928 */ { 10,  0,  2,  0,  1 }, { 10,  0,  2,  0,  1 }, { 10,  0,  2,  0, -1 }, { 10,  0,  2,  0, -1 },
+    /* 1932 */ { 10,  0, -2,  0,  1 }, { 10,  0, -2,  0,  1 }, { 10,  0, -2,  0, -1 }, { 10,  0, -2,  0, -1 },
+    /* 1936 */ { 10,  1,  0,  0,  2 }, { 10,  1,  0,  0,  2 }, { 10,  1,  0,  0, -2 }, { 10,  1,  0,  0, -2 },
+    /* 1940 */ { 10, -1,  0,  0,  2 }, { 10, -1,  0,  0,  2 }, { 10, -1,  0,  0, -2 }, { 10, -1,  0,  0, -2 },
+    /* 1944 */ { 10,  0,  0,  2,  1 }, { 10,  0,  0,  2,  1 }, { 10,  0,  0,  2, -1 }, { 10,  0,  0,  2, -1 },
+    /* 1948 */ { 10,  0,  0, -2,  1 }, { 10,  0,  0, -2,  1 }, { 10,  0,  0, -2, -1 }, { 10,  0,  0, -2, -1 },
+    /* 1952 */ { 10,  1,  0,  2,  0 }, { 10,  1,  0,  2,  0 }, { 10,  1,  0, -2,  0 }, { 10,  1,  0, -2,  0 },
+    /* 1956 */ { 10, -1,  0,  2,  0 }, { 10, -1,  0,  2,  0 }, { 10, -1,  0, -2,  0 }, { 10, -1,  0, -2,  0 },
+    /* 1960 */ {  9,  2,  0,  0,  0 }, {  9,  2,  0,  0,  0 }, {  9,  2,  0,  0,  0 }, {  9,  2,  0,  0,  0 },
+    /* 1964 */ {  9, -2,  0,  0,  0 }, {  9, -2,  0,  0,  0 }, {  9, -2,  0,  0,  0 }, {  9, -2,  0,  0,  0 },
+    /* 1968 */ {  9,  0,  0,  0,  2 }, {  9,  0,  0,  0,  2 }, {  9,  0,  0,  0,  2 }, {  9,  0,  0,  0,  2 },
+    /* 1972 */ {  9,  0,  0,  0, -2 }, {  9,  0,  0,  0, -2 }, {  9,  0,  0,  0, -2 }, {  9,  0,  0,  0, -2 },
+    /* 1976 */ { 10,  0,  2,  0,  0 }, { 10,  0,  2,  0,  0 }, { 10,  0, -2,  0,  0 }, { 10,  0, -2,  0,  0 },
+    /* 1980 */ { 10,  0,  0,  2,  0 }, { 10,  0,  0,  2,  0 }, { 10,  0,  0, -2,  0 }, { 10,  0,  0, -2,  0 },
+    /* 1984 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 1988 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 1992 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 1996 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2000 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2004 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2008 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2012 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2016 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2020 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2024 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2028 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2032 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2036 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2040 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 },
+    /* 2044 */ {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }, {  0,  0,  0,  0,  0 }
+};
+
+/* HCB_5, 9 bits, 500 of 512 entries decode in one step */
+static hcb_2_pair hcb5_fast[] = {
+    /*    0 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*    8 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   16 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   24 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   32 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   40 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   48 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   56 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   64 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   72 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   80 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   88 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   96 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  104 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  112 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  120 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  128 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  136 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  144 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  152 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  160 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  168 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  176 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  184 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  192 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  200 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  208 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  216 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  224 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  232 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  240 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  248 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  256 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  264 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  272 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  280 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  288 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  296 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  304 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  312 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  320 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  328 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  336 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  344 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  352 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  360 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  368 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  376 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  384 */ {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 },
+    /*  392 */ {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 },
+    /*  400 */ {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 },
+    /*  408 */ {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 },
+    /*  416 */ {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 },
+    /*  424 */ {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 },
+    /*  432 */ {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 },
+    /*  440 */ {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 },
+    /*  448 */ {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 },
+    /*  456 */ {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 },
+    /*  464 */ {  8,  -2,  -1 }, {  8,  -2,  -1 }, {  8,   2,   1 }, {  8,   2,   1 }, {  8,  -1,  -2 }, {  8,  -1,  -2 }, {  8,   1,   2 }, {  8,   1,   2 },
+    /*  472 */ {  8,  -2,   1 }, {  8,  -2,   1 }, {  8,   2,  -1 }, {  8,   2,  -1 }, {  8,  -1,   2 }, {  8,  -1,   2 }, {  8,   1,  -2 }, {  8,   1,  -2 },
+    /*  480 */ {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,   3 }, {  8,   0,   3 },
+    /*  488 */ {  9,  -3,  -1 }, {  9,   1,   3 }, {  9,   3,   1 }, {  9,  -1,  -3 }, {  9,  -3,   1 }, {  9,   3,  -1 }, {  9,   1,  -3 }, {  9,  -1,   3 },
+    /*  496 */ {  9,  -2,   2 }, {  9,   2,   2 }, {  9,  -2,  -2 }, {  9,   2,  -2 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /*  504 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }
+};
+
+/* HCB_6, 9 bits, 507 of 512 entries decode in one step */
+static hcb_2_pair hcb6_fast[] = {
+    /*    0 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*    8 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   16 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   24 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   32 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*   40 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*   48 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*   56 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*   64 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*   72 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*   80 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*   88 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*   96 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  104 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  112 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  120 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  128 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  136 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  144 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  152 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  160 */ {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 },
+    /*  168 */ {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 },
+    /*  176 */ {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 },
+    /*  184 */ {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 }, {  4,   1,   1 },
+    /*  192 */ {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 },
+    /*  200 */ {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 },
+    /*  208 */ {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 },
+    /*  216 */ {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 }, {  4,  -1,   1 },
+    /*  224 */ {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 },
+    /*  232 */ {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 },
+    /*  240 */ {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 },
+    /*  248 */ {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 }, {  4,   1,  -1 },
+    /*  256 */ {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 },
+    /*  264 */ {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 },
+    /*  272 */ {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 },
+    /*  280 */ {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 }, {  4,  -1,  -1 },
+    /*  288 */ {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 },
+    /*  296 */ {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 },
+    /*  304 */ {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 },
+    /*  312 */ {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 },
+    /*  320 */ {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 },
+    /*  328 */ {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 },
+    /*  336 */ {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 },
+    /*  344 */ {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 },
+    /*  352 */ {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 },
+    /*  360 */ {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 },
+    /*  368 */ {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 },
+    /*  376 */ {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 },
+    /*  384 */ {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 },
+    /*  392 */ {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 },
+    /*  400 */ {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 },
+    /*  408 */ {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 },
+    /*  416 */ {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 },
+    /*  424 */ {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 },
+    /*  432 */ {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 },
+    /*  440 */ {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 },
+    /*  448 */ {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 },
+    /*  456 */ {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 },
+    /*  464 */ {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -2,   3 }, {  8,  -2,   3 },
+    /*  472 */ {  8,   2,   3 }, {  8,   2,   3 }, {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 },
+    /*  480 */ {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,   3,   3 }, {  8,   3,   3 }, {  9,   3,  -3 }, {  9,  -3,  -3 }, {  9,  -3,   3 }, {  9,   1,  -4 },
+    /*  488 */ {  9,  -1,  -4 }, {  9,   4,   1 }, {  9,  -4,   1 }, {  9,  -4,  -1 }, {  9,   1,   4 }, {  9,   4,  -1 }, {  9,  -1,   4 }, {  9,   0,  -4 },
+    /*  496 */ {  9,  -4,   2 }, {  9,  -4,  -2 }, {  9,   2,   4 }, {  9,  -2,  -4 }, {  9,  -4,   0 }, {  9,   4,   2 }, {  9,   4,  -2 }, {  9,  -2,   4 },
+    /*  504 */ {  9,   4,   0 }, {  9,   2,  -4 }, {  9,   0,   4 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }
+};
+
+/* HCB_7, 10 bits, 980 of 1024 entries decode in one step */
+static hcb_2_pair hcb7_fast[] = {
+    /*    0 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*    8 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   16 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   24 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   32 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   40 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   48 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   56 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   64 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   72 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   80 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   88 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   96 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  104 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  112 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  120 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  128 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  136 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  144 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  152 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  160 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  168 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  176 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  184 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  192 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  200 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  208 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  216 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  224 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  232 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  240 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  248 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  256 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  264 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  272 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  280 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  288 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  296 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  304 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  312 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  320 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  328 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  336 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  344 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  352 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  360 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  368 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  376 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  384 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  392 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  400 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  408 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  416 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  424 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  432 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  440 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  448 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  456 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  464 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  472 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  480 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  488 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  496 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  504 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  512 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  520 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  528 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  536 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  544 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  552 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  560 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  568 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /*  576 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  584 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  592 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  600 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  608 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  616 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  624 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  632 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /*  640 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  648 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  656 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  664 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  672 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  680 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  688 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  696 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /*  704 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  712 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  720 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  728 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  736 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  744 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  752 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  760 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /*  768 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*  776 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*  784 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*  792 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*  800 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*  808 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*  816 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  824 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  832 */ {  8,   2,   1 }, {  8,   2,   1 }, {  8,   2,   1 }, {  8,   2,   1 }, {  8,   2,  -1 }, {  8,   2,  -1 }, {  8,   2,  -1 }, {  8,   2,  -1 },
+    /*  840 */ {  8,  -2,   1 }, {  8,  -2,   1 }, {  8,  -2,   1 }, {  8,  -2,   1 }, {  8,  -2,  -1 }, {  8,  -2,  -1 }, {  8,  -2,  -1 }, {  8,  -2,  -1 },
+    /*  848 */ {  8,   1,   2 }, {  8,   1,   2 }, {  8,   1,   2 }, {  8,   1,   2 }, {  8,   1,  -2 }, {  8,   1,  -2 }, {  8,   1,  -2 }, {  8,   1,  -2 },
+    /*  856 */ {  8,  -1,   2 }, {  8,  -1,   2 }, {  8,  -1,   2 }, {  8,  -1,   2 }, {  8,  -1,  -2 }, {  8,  -1,  -2 }, {  8,  -1,  -2 }, {  8,  -1,  -2 },
+    /*  864 */ {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 },
+    /*  872 */ {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 },
+    /*  880 */ {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 },
+    /*  888 */ {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 },
+    /*  896 */ {  9,   3,   1 }, {  9,   3,   1 }, {  9,   3,  -1 }, {  9,   3,  -1 }, {  9,  -3,   1 }, {  9,  -3,   1 }, {  9,  -3,  -1 }, {  9,  -3,  -1 },
+    /*  904 */ {  9,   1,   3 }, {  9,   1,   3 }, {  9,   1,  -3 }, {  9,   1,  -3 }, {  9,  -1,   3 }, {  9,  -1,   3 }, {  9,  -1,  -3 }, {  9,  -1,  -3 },
+    /*  912 */ {  9,   2,   2 }, {  9,   2,   2 }, {  9,   2,  -2 }, {  9,   2,  -2 }, {  9,  -2,   2 }, {  9,  -2,   2 }, {  9,  -2,  -2 }, {  9,  -2,  -2 },
+    /*  920 */ {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 },
+    /*  928 */ {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 },
+    /*  936 */ { 10,   2,   3 }, { 10,   2,  -3 }, { 10,  -2,   3 }, { 10,  -2,  -3 }, { 10,   3,   2 }, { 10,   3,  -2 }, { 10,  -3,   2 }, { 10,  -3,  -2 },
+    /*  944 */ { 10,   1,   4 }, { 10,   1,  -4 }, { 10,  -1,   4 }, { 10,  -1,  -4 }, { 10,   4,   1 }, { 10,   4,  -1 }, { 10,  -4,   1 }, { 10,  -4,  -1 },
+    /*  952 */ { 10,   1,   5 }, { 10,   1,  -5 }, { 10,  -1,   5 }, { 10,  -1,  -5 }, { 10,   5,   1 }, { 10,   5,  -1 }, { 10,  -5,   1 }, { 10,  -5,  -1 },
+    /*  960 */ { 10,   3,   3 }, { 10,   3,  -3 }, { 10,  -3,   3 }, { 10,  -3,  -3 }, { 10,   2,   4 }, { 10,   2,  -4 }, { 10,  -2,   4 }, { 10,  -2,  -4 },
+    /*  968 */ {  9,   0,   4 }, {  9,   0,   4 }, {  9,   0,  -4 }, {  9,   0,  -4 }, {  9,   4,   0 }, {  9,   4,   0 }, {  9,  -4,   0 }, {  9,  -4,   0 },
+    /*  976 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, { 10,   0,   5 }, { 10,   0,  -5 },
+    /*  984 */ {  0,   0,   0 }, {  0,   0,   0 }, { 10,   5,   0 }, { 10,  -5,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /*  992 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1000 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1008 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1016 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }
+};
+
+/* HCB_8, 10 bits, 1008 of 1024 entries decode in one step */
+static hcb_2_pair hcb8_fast[] = {
+    /*    0 */ {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 },
+    /*    8 */ {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 },
+    /*   16 */ {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 },
+    /*   24 */ {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 }, {  5,   1,   1 },
+    /*   32 */ {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 },
+    /*   40 */ {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 },
+    /*   48 */ {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 },
+    /*   56 */ {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 }, {  5,   1,  -1 },
+    /*   64 */ {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 },
+    /*   72 */ {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 },
+    /*   80 */ {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 },
+    /*   88 */ {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 }, {  5,  -1,   1 },
+    /*   96 */ {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 },
+    /*  104 */ {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 },
+    /*  112 */ {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 },
+    /*  120 */ {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 }, {  5,  -1,  -1 },
+    /*  128 */ {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 },
+    /*  136 */ {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 },
+    /*  144 */ {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 },
+    /*  152 */ {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 },
+    /*  160 */ {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 },
+    /*  168 */ {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 },
+    /*  176 */ {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 },
+    /*  184 */ {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 },
+    /*  192 */ {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 },
+    /*  200 */ {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 },
+    /*  208 */ {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 },
+    /*  216 */ {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 }, {  5,   1,   0 },
+    /*  224 */ {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 },
+    /*  232 */ {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 },
+    /*  240 */ {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 },
+    /*  248 */ {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 }, {  5,  -1,   0 },
+    /*  256 */ {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 },
+    /*  264 */ {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 },
+    /*  272 */ {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 },
+    /*  280 */ {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 },
+    /*  288 */ {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 },
+    /*  296 */ {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 },
+    /*  304 */ {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 },
+    /*  312 */ {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 },
+    /*  320 */ {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 },
+    /*  328 */ {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 },
+    /*  336 */ {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 },
+    /*  344 */ {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 }, {  5,   0,   1 },
+    /*  352 */ {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 },
+    /*  360 */ {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 },
+    /*  368 */ {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 },
+    /*  376 */ {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 }, {  5,   0,  -1 },
+    /*  384 */ {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 },
+    /*  392 */ {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 }, {  6,   2,   2 },
+    /*  400 */ {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 },
+    /*  408 */ {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 }, {  6,   2,  -2 },
+    /*  416 */ {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 },
+    /*  424 */ {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 }, {  6,  -2,   2 },
+    /*  432 */ {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 },
+    /*  440 */ {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 }, {  6,  -2,  -2 },
+    /*  448 */ {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 },
+    /*  456 */ {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 },
+    /*  464 */ {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 },
+    /*  472 */ {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 }, {  5,   0,   0 },
+    /*  480 */ {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 },
+    /*  488 */ {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 }, {  6,   2,   0 },
+    /*  496 */ {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 },
+    /*  504 */ {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 }, {  6,  -2,   0 },
+    /*  512 */ {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 },
+    /*  520 */ {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 }, {  6,   0,   2 },
+    /*  528 */ {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 },
+    /*  536 */ {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 }, {  6,   0,  -2 },
+    /*  544 */ {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 },
+    /*  552 */ {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 },
+    /*  560 */ {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 },
+    /*  568 */ {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 },
+    /*  576 */ {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 },
+    /*  584 */ {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 },
+    /*  592 */ {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 },
+    /*  600 */ {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 },
+    /*  608 */ {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 },
+    /*  616 */ {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 },
+    /*  624 */ {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 },
+    /*  632 */ {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 },
+    /*  640 */ {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 },
+    /*  648 */ {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 },
+    /*  656 */ {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 },
+    /*  664 */ {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 },
+    /*  672 */ {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 },
+    /*  680 */ {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 },
+    /*  688 */ {  8,   4,   1 }, {  8,   4,   1 }, {  8,   4,   1 }, {  8,   4,   1 }, {  8,   4,  -1 }, {  8,   4,  -1 }, {  8,   4,  -1 }, {  8,   4,  -1 },
+    /*  696 */ {  8,  -4,   1 }, {  8,  -4,   1 }, {  8,  -4,   1 }, {  8,  -4,   1 }, {  8,  -4,  -1 }, {  8,  -4,  -1 }, {  8,  -4,  -1 }, {  8,  -4,  -1 },
+    /*  704 */ {  8,   1,   4 }, {  8,   1,   4 }, {  8,   1,   4 }, {  8,   1,   4 }, {  8,   1,  -4 }, {  8,   1,  -4 }, {  8,   1,  -4 }, {  8,   1,  -4 },
+    /*  712 */ {  8,  -1,   4 }, {  8,  -1,   4 }, {  8,  -1,   4 }, {  8,  -1,   4 }, {  8,  -1,  -4 }, {  8,  -1,  -4 }, {  8,  -1,  -4 }, {  8,  -1,  -4 },
+    /*  720 */ {  8,   4,   2 }, {  8,   4,   2 }, {  8,   4,   2 }, {  8,   4,   2 }, {  8,   4,  -2 }, {  8,   4,  -2 }, {  8,   4,  -2 }, {  8,   4,  -2 },
+    /*  728 */ {  8,  -4,   2 }, {  8,  -4,   2 }, {  8,  -4,   2 }, {  8,  -4,   2 }, {  8,  -4,  -2 }, {  8,  -4,  -2 }, {  8,  -4,  -2 }, {  8,  -4,  -2 },
+    /*  736 */ {  8,   2,   4 }, {  8,   2,   4 }, {  8,   2,   4 }, {  8,   2,   4 }, {  8,   2,  -4 }, {  8,   2,  -4 }, {  8,   2,  -4 }, {  8,   2,  -4 },
+    /*  744 */ {  8,  -2,   4 }, {  8,  -2,   4 }, {  8,  -2,   4 }, {  8,  -2,   4 }, {  8,  -2,  -4 }, {  8,  -2,  -4 }, {  8,  -2,  -4 }, {  8,  -2,  -4 },
+    /*  752 */ {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 },
+    /*  760 */ {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 },
+    /*  768 */ {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 },
+    /*  776 */ {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 },
+    /*  784 */ {  8,   4,   3 }, {  8,   4,   3 }, {  8,   4,   3 }, {  8,   4,   3 }, {  8,   4,  -3 }, {  8,   4,  -3 }, {  8,   4,  -3 }, {  8,   4,  -3 },
+    /*  792 */ {  8,  -4,   3 }, {  8,  -4,   3 }, {  8,  -4,   3 }, {  8,  -4,   3 }, {  8,  -4,  -3 }, {  8,  -4,  -3 }, {  8,  -4,  -3 }, {  8,  -4,  -3 },
+    /*  800 */ {  8,   3,   4 }, {  8,   3,   4 }, {  8,   3,   4 }, {  8,   3,   4 }, {  8,   3,  -4 }, {  8,   3,  -4 }, {  8,   3,  -4 }, {  8,   3,  -4 },
+    /*  808 */ {  8,  -3,   4 }, {  8,  -3,   4 }, {  8,  -3,   4 }, {  8,  -3,   4 }, {  8,  -3,  -4 }, {  8,  -3,  -4 }, {  8,  -3,  -4 }, {  8,  -3,  -4 },
+    /*  816 */ {  8,   5,   2 }, {  8,   5,   2 }, {  8,   5,   2 }, {  8,   5,   2 }, {  8,   5,  -2 }, {  8,   5,  -2 }, {  8,   5,  -2 }, {  8,   5,  -2 },
+    /*  824 */ {  8,  -5,   2 }, {  8,  -5,   2 }, {  8,  -5,   2 }, {  8,  -5,   2 }, {  8,  -5,  -2 }, {  8,  -5,  -2 }, {  8,  -5,  -2 }, {  8,  -5,  -2 },
+    /*  832 */ {  9,   5,   1 }, {  9,   5,   1 }, {  9,   5,  -1 }, {  9,   5,  -1 }, {  9,  -5,   1 }, {  9,  -5,   1 }, {  9,  -5,  -1 }, {  9,  -5,  -1 },
+    /*  840 */ {  9,   2,   5 }, {  9,   2,   5 }, {  9,   2,  -5 }, {  9,   2,  -5 }, {  9,  -2,   5 }, {  9,  -2,   5 }, {  9,  -2,  -5 }, {  9,  -2,  -5 },
+    /*  848 */ {  9,   1,   5 }, {  9,   1,   5 }, {  9,   1,  -5 }, {  9,   1,  -5 }, {  9,  -1,   5 }, {  9,  -1,   5 }, {  9,  -1,  -5 }, {  9,  -1,  -5 },
+    /*  856 */ {  9,   5,   3 }, {  9,   5,   3 }, {  9,   5,  -3 }, {  9,   5,  -3 }, {  9,  -5,   3 }, {  9,  -5,   3 }, {  9,  -5,  -3 }, {  9,  -5,  -3 },
+    /*  864 */ {  9,   3,   5 }, {  9,   3,   5 }, {  9,   3,  -5 }, {  9,   3,  -5 }, {  9,  -3,   5 }, {  9,  -3,   5 }, {  9,  -3,  -5 }, {  9,  -3,  -5 },
+    /*  872 */ {  9,   4,   4 }, {  9,   4,   4 }, {  9,   4,  -4 }, {  9,   4,  -4 }, {  9,  -4,   4 }, {  9,  -4,   4 }, {  9,  -4,  -4 }, {  9,  -4,  -4 },
+    /*  880 */ {  9,   5,   4 }, {  9,   5,   4 }, {  9,   5,  -4 }, {  9,   5,  -4 }, {  9,  -5,   4 }, {  9,  -5,   4 }, {  9,  -5,  -4 }, {  9,  -5,  -4 },
+    /*  888 */ {  8,   0,   4 }, {  8,   0,   4 }, {  8,   0,   4 }, {  8,   0,   4 }, {  8,   0,  -4 }, {  8,   0,  -4 }, {  8,   0,  -4 }, {  8,   0,  -4 },
+    /*  896 */ {  9,   4,   5 }, {  9,   4,   5 }, {  9,   4,  -5 }, {  9,   4,  -5 }, {  9,  -4,   5 }, {  9,  -4,   5 }, {  9,  -4,  -5 }, {  9,  -4,  -5 },
+    /*  904 */ {  8,   4,   0 }, {  8,   4,   0 }, {  8,   4,   0 }, {  8,   4,   0 }, {  8,  -4,   0 }, {  8,  -4,   0 }, {  8,  -4,   0 }, {  8,  -4,   0 },
+    /*  912 */ {  9,   2,   6 }, {  9,   2,   6 }, {  9,   2,  -6 }, {  9,   2,  -6 }, {  9,  -2,   6 }, {  9,  -2,   6 }, {  9,  -2,  -6 }, {  9,  -2,  -6 },
+    /*  920 */ {  9,   6,   2 }, {  9,   6,   2 }, {  9,   6,  -2 }, {  9,   6,  -2 }, {  9,  -6,   2 }, {  9,  -6,   2 }, {  9,  -6,  -2 }, {  9,  -6,  -2 },
+    /*  928 */ {  9,   6,   1 }, {  9,   6,   1 }, {  9,   6,  -1 }, {  9,   6,  -1 }, {  9,  -6,   1 }, {  9,  -6,   1 }, {  9,  -6,  -1 }, {  9,  -6,  -1 },
+    /*  936 */ {  9,   1,   6 }, {  9,   1,   6 }, {  9,   1,  -6 }, {  9,   1,  -6 }, {  9,  -1,   6 }, {  9,  -1,   6 }, {  9,  -1,  -6 }, {  9,  -1,  -6 },
+    /*  944 */ { 10,   3,   6 }, { 10,   3,  -6 }, { 10,  -3,   6 }, { 10,  -3,  -6 }, { 10,   6,   3 }, { 10,   6,  -3 }, { 10,  -6,   3 }, { 10,  -6,  -3 },
+    /*  952 */ { 10,   5,   5 }, { 10,   5,  -5 }, { 10,  -5,   5 }, { 10,  -5,  -5 }, {  9,   5,   0 }, {  9,   5,   0 }, {  9,  -5,   0 }, {  9,  -5,   0 },
+    /*  960 */ { 10,   6,   4 }, { 10,   6,  -4 }, { 10,  -6,   4 }, { 10,  -6,  -4 }, {  9,   0,   5 }, {  9,   0,   5 }, {  9,   0,  -5 }, {  9,   0,  -5 },
+    /*  968 */ { 10,   4,   6 }, { 10,   4,  -6 }, { 10,  -4,   6 }, { 10,  -4,  -6 }, { 10,   7,   1 }, { 10,   7,  -1 }, { 10,  -7,   1 }, { 10,  -7,  -1 },
+    /*  976 */ { 10,   7,   2 }, { 10,   7,  -2 }, { 10,  -7,   2 }, { 10,  -7,  -2 }, { 10,   2,   7 }, { 10,   2,  -7 }, { 10,  -2,   7 }, { 10,  -2,  -7 },
+    /*  984 */ { 10,   6,   5 }, { 10,   6,  -5 }, { 10,  -6,   5 }, { 10,  -6,  -5 }, { 10,   7,   3 }, { 10,   7,  -3 }, { 10,  -7,   3 }, { 10,  -7,  -3 },
+    /*  992 */ { 10,   1,   7 }, { 10,   1,  -7 }, { 10,  -1,   7 }, { 10,  -1,  -7 }, { 10,   5,   6 }, { 10,   5,  -6 }, { 10,  -5,   6 }, { 10,  -5,  -6 },
+    /* 1000 */ { 10,   3,   7 }, { 10,   3,  -7 }, { 10,  -3,   7 }, { 10,  -3,  -7 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1008 */ { 10,   6,   0 }, { 10,  -6,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, { 10,   0,   6 }, { 10,   0,  -6 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1016 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }
+};
+
+/* HCB_9, 11 bits, 1954 of 2048 entries decode in one step */
+static hcb_2_pair hcb9_fast[] = {
+    /*    0 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*    8 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   16 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   24 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   32 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   40 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   48 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   56 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   64 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   72 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   80 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   88 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*   96 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  104 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  112 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  120 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  128 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  136 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  144 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  152 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  160 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  168 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  176 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  184 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  192 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  200 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  208 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  216 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  224 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  232 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  240 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  248 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  256 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  264 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  272 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  280 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  288 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  296 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  304 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  312 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  320 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  328 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  336 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  344 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  352 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  360 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  368 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  376 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  384 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  392 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  400 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  408 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  416 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  424 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  432 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  440 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  448 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  456 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  464 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  472 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  480 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  488 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  496 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  504 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  512 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  520 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  528 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  536 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  544 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  552 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  560 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  568 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  576 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  584 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  592 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  600 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  608 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  616 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  624 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  632 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  640 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  648 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  656 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  664 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  672 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  680 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  688 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  696 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  704 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  712 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  720 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  728 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  736 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  744 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  752 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  760 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  768 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  776 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  784 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  792 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  800 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  808 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  816 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  824 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  832 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  840 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  848 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  856 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  864 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  872 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  880 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  888 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  896 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  904 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  912 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  920 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  928 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  936 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  944 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  952 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  960 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  968 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  976 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  984 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /*  992 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /* 1000 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /* 1008 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /* 1016 */ {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 }, {  1,   0,   0 },
+    /* 1024 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1032 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1040 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1048 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1056 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1064 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1072 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1080 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1088 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1096 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1104 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1112 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1120 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1128 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1136 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1144 */ {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 }, {  4,   1,   0 },
+    /* 1152 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1160 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1168 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1176 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1184 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1192 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1200 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1208 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1216 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1224 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1232 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1240 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1248 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1256 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1264 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1272 */ {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 }, {  4,  -1,   0 },
+    /* 1280 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1288 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1296 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1304 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1312 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1320 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1328 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1336 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1344 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1352 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1360 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1368 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1376 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1384 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1392 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1400 */ {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 }, {  4,   0,   1 },
+    /* 1408 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1416 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1424 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1432 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1440 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1448 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1456 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1464 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1472 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1480 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1488 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1496 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1504 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1512 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1520 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1528 */ {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 }, {  4,   0,  -1 },
+    /* 1536 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /* 1544 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /* 1552 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /* 1560 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /* 1568 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /* 1576 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /* 1584 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /* 1592 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /* 1600 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /* 1608 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /* 1616 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /* 1624 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /* 1632 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /* 1640 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /* 1648 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /* 1656 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /* 1664 */ {  8,   2,   1 }, {  8,   2,   1 }, {  8,   2,   1 }, {  8,   2,   1 }, {  8,   2,   1 }, {  8,   2,   1 }, {  8,   2,   1 }, {  8,   2,   1 },
+    /* 1672 */ {  8,   2,  -1 }, {  8,   2,  -1 }, {  8,   2,  -1 }, {  8,   2,  -1 }, {  8,   2,  -1 }, {  8,   2,  -1 }, {  8,   2,  -1 }, {  8,   2,  -1 },
+    /* 1680 */ {  8,  -2,   1 }, {  8,  -2,   1 }, {  8,  -2,   1 }, {  8,  -2,   1 }, {  8,  -2,   1 }, {  8,  -2,   1 }, {  8,  -2,   1 }, {  8,  -2,   1 },
+    /* 1688 */ {  8,  -2,  -1 }, {  8,  -2,  -1 }, {  8,  -2,  -1 }, {  8,  -2,  -1 }, {  8,  -2,  -1 }, {  8,  -2,  -1 }, {  8,  -2,  -1 }, {  8,  -2,  -1 },
+    /* 1696 */ {  8,   1,   2 }, {  8,   1,   2 }, {  8,   1,   2 }, {  8,   1,   2 }, {  8,   1,   2 }, {  8,   1,   2 }, {  8,   1,   2 }, {  8,   1,   2 },
+    /* 1704 */ {  8,   1,  -2 }, {  8,   1,  -2 }, {  8,   1,  -2 }, {  8,   1,  -2 }, {  8,   1,  -2 }, {  8,   1,  -2 }, {  8,   1,  -2 }, {  8,   1,  -2 },
+    /* 1712 */ {  8,  -1,   2 }, {  8,  -1,   2 }, {  8,  -1,   2 }, {  8,  -1,   2 }, {  8,  -1,   2 }, {  8,  -1,   2 }, {  8,  -1,   2 }, {  8,  -1,   2 },
+    /* 1720 */ {  8,  -1,  -2 }, {  8,  -1,  -2 }, {  8,  -1,  -2 }, {  8,  -1,  -2 }, {  8,  -1,  -2 }, {  8,  -1,  -2 }, {  8,  -1,  -2 }, {  8,  -1,  -2 },
+    /* 1728 */ {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 },
+    /* 1736 */ {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 },
+    /* 1744 */ {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 },
+    /* 1752 */ {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 },
+    /* 1760 */ {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 },
+    /* 1768 */ {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 },
+    /* 1776 */ {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 },
+    /* 1784 */ {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 },
+    /* 1792 */ {  9,   3,   1 }, {  9,   3,   1 }, {  9,   3,   1 }, {  9,   3,   1 }, {  9,   3,  -1 }, {  9,   3,  -1 }, {  9,   3,  -1 }, {  9,   3,  -1 },
+    /* 1800 */ {  9,  -3,   1 }, {  9,  -3,   1 }, {  9,  -3,   1 }, {  9,  -3,   1 }, {  9,  -3,  -1 }, {  9,  -3,  -1 }, {  9,  -3,  -1 }, {  9,  -3,  -1 },
+    /* 1808 */ {  9,   2,   2 }, {  9,   2,   2 }, {  9,   2,   2 }, {  9,   2,   2 }, {  9,   2,  -2 }, {  9,   2,  -2 }, {  9,   2,  -2 }, {  9,   2,  -2 },
+    /* 1816 */ {  9,  -2,   2 }, {  9,  -2,   2 }, {  9,  -2,   2 }, {  9,  -2,   2 }, {  9,  -2,  -2 }, {  9,  -2,  -2 }, {  9,  -2,  -2 }, {  9,  -2,  -2 },
+    /* 1824 */ {  9,   1,   3 }, {  9,   1,   3 }, {  9,   1,   3 }, {  9,   1,   3 }, {  9,   1,  -3 }, {  9,   1,  -3 }, {  9,   1,  -3 }, {  9,   1,  -3 },
+    /* 1832 */ {  9,  -1,   3 }, {  9,  -1,   3 }, {  9,  -1,   3 }, {  9,  -1,   3 }, {  9,  -1,  -3 }, {  9,  -1,  -3 }, {  9,  -1,  -3 }, {  9,  -1,  -3 },
+    /* 1840 */ {  9,   3,   0 }, {  9,   3,   0 }, {  9,   3,   0 }, {  9,   3,   0 }, {  9,  -3,   0 }, {  9,  -3,   0 }, {  9,  -3,   0 }, {  9,  -3,   0 },
+    /* 1848 */ {  9,   0,   3 }, {  9,   0,   3 }, {  9,   0,   3 }, {  9,   0,   3 }, {  9,   0,  -3 }, {  9,   0,  -3 }, {  9,   0,  -3 }, {  9,   0,  -3 },
+    /* 1856 */ { 10,   2,   3 }, { 10,   2,   3 }, { 10,   2,  -3 }, { 10,   2,  -3 }, { 10,  -2,   3 }, { 10,  -2,   3 }, { 10,  -2,  -3 }, { 10,  -2,  -3 },
+    /* 1864 */ { 10,   3,   2 }, { 10,   3,   2 }, { 10,   3,  -2 }, { 10,   3,  -2 }, { 10,  -3,   2 }, { 10,  -3,   2 }, { 10,  -3,  -2 }, { 10,  -3,  -2 },
+    /* 1872 */ { 10,   1,   4 }, { 10,   1,   4 }, { 10,   1,  -4 }, { 10,   1,  -4 }, { 10,  -1,   4 }, { 10,  -1,   4 }, { 10,  -1,  -4 }, { 10,  -1,  -4 },
+    /* 1880 */ { 10,   4,   1 }, { 10,   4,   1 }, { 10,   4,  -1 }, { 10,   4,  -1 }, { 10,  -4,   1 }, { 10,  -4,   1 }, { 10,  -4,  -1 }, { 10,  -4,  -1 },
+    /* 1888 */ { 10,   2,   4 }, { 10,   2,   4 }, { 10,   2,  -4 }, { 10,   2,  -4 }, { 10,  -2,   4 }, { 10,  -2,   4 }, { 10,  -2,  -4 }, { 10,  -2,  -4 },
+    /* 1896 */ { 10,   1,   5 }, { 10,   1,   5 }, { 10,   1,  -5 }, { 10,   1,  -5 }, { 10,  -1,   5 }, { 10,  -1,   5 }, { 10,  -1,  -5 }, { 10,  -1,  -5 },
+    /* 1904 */ { 11,   4,   2 }, { 11,   4,  -2 }, { 11,  -4,   2 }, { 11,  -4,  -2 }, { 11,   3,   3 }, { 11,   3,  -3 }, { 11,  -3,   3 }, { 11,  -3,  -3 },
+    /* 1912 */ { 10,   0,   4 }, { 10,   0,   4 }, { 10,   0,  -4 }, { 10,   0,  -4 }, { 10,   4,   0 }, { 10,   4,   0 }, { 10,  -4,   0 }, { 10,  -4,   0 },
+    /* 1920 */ { 11,   5,   1 }, { 11,   5,  -1 }, { 11,  -5,   1 }, { 11,  -5,  -1 }, { 11,   2,   5 }, { 11,   2,  -5 }, { 11,  -2,   5 }, { 11,  -2,  -5 },
+    /* 1928 */ { 11,   1,   6 }, { 11,   1,  -6 }, { 11,  -1,   6 }, { 11,  -1,  -6 }, { 11,   3,   4 }, { 11,   3,  -4 }, { 11,  -3,   4 }, { 11,  -3,  -4 },
+    /* 1936 */ { 11,   5,   2 }, { 11,   5,  -2 }, { 11,  -5,   2 }, { 11,  -5,  -2 }, { 11,   6,   1 }, { 11,   6,  -1 }, { 11,  -6,   1 }, { 11,  -6,  -1 },
+    /* 1944 */ { 11,   4,   3 }, { 11,   4,  -3 }, { 11,  -4,   3 }, { 11,  -4,  -3 }, { 11,   0,   5 }, { 11,   0,  -5 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1952 */ { 11,   5,   0 }, { 11,  -5,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1960 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1968 */ {  0,   0,   0 }, {  0,   0,   0 }, { 11,   0,   6 }, { 11,   0,  -6 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1976 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1984 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1992 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 2000 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 2008 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 2016 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 2024 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 2032 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 2040 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }
+};
+
+/* HCB_10, 11 bits, 1950 of 2048 entries decode in one step */
+static hcb_2_pair hcb10_fast[] = {
+    /*    0 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*    8 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*   16 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*   24 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*   32 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*   40 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*   48 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*   56 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*   64 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*   72 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*   80 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*   88 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*   96 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  104 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  112 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  120 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  128 */ {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 },
+    /*  136 */ {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 },
+    /*  144 */ {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 },
+    /*  152 */ {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 }, {  6,   1,   2 },
+    /*  160 */ {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 },
+    /*  168 */ {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 },
+    /*  176 */ {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 },
+    /*  184 */ {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 }, {  6,   1,  -2 },
+    /*  192 */ {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 },
+    /*  200 */ {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 },
+    /*  208 */ {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 },
+    /*  216 */ {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 }, {  6,  -1,   2 },
+    /*  224 */ {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 },
+    /*  232 */ {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 },
+    /*  240 */ {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 },
+    /*  248 */ {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 }, {  6,  -1,  -2 },
+    /*  256 */ {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 },
+    /*  264 */ {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 },
+    /*  272 */ {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 },
+    /*  280 */ {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 }, {  6,   2,   1 },
+    /*  288 */ {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 },
+    /*  296 */ {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 },
+    /*  304 */ {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 },
+    /*  312 */ {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 }, {  6,   2,  -1 },
+    /*  320 */ {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 },
+    /*  328 */ {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 },
+    /*  336 */ {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 },
+    /*  344 */ {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 }, {  6,  -2,   1 },
+    /*  352 */ {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 },
+    /*  360 */ {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 },
+    /*  368 */ {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 },
+    /*  376 */ {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 }, {  6,  -2,  -1 },
+    /*  384 */ {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 },
+    /*  392 */ {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 },
+    /*  400 */ {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 },
+    /*  408 */ {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 },
+    /*  416 */ {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 },
+    /*  424 */ {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 },
+    /*  432 */ {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 },
+    /*  440 */ {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 },
+    /*  448 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  456 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  464 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  472 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  480 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  488 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  496 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  504 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  512 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  520 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  528 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  536 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  544 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  552 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  560 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  568 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  576 */ {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 },
+    /*  584 */ {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 }, {  7,   1,   3 },
+    /*  592 */ {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 },
+    /*  600 */ {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 }, {  7,   1,  -3 },
+    /*  608 */ {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 },
+    /*  616 */ {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 }, {  7,  -1,   3 },
+    /*  624 */ {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 },
+    /*  632 */ {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 }, {  7,  -1,  -3 },
+    /*  640 */ {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 },
+    /*  648 */ {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 }, {  7,   3,   2 },
+    /*  656 */ {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 },
+    /*  664 */ {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 }, {  7,   3,  -2 },
+    /*  672 */ {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 },
+    /*  680 */ {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 }, {  7,  -3,   2 },
+    /*  688 */ {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 },
+    /*  696 */ {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 }, {  7,  -3,  -2 },
+    /*  704 */ {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 },
+    /*  712 */ {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 }, {  7,   3,   1 },
+    /*  720 */ {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 },
+    /*  728 */ {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 }, {  7,   3,  -1 },
+    /*  736 */ {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 },
+    /*  744 */ {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 }, {  7,  -3,   1 },
+    /*  752 */ {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 },
+    /*  760 */ {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 }, {  7,  -3,  -1 },
+    /*  768 */ {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 },
+    /*  776 */ {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 }, {  7,   2,   3 },
+    /*  784 */ {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 },
+    /*  792 */ {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 }, {  7,   2,  -3 },
+    /*  800 */ {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 },
+    /*  808 */ {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 }, {  7,  -2,   3 },
+    /*  816 */ {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 },
+    /*  824 */ {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 }, {  7,  -2,  -3 },
+    /*  832 */ {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 },
+    /*  840 */ {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 }, {  7,   3,   3 },
+    /*  848 */ {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 },
+    /*  856 */ {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 }, {  7,   3,  -3 },
+    /*  864 */ {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 },
+    /*  872 */ {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 }, {  7,  -3,   3 },
+    /*  880 */ {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 },
+    /*  888 */ {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 }, {  7,  -3,  -3 },
+    /*  896 */ {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 },
+    /*  904 */ {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 },
+    /*  912 */ {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 },
+    /*  920 */ {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 },
+    /*  928 */ {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 },
+    /*  936 */ {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 },
+    /*  944 */ {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 },
+    /*  952 */ {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 },
+    /*  960 */ {  8,   2,   4 }, {  8,   2,   4 }, {  8,   2,   4 }, {  8,   2,   4 }, {  8,   2,   4 }, {  8,   2,   4 }, {  8,   2,   4 }, {  8,   2,   4 },
+    /*  968 */ {  8,   2,  -4 }, {  8,   2,  -4 }, {  8,   2,  -4 }, {  8,   2,  -4 }, {  8,   2,  -4 }, {  8,   2,  -4 }, {  8,   2,  -4 }, {  8,   2,  -4 },
+    /*  976 */ {  8,  -2,   4 }, {  8,  -2,   4 }, {  8,  -2,   4 }, {  8,  -2,   4 }, {  8,  -2,   4 }, {  8,  -2,   4 }, {  8,  -2,   4 }, {  8,  -2,   4 },
+    /*  984 */ {  8,  -2,  -4 }, {  8,  -2,  -4 }, {  8,  -2,  -4 }, {  8,  -2,  -4 }, {  8,  -2,  -4 }, {  8,  -2,  -4 }, {  8,  -2,  -4 }, {  8,  -2,  -4 },
+    /*  992 */ {  8,   4,   2 }, {  8,   4,   2 }, {  8,   4,   2 }, {  8,   4,   2 }, {  8,   4,   2 }, {  8,   4,   2 }, {  8,   4,   2 }, {  8,   4,   2 },
+    /* 1000 */ {  8,   4,  -2 }, {  8,   4,  -2 }, {  8,   4,  -2 }, {  8,   4,  -2 }, {  8,   4,  -2 }, {  8,   4,  -2 }, {  8,   4,  -2 }, {  8,   4,  -2 },
+    /* 1008 */ {  8,  -4,   2 }, {  8,  -4,   2 }, {  8,  -4,   2 }, {  8,  -4,   2 }, {  8,  -4,   2 }, {  8,  -4,   2 }, {  8,  -4,   2 }, {  8,  -4,   2 },
+    /* 1016 */ {  8,  -4,  -2 }, {  8,  -4,  -2 }, {  8,  -4,  -2 }, {  8,  -4,  -2 }, {  8,  -4,  -2 }, {  8,  -4,  -2 }, {  8,  -4,  -2 }, {  8,  -4,  -2 },
+    /* 1024 */ {  8,   1,   4 }, {  8,   1,   4 }, {  8,   1,   4 }, {  8,   1,   4 }, {  8,   1,   4 }, {  8,   1,   4 }, {  8,   1,   4 }, {  8,   1,   4 },
+    /* 1032 */ {  8,   1,  -4 }, {  8,   1,  -4 }, {  8,   1,  -4 }, {  8,   1,  -4 }, {  8,   1,  -4 }, {  8,   1,  -4 }, {  8,   1,  -4 }, {  8,   1,  -4 },
+    /* 1040 */ {  8,  -1,   4 }, {  8,  -1,   4 }, {  8,  -1,   4 }, {  8,  -1,   4 }, {  8,  -1,   4 }, {  8,  -1,   4 }, {  8,  -1,   4 }, {  8,  -1,   4 },
+    /* 1048 */ {  8,  -1,  -4 }, {  8,  -1,  -4 }, {  8,  -1,  -4 }, {  8,  -1,  -4 }, {  8,  -1,  -4 }, {  8,  -1,  -4 }, {  8,  -1,  -4 }, {  8,  -1,  -4 },
+    /* 1056 */ {  8,   4,   1 }, {  8,   4,   1 }, {  8,   4,   1 }, {  8,   4,   1 }, {  8,   4,   1 }, {  8,   4,   1 }, {  8,   4,   1 }, {  8,   4,   1 },
+    /* 1064 */ {  8,   4,  -1 }, {  8,   4,  -1 }, {  8,   4,  -1 }, {  8,   4,  -1 }, {  8,   4,  -1 }, {  8,   4,  -1 }, {  8,   4,  -1 }, {  8,   4,  -1 },
+    /* 1072 */ {  8,  -4,   1 }, {  8,  -4,   1 }, {  8,  -4,   1 }, {  8,  -4,   1 }, {  8,  -4,   1 }, {  8,  -4,   1 }, {  8,  -4,   1 }, {  8,  -4,   1 },
+    /* 1080 */ {  8,  -4,  -1 }, {  8,  -4,  -1 }, {  8,  -4,  -1 }, {  8,  -4,  -1 }, {  8,  -4,  -1 }, {  8,  -4,  -1 }, {  8,  -4,  -1 }, {  8,  -4,  -1 },
+    /* 1088 */ {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 },
+    /* 1096 */ {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 },
+    /* 1104 */ {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 },
+    /* 1112 */ {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 }, {  6,   0,   0 },
+    /* 1120 */ {  8,   4,   3 }, {  8,   4,   3 }, {  8,   4,   3 }, {  8,   4,   3 }, {  8,   4,   3 }, {  8,   4,   3 }, {  8,   4,   3 }, {  8,   4,   3 },
+    /* 1128 */ {  8,   4,  -3 }, {  8,   4,  -3 }, {  8,   4,  -3 }, {  8,   4,  -3 }, {  8,   4,  -3 }, {  8,   4,  -3 }, {  8,   4,  -3 }, {  8,   4,  -3 },
+    /* 1136 */ {  8,  -4,   3 }, {  8,  -4,   3 }, {  8,  -4,   3 }, {  8,  -4,   3 }, {  8,  -4,   3 }, {  8,  -4,   3 }, {  8,  -4,   3 }, {  8,  -4,   3 },
+    /* 1144 */ {  8,  -4,  -3 }, {  8,  -4,  -3 }, {  8,  -4,  -3 }, {  8,  -4,  -3 }, {  8,  -4,  -3 }, {  8,  -4,  -3 }, {  8,  -4,  -3 }, {  8,  -4,  -3 },
+    /* 1152 */ {  8,   3,   4 }, {  8,   3,   4 }, {  8,   3,   4 }, {  8,   3,   4 }, {  8,   3,   4 }, {  8,   3,   4 }, {  8,   3,   4 }, {  8,   3,   4 },
+    /* 1160 */ {  8,   3,  -4 }, {  8,   3,  -4 }, {  8,   3,  -4 }, {  8,   3,  -4 }, {  8,   3,  -4 }, {  8,   3,  -4 }, {  8,   3,  -4 }, {  8,   3,  -4 },
+    /* 1168 */ {  8,  -3,   4 }, {  8,  -3,   4 }, {  8,  -3,   4 }, {  8,  -3,   4 }, {  8,  -3,   4 }, {  8,  -3,   4 }, {  8,  -3,   4 }, {  8,  -3,   4 },
+    /* 1176 */ {  8,  -3,  -4 }, {  8,  -3,  -4 }, {  8,  -3,  -4 }, {  8,  -3,  -4 }, {  8,  -3,  -4 }, {  8,  -3,  -4 }, {  8,  -3,  -4 }, {  8,  -3,  -4 },
+    /* 1184 */ {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 },
+    /* 1192 */ {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 }, {  7,   3,   0 },
+    /* 1200 */ {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 },
+    /* 1208 */ {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 }, {  7,  -3,   0 },
+    /* 1216 */ {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 },
+    /* 1224 */ {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 }, {  7,   0,   3 },
+    /* 1232 */ {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 },
+    /* 1240 */ {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 }, {  7,   0,  -3 },
+    /* 1248 */ {  8,   4,   4 }, {  8,   4,   4 }, {  8,   4,   4 }, {  8,   4,   4 }, {  8,   4,   4 }, {  8,   4,   4 }, {  8,   4,   4 }, {  8,   4,   4 },
+    /* 1256 */ {  8,   4,  -4 }, {  8,   4,  -4 }, {  8,   4,  -4 }, {  8,   4,  -4 }, {  8,   4,  -4 }, {  8,   4,  -4 }, {  8,   4,  -4 }, {  8,   4,  -4 },
+    /* 1264 */ {  8,  -4,   4 }, {  8,  -4,   4 }, {  8,  -4,   4 }, {  8,  -4,   4 }, {  8,  -4,   4 }, {  8,  -4,   4 }, {  8,  -4,   4 }, {  8,  -4,   4 },
+    /* 1272 */ {  8,  -4,  -4 }, {  8,  -4,  -4 }, {  8,  -4,  -4 }, {  8,  -4,  -4 }, {  8,  -4,  -4 }, {  8,  -4,  -4 }, {  8,  -4,  -4 }, {  8,  -4,  -4 },
+    /* 1280 */ {  8,   2,   5 }, {  8,   2,   5 }, {  8,   2,   5 }, {  8,   2,   5 }, {  8,   2,   5 }, {  8,   2,   5 }, {  8,   2,   5 }, {  8,   2,   5 },
+    /* 1288 */ {  8,   2,  -5 }, {  8,   2,  -5 }, {  8,   2,  -5 }, {  8,   2,  -5 }, {  8,   2,  -5 }, {  8,   2,  -5 }, {  8,   2,  -5 }, {  8,   2,  -5 },
+    /* 1296 */ {  8,  -2,   5 }, {  8,  -2,   5 }, {  8,  -2,   5 }, {  8,  -2,   5 }, {  8,  -2,   5 }, {  8,  -2,   5 }, {  8,  -2,   5 }, {  8,  -2,   5 },
+    /* 1304 */ {  8,  -2,  -5 }, {  8,  -2,  -5 }, {  8,  -2,  -5 }, {  8,  -2,  -5 }, {  8,  -2,  -5 }, {  8,  -2,  -5 }, {  8,  -2,  -5 }, {  8,  -2,  -5 },
+    /* 1312 */ {  8,   5,   2 }, {  8,   5,   2 }, {  8,   5,   2 }, {  8,   5,   2 }, {  8,   5,   2 }, {  8,   5,   2 }, {  8,   5,   2 }, {  8,   5,   2 },
+    /* 1320 */ {  8,   5,  -2 }, {  8,   5,  -2 }, {  8,   5,  -2 }, {  8,   5,  -2 }, {  8,   5,  -2 }, {  8,   5,  -2 }, {  8,   5,  -2 }, {  8,   5,  -2 },
+    /* 1328 */ {  8,  -5,   2 }, {  8,  -5,   2 }, {  8,  -5,   2 }, {  8,  -5,   2 }, {  8,  -5,   2 }, {  8,  -5,   2 }, {  8,  -5,   2 }, {  8,  -5,   2 },
+    /* 1336 */ {  8,  -5,  -2 }, {  8,  -5,  -2 }, {  8,  -5,  -2 }, {  8,  -5,  -2 }, {  8,  -5,  -2 }, {  8,  -5,  -2 }, {  8,  -5,  -2 }, {  8,  -5,  -2 },
+    /* 1344 */ {  9,   1,   5 }, {  9,   1,   5 }, {  9,   1,   5 }, {  9,   1,   5 }, {  9,   1,  -5 }, {  9,   1,  -5 }, {  9,   1,  -5 }, {  9,   1,  -5 },
+    /* 1352 */ {  9,  -1,   5 }, {  9,  -1,   5 }, {  9,  -1,   5 }, {  9,  -1,   5 }, {  9,  -1,  -5 }, {  9,  -1,  -5 }, {  9,  -1,  -5 }, {  9,  -1,  -5 },
+    /* 1360 */ {  9,   5,   1 }, {  9,   5,   1 }, {  9,   5,   1 }, {  9,   5,   1 }, {  9,   5,  -1 }, {  9,   5,  -1 }, {  9,   5,  -1 }, {  9,   5,  -1 },
+    /* 1368 */ {  9,  -5,   1 }, {  9,  -5,   1 }, {  9,  -5,   1 }, {  9,  -5,   1 }, {  9,  -5,  -1 }, {  9,  -5,  -1 }, {  9,  -5,  -1 }, {  9,  -5,  -1 },
+    /* 1376 */ {  9,   5,   3 }, {  9,   5,   3 }, {  9,   5,   3 }, {  9,   5,   3 }, {  9,   5,  -3 }, {  9,   5,  -3 }, {  9,   5,  -3 }, {  9,   5,  -3 },
+    /* 1384 */ {  9,  -5,   3 }, {  9,  -5,   3 }, {  9,  -5,   3 }, {  9,  -5,   3 }, {  9,  -5,  -3 }, {  9,  -5,  -3 }, {  9,  -5,  -3 }, {  9,  -5,  -3 },
+    /* 1392 */ {  9,   3,   5 }, {  9,   3,   5 }, {  9,   3,   5 }, {  9,   3,   5 }, {  9,   3,  -5 }, {  9,   3,  -5 }, {  9,   3,  -5 }, {  9,   3,  -5 },
+    /* 1400 */ {  9,  -3,   5 }, {  9,  -3,   5 }, {  9,  -3,   5 }, {  9,  -3,   5 }, {  9,  -3,  -5 }, {  9,  -3,  -5 }, {  9,  -3,  -5 }, {  9,  -3,  -5 },
+    /* 1408 */ {  9,   5,   4 }, {  9,   5,   4 }, {  9,   5,   4 }, {  9,   5,   4 }, {  9,   5,  -4 }, {  9,   5,  -4 }, {  9,   5,  -4 }, {  9,   5,  -4 },
+    /* 1416 */ {  9,  -5,   4 }, {  9,  -5,   4 }, {  9,  -5,   4 }, {  9,  -5,   4 }, {  9,  -5,  -4 }, {  9,  -5,  -4 }, {  9,  -5,  -4 }, {  9,  -5,  -4 },
+    /* 1424 */ {  9,   4,   5 }, {  9,   4,   5 }, {  9,   4,   5 }, {  9,   4,   5 }, {  9,   4,  -5 }, {  9,   4,  -5 }, {  9,   4,  -5 }, {  9,   4,  -5 },
+    /* 1432 */ {  9,  -4,   5 }, {  9,  -4,   5 }, {  9,  -4,   5 }, {  9,  -4,   5 }, {  9,  -4,  -5 }, {  9,  -4,  -5 }, {  9,  -4,  -5 }, {  9,  -4,  -5 },
+    /* 1440 */ {  9,   6,   2 }, {  9,   6,   2 }, {  9,   6,   2 }, {  9,   6,   2 }, {  9,   6,  -2 }, {  9,   6,  -2 }, {  9,   6,  -2 }, {  9,   6,  -2 },
+    /* 1448 */ {  9,  -6,   2 }, {  9,  -6,   2 }, {  9,  -6,   2 }, {  9,  -6,   2 }, {  9,  -6,  -2 }, {  9,  -6,  -2 }, {  9,  -6,  -2 }, {  9,  -6,  -2 },
+    /* 1456 */ {  9,   2,   6 }, {  9,   2,   6 }, {  9,   2,   6 }, {  9,   2,   6 }, {  9,   2,  -6 }, {  9,   2,  -6 }, {  9,   2,  -6 }, {  9,   2,  -6 },
+    /* 1464 */ {  9,  -2,   6 }, {  9,  -2,   6 }, {  9,  -2,   6 }, {  9,  -2,   6 }, {  9,  -2,  -6 }, {  9,  -2,  -6 }, {  9,  -2,  -6 }, {  9,  -2,  -6 },
+    /* 1472 */ {  9,   6,   3 }, {  9,   6,   3 }, {  9,   6,   3 }, {  9,   6,   3 }, {  9,   6,  -3 }, {  9,   6,  -3 }, {  9,   6,  -3 }, {  9,   6,  -3 },
+    /* 1480 */ {  9,  -6,   3 }, {  9,  -6,   3 }, {  9,  -6,   3 }, {  9,  -6,   3 }, {  9,  -6,  -3 }, {  9,  -6,  -3 }, {  9,  -6,  -3 }, {  9,  -6,  -3 },
+    /* 1488 */ {  8,   4,   0 }, {  8,   4,   0 }, {  8,   4,   0 }, {  8,   4,   0 }, {  8,   4,   0 }, {  8,   4,   0 }, {  8,   4,   0 }, {  8,   4,   0 },
+    /* 1496 */ {  8,  -4,   0 }, {  8,  -4,   0 }, {  8,  -4,   0 }, {  8,  -4,   0 }, {  8,  -4,   0 }, {  8,  -4,   0 }, {  8,  -4,   0 }, {  8,  -4,   0 },
+    /* 1504 */ {  9,   6,   1 }, {  9,   6,   1 }, {  9,   6,   1 }, {  9,   6,   1 }, {  9,   6,  -1 }, {  9,   6,  -1 }, {  9,   6,  -1 }, {  9,   6,  -1 },
+    /* 1512 */ {  9,  -6,   1 }, {  9,  -6,   1 }, {  9,  -6,   1 }, {  9,  -6,   1 }, {  9,  -6,  -1 }, {  9,  -6,  -1 }, {  9,  -6,  -1 }, {  9,  -6,  -1 },
+    /* 1520 */ {  8,   0,   4 }, {  8,   0,   4 }, {  8,   0,   4 }, {  8,   0,   4 }, {  8,   0,   4 }, {  8,   0,   4 }, {  8,   0,   4 }, {  8,   0,   4 },
+    /* 1528 */ {  8,   0,  -4 }, {  8,   0,  -4 }, {  8,   0,  -4 }, {  8,   0,  -4 }, {  8,   0,  -4 }, {  8,   0,  -4 }, {  8,   0,  -4 }, {  8,   0,  -4 },
+    /* 1536 */ {  9,   1,   6 }, {  9,   1,   6 }, {  9,   1,   6 }, {  9,   1,   6 }, {  9,   1,  -6 }, {  9,   1,  -6 }, {  9,   1,  -6 }, {  9,   1,  -6 },
+    /* 1544 */ {  9,  -1,   6 }, {  9,  -1,   6 }, {  9,  -1,   6 }, {  9,  -1,   6 }, {  9,  -1,  -6 }, {  9,  -1,  -6 }, {  9,  -1,  -6 }, {  9,  -1,  -6 },
+    /* 1552 */ {  9,   3,   6 }, {  9,   3,   6 }, {  9,   3,   6 }, {  9,   3,   6 }, {  9,   3,  -6 }, {  9,   3,  -6 }, {  9,   3,  -6 }, {  9,   3,  -6 },
+    /* 1560 */ {  9,  -3,   6 }, {  9,  -3,   6 }, {  9,  -3,   6 }, {  9,  -3,   6 }, {  9,  -3,  -6 }, {  9,  -3,  -6 }, {  9,  -3,  -6 }, {  9,  -3,  -6 },
+    /* 1568 */ {  9,   5,   5 }, {  9,   5,   5 }, {  9,   5,   5 }, {  9,   5,   5 }, {  9,   5,  -5 }, {  9,   5,  -5 }, {  9,   5,  -5 }, {  9,   5,  -5 },
+    /* 1576 */ {  9,  -5,   5 }, {  9,  -5,   5 }, {  9,  -5,   5 }, {  9,  -5,   5 }, {  9,  -5,  -5 }, {  9,  -5,  -5 }, {  9,  -5,  -5 }, {  9,  -5,  -5 },
+    /* 1584 */ {  9,   6,   4 }, {  9,   6,   4 }, {  9,   6,   4 }, {  9,   6,   4 }, {  9,   6,  -4 }, {  9,   6,  -4 }, {  9,   6,  -4 }, {  9,   6,  -4 },
+    /* 1592 */ {  9,  -6,   4 }, {  9,  -6,   4 }, {  9,  -6,   4 }, {  9,  -6,   4 }, {  9,  -6,  -4 }, {  9,  -6,  -4 }, {  9,  -6,  -4 }, {  9,  -6,  -4 },
+    /* 1600 */ {  9,   4,   6 }, {  9,   4,   6 }, {  9,   4,   6 }, {  9,   4,   6 }, {  9,   4,  -6 }, {  9,   4,  -6 }, {  9,   4,  -6 }, {  9,   4,  -6 },
+    /* 1608 */ {  9,  -4,   6 }, {  9,  -4,   6 }, {  9,  -4,   6 }, {  9,  -4,   6 }, {  9,  -4,  -6 }, {  9,  -4,  -6 }, {  9,  -4,  -6 }, {  9,  -4,  -6 },
+    /* 1616 */ { 10,   6,   5 }, { 10,   6,   5 }, { 10,   6,  -5 }, { 10,   6,  -5 }, { 10,  -6,   5 }, { 10,  -6,   5 }, { 10,  -6,  -5 }, { 10,  -6,  -5 },
+    /* 1624 */ { 10,   7,   2 }, { 10,   7,   2 }, { 10,   7,  -2 }, { 10,   7,  -2 }, { 10,  -7,   2 }, { 10,  -7,   2 }, { 10,  -7,  -2 }, { 10,  -7,  -2 },
+    /* 1632 */ { 10,   3,   7 }, { 10,   3,   7 }, { 10,   3,  -7 }, { 10,   3,  -7 }, { 10,  -3,   7 }, { 10,  -3,   7 }, { 10,  -3,  -7 }, { 10,  -3,  -7 },
+    /* 1640 */ { 10,   2,   7 }, { 10,   2,   7 }, { 10,   2,  -7 }, { 10,   2,  -7 }, { 10,  -2,   7 }, { 10,  -2,   7 }, { 10,  -2,  -7 }, { 10,  -2,  -7 },
+    /* 1648 */ { 10,   5,   6 }, { 10,   5,   6 }, { 10,   5,  -6 }, { 10,   5,  -6 }, { 10,  -5,   6 }, { 10,  -5,   6 }, { 10,  -5,  -6 }, { 10,  -5,  -6 },
+    /* 1656 */ { 10,   8,   2 }, { 10,   8,   2 }, { 10,   8,  -2 }, { 10,   8,  -2 }, { 10,  -8,   2 }, { 10,  -8,   2 }, { 10,  -8,  -2 }, { 10,  -8,  -2 },
+    /* 1664 */ { 10,   7,   3 }, { 10,   7,   3 }, { 10,   7,  -3 }, { 10,   7,  -3 }, { 10,  -7,   3 }, { 10,  -7,   3 }, { 10,  -7,  -3 }, { 10,  -7,  -3 },
+    /* 1672 */ {  9,   5,   0 }, {  9,   5,   0 }, {  9,   5,   0 }, {  9,   5,   0 }, {  9,  -5,   0 }, {  9,  -5,   0 }, {  9,  -5,   0 }, {  9,  -5,   0 },
+    /* 1680 */ { 10,   7,   1 }, { 10,   7,   1 }, { 10,   7,  -1 }, { 10,   7,  -1 }, { 10,  -7,   1 }, { 10,  -7,   1 }, { 10,  -7,  -1 }, { 10,  -7,  -1 },
+    /* 1688 */ {  9,   0,   5 }, {  9,   0,   5 }, {  9,   0,   5 }, {  9,   0,   5 }, {  9,   0,  -5 }, {  9,   0,  -5 }, {  9,   0,  -5 }, {  9,   0,  -5 },
+    /* 1696 */ { 10,   8,   1 }, { 10,   8,   1 }, { 10,   8,  -1 }, { 10,   8,  -1 }, { 10,  -8,   1 }, { 10,  -8,   1 }, { 10,  -8,  -1 }, { 10,  -8,  -1 },
+    /* 1704 */ { 10,   1,   7 }, { 10,   1,   7 }, { 10,   1,  -7 }, { 10,   1,  -7 }, { 10,  -1,   7 }, { 10,  -1,   7 }, { 10,  -1,  -7 }, { 10,  -1,  -7 },
+    /* 1712 */ { 10,   8,   3 }, { 10,   8,   3 }, { 10,   8,  -3 }, { 10,   8,  -3 }, { 10,  -8,   3 }, { 10,  -8,   3 }, { 10,  -8,  -3 }, { 10,  -8,  -3 },
+    /* 1720 */ { 10,   7,   4 }, { 10,   7,   4 }, { 10,   7,  -4 }, { 10,   7,  -4 }, { 10,  -7,   4 }, { 10,  -7,   4 }, { 10,  -7,  -4 }, { 10,  -7,  -4 },
+    /* 1728 */ { 10,   4,   7 }, { 10,   4,   7 }, { 10,   4,  -7 }, { 10,   4,  -7 }, { 10,  -4,   7 }, { 10,  -4,   7 }, { 10,  -4,  -7 }, { 10,  -4,  -7 },
+    /* 1736 */ { 10,   2,   8 }, { 10,   2,   8 }, { 10,   2,  -8 }, { 10,   2,  -8 }, { 10,  -2,   8 }, { 10,  -2,   8 }, { 10,  -2,  -8 }, { 10,  -2,  -8 },
+    /* 1744 */ { 10,   6,   6 }, { 10,   6,   6 }, { 10,   6,  -6 }, { 10,   6,  -6 }, { 10,  -6,   6 }, { 10,  -6,   6 }, { 10,  -6,  -6 }, { 10,  -6,  -6 },
+    /* 1752 */ { 10,   7,   5 }, { 10,   7,   5 }, { 10,   7,  -5 }, { 10,   7,  -5 }, { 10,  -7,   5 }, { 10,  -7,   5 }, { 10,  -7,  -5 }, { 10,  -7,  -5 },
+    /* 1760 */ { 10,   1,   8 }, { 10,   1,   8 }, { 10,   1,  -8 }, { 10,   1,  -8 }, { 10,  -1,   8 }, { 10,  -1,   8 }, { 10,  -1,  -8 }, { 10,  -1,  -8 },
+    /* 1768 */ { 10,   3,   8 }, { 10,   3,   8 }, { 10,   3,  -8 }, { 10,   3,  -8 }, { 10,  -3,   8 }, { 10,  -3,   8 }, { 10,  -3,  -8 }, { 10,  -3,  -8 },
+    /* 1776 */ { 10,   8,   4 }, { 10,   8,   4 }, { 10,   8,  -4 }, { 10,   8,  -4 }, { 10,  -8,   4 }, { 10,  -8,   4 }, { 10,  -8,  -4 }, { 10,  -8,  -4 },
+    /* 1784 */ { 10,   4,   8 }, { 10,   4,   8 }, { 10,   4,  -8 }, { 10,   4,  -8 }, { 10,  -4,   8 }, { 10,  -4,   8 }, { 10,  -4,  -8 }, { 10,  -4,  -8 },
+    /* 1792 */ { 10,   5,   7 }, { 10,   5,   7 }, { 10,   5,  -7 }, { 10,   5,  -7 }, { 10,  -5,   7 }, { 10,  -5,   7 }, { 10,  -5,  -7 }, { 10,  -5,  -7 },
+    /* 1800 */ { 10,   8,   5 }, { 10,   8,   5 }, { 10,   8,  -5 }, { 10,   8,  -5 }, { 10,  -8,   5 }, { 10,  -8,   5 }, { 10,  -8,  -5 }, { 10,  -8,  -5 },
+    /* 1808 */ { 10,   5,   8 }, { 10,   5,   8 }, { 10,   5,  -8 }, { 10,   5,  -8 }, { 10,  -5,   8 }, { 10,  -5,   8 }, { 10,  -5,  -8 }, { 10,  -5,  -8 },
+    /* 1816 */ { 11,   7,   6 }, { 11,   7,  -6 }, { 11,  -7,   6 }, { 11,  -7,  -6 }, { 11,   6,   7 }, { 11,   6,  -7 }, { 11,  -6,   7 }, { 11,  -6,  -7 },
+    /* 1824 */ { 11,   9,   2 }, { 11,   9,  -2 }, { 11,  -9,   2 }, { 11,  -9,  -2 }, { 10,   6,   0 }, { 10,   6,   0 }, { 10,  -6,   0 }, { 10,  -6,   0 },
+    /* 1832 */ { 11,   6,   8 }, { 11,   6,  -8 }, { 11,  -6,   8 }, { 11,  -6,  -8 }, { 11,   9,   3 }, { 11,   9,  -3 }, { 11,  -9,   3 }, { 11,  -9,  -3 },
+    /* 1840 */ { 11,   3,   9 }, { 11,   3,  -9 }, { 11,  -3,   9 }, { 11,  -3,  -9 }, { 11,   9,   1 }, { 11,   9,  -1 }, { 11,  -9,   1 }, { 11,  -9,  -1 },
+    /* 1848 */ { 11,   2,   9 }, { 11,   2,  -9 }, { 11,  -2,   9 }, { 11,  -2,  -9 }, { 10,   0,   6 }, { 10,   0,   6 }, { 10,   0,  -6 }, { 10,   0,  -6 },
+    /* 1856 */ { 11,   8,   6 }, { 11,   8,  -6 }, { 11,  -8,   6 }, { 11,  -8,  -6 }, { 11,   9,   4 }, { 11,   9,  -4 }, { 11,  -9,   4 }, { 11,  -9,  -4 },
+    /* 1864 */ { 11,   4,   9 }, { 11,   4,  -9 }, { 11,  -4,   9 }, { 11,  -4,  -9 }, { 11,  10,   2 }, { 11,  10,  -2 }, { 11, -10,   2 }, { 11, -10,  -2 },
+    /* 1872 */ { 11,   1,   9 }, { 11,   1,  -9 }, { 11,  -1,   9 }, { 11,  -1,  -9 }, { 11,   7,   7 }, { 11,   7,  -7 }, { 11,  -7,   7 }, { 11,  -7,  -7 },
+    /* 1880 */ { 11,   8,   7 }, { 11,   8,  -7 }, { 11,  -8,   7 }, { 11,  -8,  -7 }, { 11,   9,   5 }, { 11,   9,  -5 }, { 11,  -9,   5 }, { 11,  -9,  -5 },
+    /* 1888 */ { 11,   7,   8 }, { 11,   7,  -8 }, { 11,  -7,   8 }, { 11,  -7,  -8 }, { 11,  10,   3 }, { 11,  10,  -3 }, { 11, -10,   3 }, { 11, -10,  -3 },
+    /* 1896 */ { 11,   5,   9 }, { 11,   5,  -9 }, { 11,  -5,   9 }, { 11,  -5,  -9 }, { 11,  10,   4 }, { 11,  10,  -4 }, { 11, -10,   4 }, { 11, -10,  -4 },
+    /* 1904 */ { 11,   2,  10 }, { 11,   2, -10 }, { 11,  -2,  10 }, { 11,  -2, -10 }, { 11,  10,   1 }, { 11,  10,  -1 }, { 11, -10,   1 }, { 11, -10,  -1 },
+    /* 1912 */ { 11,   3,  10 }, { 11,   3, -10 }, { 11,  -3,  10 }, { 11,  -3, -10 }, { 11,   9,   6 }, { 11,   9,  -6 }, { 11,  -9,   6 }, { 11,  -9,  -6 },
+    /* 1920 */ { 11,   6,   9 }, { 11,   6,  -9 }, { 11,  -6,   9 }, { 11,  -6,  -9 }, { 10,   8,   0 }, { 10,   8,   0 }, { 10,  -8,   0 }, { 10,  -8,   0 },
+    /* 1928 */ { 11,   4,  10 }, { 11,   4, -10 }, { 11,  -4,  10 }, { 11,  -4, -10 }, { 10,   7,   0 }, { 10,   7,   0 }, { 10,  -7,   0 }, { 10,  -7,   0 },
+    /* 1936 */ { 11,  11,   2 }, { 11,  11,  -2 }, { 11, -11,   2 }, { 11, -11,  -2 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1944 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1952 */ { 11,   0,   7 }, { 11,   0,  -7 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1960 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, { 11,   0,   8 }, { 11,   0,  -8 },
+    /* 1968 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1976 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1984 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 1992 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 2000 */ {  0,   0,   0 }, {  0,   0,   0 }, { 11,   9,   0 }, { 11,  -9,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, { 11,  10,   0 }, { 11, -10,   0 },
+    /* 2008 */ {  0,   0,   0 }, {  0,   0,   0 }, { 11,   0,   9 }, { 11,   0,  -9 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 2016 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 2024 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 2032 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 2040 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }
+};
+
+/* HCB_11, 12 bits, 4020 of 4096 entries decode in one step */
+static hcb_2_pair hcb11_fast[] = {
+    /*    0 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*    8 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   16 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   24 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   32 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   40 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   48 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   56 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   64 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   72 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   80 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   88 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*   96 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  104 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  112 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  120 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  128 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  136 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  144 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  152 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  160 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  168 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  176 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  184 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  192 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  200 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  208 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  216 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  224 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  232 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  240 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  248 */ {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 }, {  4,   0,   0 },
+    /*  256 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*  264 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*  272 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*  280 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*  288 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*  296 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*  304 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*  312 */ {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 }, {  6,   1,   1 },
+    /*  320 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*  328 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*  336 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*  344 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*  352 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*  360 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*  368 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*  376 */ {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 }, {  6,   1,  -1 },
+    /*  384 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*  392 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*  400 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*  408 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*  416 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*  424 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*  432 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*  440 */ {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 }, {  6,  -1,   1 },
+    /*  448 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  456 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  464 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  472 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  480 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  488 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  496 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  504 */ {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 }, {  6,  -1,  -1 },
+    /*  512 */ {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 },
+    /*  520 */ {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 },
+    /*  528 */ {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 },
+    /*  536 */ {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 }, {  7,  16,  16 },
+    /*  544 */ {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 },
+    /*  552 */ {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 },
+    /*  560 */ {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 },
+    /*  568 */ {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 }, {  7,  16, -16 },
+    /*  576 */ {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 },
+    /*  584 */ {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 },
+    /*  592 */ {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 },
+    /*  600 */ {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 }, {  7, -16,  16 },
+    /*  608 */ {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 },
+    /*  616 */ {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 },
+    /*  624 */ {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 },
+    /*  632 */ {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 }, {  7, -16, -16 },
+    /*  640 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  648 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  656 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  664 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  672 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  680 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  688 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  696 */ {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 }, {  6,   1,   0 },
+    /*  704 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  712 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  720 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  728 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  736 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  744 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  752 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  760 */ {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 }, {  6,  -1,   0 },
+    /*  768 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  776 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  784 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  792 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  800 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  808 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  816 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  824 */ {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 }, {  6,   0,   1 },
+    /*  832 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  840 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  848 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  856 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  864 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  872 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  880 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  888 */ {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 }, {  6,   0,  -1 },
+    /*  896 */ {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 },
+    /*  904 */ {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 },
+    /*  912 */ {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 },
+    /*  920 */ {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 }, {  7,   2,   1 },
+    /*  928 */ {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 },
+    /*  936 */ {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 },
+    /*  944 */ {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 },
+    /*  952 */ {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 }, {  7,   2,  -1 },
+    /*  960 */ {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 },
+    /*  968 */ {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 },
+    /*  976 */ {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 },
+    /*  984 */ {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 }, {  7,  -2,   1 },
+    /*  992 */ {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 },
+    /* 1000 */ {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 },
+    /* 1008 */ {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 },
+    /* 1016 */ {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 }, {  7,  -2,  -1 },
+    /* 1024 */ {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 },
+    /* 1032 */ {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 },
+    /* 1040 */ {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 },
+    /* 1048 */ {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 }, {  7,   1,   2 },
+    /* 1056 */ {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 },
+    /* 1064 */ {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 },
+    /* 1072 */ {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 },
+    /* 1080 */ {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 }, {  7,   1,  -2 },
+    /* 1088 */ {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 },
+    /* 1096 */ {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 },
+    /* 1104 */ {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 },
+    /* 1112 */ {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 }, {  7,  -1,   2 },
+    /* 1120 */ {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 },
+    /* 1128 */ {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 },
+    /* 1136 */ {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 },
+    /* 1144 */ {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 }, {  7,  -1,  -2 },
+    /* 1152 */ {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 },
+    /* 1160 */ {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 },
+    /* 1168 */ {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 },
+    /* 1176 */ {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 }, {  7,   2,   2 },
+    /* 1184 */ {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 },
+    /* 1192 */ {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 },
+    /* 1200 */ {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 },
+    /* 1208 */ {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 }, {  7,   2,  -2 },
+    /* 1216 */ {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 },
+    /* 1224 */ {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 },
+    /* 1232 */ {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 },
+    /* 1240 */ {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 }, {  7,  -2,   2 },
+    /* 1248 */ {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 },
+    /* 1256 */ {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 },
+    /* 1264 */ {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 },
+    /* 1272 */ {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 }, {  7,  -2,  -2 },
+    /* 1280 */ {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 },
+    /* 1288 */ {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 }, {  8,   1,   3 },
+    /* 1296 */ {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 },
+    /* 1304 */ {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 }, {  8,   1,  -3 },
+    /* 1312 */ {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 },
+    /* 1320 */ {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 }, {  8,  -1,   3 },
+    /* 1328 */ {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 },
+    /* 1336 */ {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 }, {  8,  -1,  -3 },
+    /* 1344 */ {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 },
+    /* 1352 */ {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 }, {  8,   3,   1 },
+    /* 1360 */ {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 },
+    /* 1368 */ {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 }, {  8,   3,  -1 },
+    /* 1376 */ {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 },
+    /* 1384 */ {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 }, {  8,  -3,   1 },
+    /* 1392 */ {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 },
+    /* 1400 */ {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 }, {  8,  -3,  -1 },
+    /* 1408 */ {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 },
+    /* 1416 */ {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 }, {  8,   3,   2 },
+    /* 1424 */ {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 },
+    /* 1432 */ {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 }, {  8,   3,  -2 },
+    /* 1440 */ {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 },
+    /* 1448 */ {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 }, {  8,  -3,   2 },
+    /* 1456 */ {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 },
+    /* 1464 */ {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 }, {  8,  -3,  -2 },
+    /* 1472 */ {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 },
+    /* 1480 */ {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 },
+    /* 1488 */ {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 },
+    /* 1496 */ {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 }, {  7,   2,   0 },
+    /* 1504 */ {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 },
+    /* 1512 */ {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 },
+    /* 1520 */ {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 },
+    /* 1528 */ {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 }, {  7,  -2,   0 },
+    /* 1536 */ {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 },
+    /* 1544 */ {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 }, {  8,   2,   3 },
+    /* 1552 */ {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 },
+    /* 1560 */ {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 }, {  8,   2,  -3 },
+    /* 1568 */ {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 },
+    /* 1576 */ {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 }, {  8,  -2,   3 },
+    /* 1584 */ {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 },
+    /* 1592 */ {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 }, {  8,  -2,  -3 },
+    /* 1600 */ {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 },
+    /* 1608 */ {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 },
+    /* 1616 */ {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 },
+    /* 1624 */ {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 }, {  7,   0,   2 },
+    /* 1632 */ {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 },
+    /* 1640 */ {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 },
+    /* 1648 */ {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 },
+    /* 1656 */ {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 }, {  7,   0,  -2 },
+    /* 1664 */ {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 },
+    /* 1672 */ {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 }, {  8,   3,   3 },
+    /* 1680 */ {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 },
+    /* 1688 */ {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 }, {  8,   3,  -3 },
+    /* 1696 */ {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 },
+    /* 1704 */ {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 }, {  8,  -3,   3 },
+    /* 1712 */ {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 },
+    /* 1720 */ {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 }, {  8,  -3,  -3 },
+    /* 1728 */ {  9,   4,   1 }, {  9,   4,   1 }, {  9,   4,   1 }, {  9,   4,   1 }, {  9,   4,   1 }, {  9,   4,   1 }, {  9,   4,   1 }, {  9,   4,   1 },
+    /* 1736 */ {  9,   4,  -1 }, {  9,   4,  -1 }, {  9,   4,  -1 }, {  9,   4,  -1 }, {  9,   4,  -1 }, {  9,   4,  -1 }, {  9,   4,  -1 }, {  9,   4,  -1 },
+    /* 1744 */ {  9,  -4,   1 }, {  9,  -4,   1 }, {  9,  -4,   1 }, {  9,  -4,   1 }, {  9,  -4,   1 }, {  9,  -4,   1 }, {  9,  -4,   1 }, {  9,  -4,   1 },
+    /* 1752 */ {  9,  -4,  -1 }, {  9,  -4,  -1 }, {  9,  -4,  -1 }, {  9,  -4,  -1 }, {  9,  -4,  -1 }, {  9,  -4,  -1 }, {  9,  -4,  -1 }, {  9,  -4,  -1 },
+    /* 1760 */ {  9,   1,   4 }, {  9,   1,   4 }, {  9,   1,   4 }, {  9,   1,   4 }, {  9,   1,   4 }, {  9,   1,   4 }, {  9,   1,   4 }, {  9,   1,   4 },
+    /* 1768 */ {  9,   1,  -4 }, {  9,   1,  -4 }, {  9,   1,  -4 }, {  9,   1,  -4 }, {  9,   1,  -4 }, {  9,   1,  -4 }, {  9,   1,  -4 }, {  9,   1,  -4 },
+    /* 1776 */ {  9,  -1,   4 }, {  9,  -1,   4 }, {  9,  -1,   4 }, {  9,  -1,   4 }, {  9,  -1,   4 }, {  9,  -1,   4 }, {  9,  -1,   4 }, {  9,  -1,   4 },
+    /* 1784 */ {  9,  -1,  -4 }, {  9,  -1,  -4 }, {  9,  -1,  -4 }, {  9,  -1,  -4 }, {  9,  -1,  -4 }, {  9,  -1,  -4 }, {  9,  -1,  -4 }, {  9,  -1,  -4 },
+    /* 1792 */ {  9,   4,   2 }, {  9,   4,   2 }, {  9,   4,   2 }, {  9,   4,   2 }, {  9,   4,   2 }, {  9,   4,   2 }, {  9,   4,   2 }, {  9,   4,   2 },
+    /* 1800 */ {  9,   4,  -2 }, {  9,   4,  -2 }, {  9,   4,  -2 }, {  9,   4,  -2 }, {  9,   4,  -2 }, {  9,   4,  -2 }, {  9,   4,  -2 }, {  9,   4,  -2 },
+    /* 1808 */ {  9,  -4,   2 }, {  9,  -4,   2 }, {  9,  -4,   2 }, {  9,  -4,   2 }, {  9,  -4,   2 }, {  9,  -4,   2 }, {  9,  -4,   2 }, {  9,  -4,   2 },
+    /* 1816 */ {  9,  -4,  -2 }, {  9,  -4,  -2 }, {  9,  -4,  -2 }, {  9,  -4,  -2 }, {  9,  -4,  -2 }, {  9,  -4,  -2 }, {  9,  -4,  -2 }, {  9,  -4,  -2 },
+    /* 1824 */ {  9,   2,   4 }, {  9,   2,   4 }, {  9,   2,   4 }, {  9,   2,   4 }, {  9,   2,   4 }, {  9,   2,   4 }, {  9,   2,   4 }, {  9,   2,   4 },
+    /* 1832 */ {  9,   2,  -4 }, {  9,   2,  -4 }, {  9,   2,  -4 }, {  9,   2,  -4 }, {  9,   2,  -4 }, {  9,   2,  -4 }, {  9,   2,  -4 }, {  9,   2,  -4 },
+    /* 1840 */ {  9,  -2,   4 }, {  9,  -2,   4 }, {  9,  -2,   4 }, {  9,  -2,   4 }, {  9,  -2,   4 }, {  9,  -2,   4 }, {  9,  -2,   4 }, {  9,  -2,   4 },
+    /* 1848 */ {  9,  -2,  -4 }, {  9,  -2,  -4 }, {  9,  -2,  -4 }, {  9,  -2,  -4 }, {  9,  -2,  -4 }, {  9,  -2,  -4 }, {  9,  -2,  -4 }, {  9,  -2,  -4 },
+    /* 1856 */ {  9,   4,   3 }, {  9,   4,   3 }, {  9,   4,   3 }, {  9,   4,   3 }, {  9,   4,   3 }, {  9,   4,   3 }, {  9,   4,   3 }, {  9,   4,   3 },
+    /* 1864 */ {  9,   4,  -3 }, {  9,   4,  -3 }, {  9,   4,  -3 }, {  9,   4,  -3 }, {  9,   4,  -3 }, {  9,   4,  -3 }, {  9,   4,  -3 }, {  9,   4,  -3 },
+    /* 1872 */ {  9,  -4,   3 }, {  9,  -4,   3 }, {  9,  -4,   3 }, {  9,  -4,   3 }, {  9,  -4,   3 }, {  9,  -4,   3 }, {  9,  -4,   3 }, {  9,  -4,   3 },
+    /* 1880 */ {  9,  -4,  -3 }, {  9,  -4,  -3 }, {  9,  -4,  -3 }, {  9,  -4,  -3 }, {  9,  -4,  -3 }, {  9,  -4,  -3 }, {  9,  -4,  -3 }, {  9,  -4,  -3 },
+    /* 1888 */ {  9,   3,   4 }, {  9,   3,   4 }, {  9,   3,   4 }, {  9,   3,   4 }, {  9,   3,   4 }, {  9,   3,   4 }, {  9,   3,   4 }, {  9,   3,   4 },
+    /* 1896 */ {  9,   3,  -4 }, {  9,   3,  -4 }, {  9,   3,  -4 }, {  9,   3,  -4 }, {  9,   3,  -4 }, {  9,   3,  -4 }, {  9,   3,  -4 }, {  9,   3,  -4 },
+    /* 1904 */ {  9,  -3,   4 }, {  9,  -3,   4 }, {  9,  -3,   4 }, {  9,  -3,   4 }, {  9,  -3,   4 }, {  9,  -3,   4 }, {  9,  -3,   4 }, {  9,  -3,   4 },
+    /* 1912 */ {  9,  -3,  -4 }, {  9,  -3,  -4 }, {  9,  -3,  -4 }, {  9,  -3,  -4 }, {  9,  -3,  -4 }, {  9,  -3,  -4 }, {  9,  -3,  -4 }, {  9,  -3,  -4 },
+    /* 1920 */ {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 },
+    /* 1928 */ {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 }, {  8,   3,   0 },
+    /* 1936 */ {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 },
+    /* 1944 */ {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 }, {  8,  -3,   0 },
+    /* 1952 */ {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 },
+    /* 1960 */ {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 }, {  8,   0,   3 },
+    /* 1968 */ {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 },
+    /* 1976 */ {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 }, {  8,   0,  -3 },
+    /* 1984 */ {  9,   5,   1 }, {  9,   5,   1 }, {  9,   5,   1 }, {  9,   5,   1 }, {  9,   5,   1 }, {  9,   5,   1 }, {  9,   5,   1 }, {  9,   5,   1 },
+    /* 1992 */ {  9,   5,  -1 }, {  9,   5,  -1 }, {  9,   5,  -1 }, {  9,   5,  -1 }, {  9,   5,  -1 }, {  9,   5,  -1 }, {  9,   5,  -1 }, {  9,   5,  -1 },
+    /* 2000 */ {  9,  -5,   1 }, {  9,  -5,   1 }, {  9,  -5,   1 }, {  9,  -5,   1 }, {  9,  -5,   1 }, {  9,  -5,   1 }, {  9,  -5,   1 }, {  9,  -5,   1 },
+    /* 2008 */ {  9,  -5,  -1 }, {  9,  -5,  -1 }, {  9,  -5,  -1 }, {  9,  -5,  -1 }, {  9,  -5,  -1 }, {  9,  -5,  -1 }, {  9,  -5,  -1 }, {  9,  -5,  -1 },
+    /* 2016 */ {  9,   5,   2 }, {  9,   5,   2 }, {  9,   5,   2 }, {  9,   5,   2 }, {  9,   5,   2 }, {  9,   5,   2 }, {  9,   5,   2 }, {  9,   5,   2 },
+    /* 2024 */ {  9,   5,  -2 }, {  9,   5,  -2 }, {  9,   5,  -2 }, {  9,   5,  -2 }, {  9,   5,  -2 }, {  9,   5,  -2 }, {  9,   5,  -2 }, {  9,   5,  -2 },
+    /* 2032 */ {  9,  -5,   2 }, {  9,  -5,   2 }, {  9,  -5,   2 }, {  9,  -5,   2 }, {  9,  -5,   2 }, {  9,  -5,   2 }, {  9,  -5,   2 }, {  9,  -5,   2 },
+    /* 2040 */ {  9,  -5,  -2 }, {  9,  -5,  -2 }, {  9,  -5,  -2 }, {  9,  -5,  -2 }, {  9,  -5,  -2 }, {  9,  -5,  -2 }, {  9,  -5,  -2 }, {  9,  -5,  -2 },
+    /* 2048 */ {  9,   2,   5 }, {  9,   2,   5 }, {  9,   2,   5 }, {  9,   2,   5 }, {  9,   2,   5 }, {  9,   2,   5 }, {  9,   2,   5 }, {  9,   2,   5 },
+    /* 2056 */ {  9,   2,  -5 }, {  9,   2,  -5 }, {  9,   2,  -5 }, {  9,   2,  -5 }, {  9,   2,  -5 }, {  9,   2,  -5 }, {  9,   2,  -5 }, {  9,   2,  -5 },
+    /* 2064 */ {  9,  -2,   5 }, {  9,  -2,   5 }, {  9,  -2,   5 }, {  9,  -2,   5 }, {  9,  -2,   5 }, {  9,  -2,   5 }, {  9,  -2,   5 }, {  9,  -2,   5 },
+    /* 2072 */ {  9,  -2,  -5 }, {  9,  -2,  -5 }, {  9,  -2,  -5 }, {  9,  -2,  -5 }, {  9,  -2,  -5 }, {  9,  -2,  -5 }, {  9,  -2,  -5 }, {  9,  -2,  -5 },
+    /* 2080 */ {  9,   4,   4 }, {  9,   4,   4 }, {  9,   4,   4 }, {  9,   4,   4 }, {  9,   4,   4 }, {  9,   4,   4 }, {  9,   4,   4 }, {  9,   4,   4 },
+    /* 2088 */ {  9,   4,  -4 }, {  9,   4,  -4 }, {  9,   4,  -4 }, {  9,   4,  -4 }, {  9,   4,  -4 }, {  9,   4,  -4 }, {  9,   4,  -4 }, {  9,   4,  -4 },
+    /* 2096 */ {  9,  -4,   4 }, {  9,  -4,   4 }, {  9,  -4,   4 }, {  9,  -4,   4 }, {  9,  -4,   4 }, {  9,  -4,   4 }, {  9,  -4,   4 }, {  9,  -4,   4 },
+    /* 2104 */ {  9,  -4,  -4 }, {  9,  -4,  -4 }, {  9,  -4,  -4 }, {  9,  -4,  -4 }, {  9,  -4,  -4 }, {  9,  -4,  -4 }, {  9,  -4,  -4 }, {  9,  -4,  -4 },
+    /* 2112 */ {  9,   1,   5 }, {  9,   1,   5 }, {  9,   1,   5 }, {  9,   1,   5 }, {  9,   1,   5 }, {  9,   1,   5 }, {  9,   1,   5 }, {  9,   1,   5 },
+    /* 2120 */ {  9,   1,  -5 }, {  9,   1,  -5 }, {  9,   1,  -5 }, {  9,   1,  -5 }, {  9,   1,  -5 }, {  9,   1,  -5 }, {  9,   1,  -5 }, {  9,   1,  -5 },
+    /* 2128 */ {  9,  -1,   5 }, {  9,  -1,   5 }, {  9,  -1,   5 }, {  9,  -1,   5 }, {  9,  -1,   5 }, {  9,  -1,   5 }, {  9,  -1,   5 }, {  9,  -1,   5 },
+    /* 2136 */ {  9,  -1,  -5 }, {  9,  -1,  -5 }, {  9,  -1,  -5 }, {  9,  -1,  -5 }, {  9,  -1,  -5 }, {  9,  -1,  -5 }, {  9,  -1,  -5 }, {  9,  -1,  -5 },
+    /* 2144 */ {  9,   5,   3 }, {  9,   5,   3 }, {  9,   5,   3 }, {  9,   5,   3 }, {  9,   5,   3 }, {  9,   5,   3 }, {  9,   5,   3 }, {  9,   5,   3 },
+    /* 2152 */ {  9,   5,  -3 }, {  9,   5,  -3 }, {  9,   5,  -3 }, {  9,   5,  -3 }, {  9,   5,  -3 }, {  9,   5,  -3 }, {  9,   5,  -3 }, {  9,   5,  -3 },
+    /* 2160 */ {  9,  -5,   3 }, {  9,  -5,   3 }, {  9,  -5,   3 }, {  9,  -5,   3 }, {  9,  -5,   3 }, {  9,  -5,   3 }, {  9,  -5,   3 }, {  9,  -5,   3 },
+    /* 2168 */ {  9,  -5,  -3 }, {  9,  -5,  -3 }, {  9,  -5,  -3 }, {  9,  -5,  -3 }, {  9,  -5,  -3 }, {  9,  -5,  -3 }, {  9,  -5,  -3 }, {  9,  -5,  -3 },
+    /* 2176 */ {  9,   3,   5 }, {  9,   3,   5 }, {  9,   3,   5 }, {  9,   3,   5 }, {  9,   3,   5 }, {  9,   3,   5 }, {  9,   3,   5 }, {  9,   3,   5 },
+    /* 2184 */ {  9,   3,  -5 }, {  9,   3,  -5 }, {  9,   3,  -5 }, {  9,   3,  -5 }, {  9,   3,  -5 }, {  9,   3,  -5 }, {  9,   3,  -5 }, {  9,   3,  -5 },
+    /* 2192 */ {  9,  -3,   5 }, {  9,  -3,   5 }, {  9,  -3,   5 }, {  9,  -3,   5 }, {  9,  -3,   5 }, {  9,  -3,   5 }, {  9,  -3,   5 }, {  9,  -3,   5 },
+    /* 2200 */ {  9,  -3,  -5 }, {  9,  -3,  -5 }, {  9,  -3,  -5 }, {  9,  -3,  -5 }, {  9,  -3,  -5 }, {  9,  -3,  -5 }, {  9,  -3,  -5 }, {  9,  -3,  -5 },
+    /* 2208 */ {  9,   5,   4 }, {  9,   5,   4 }, {  9,   5,   4 }, {  9,   5,   4 }, {  9,   5,   4 }, {  9,   5,   4 }, {  9,   5,   4 }, {  9,   5,   4 },
+    /* 2216 */ {  9,   5,  -4 }, {  9,   5,  -4 }, {  9,   5,  -4 }, {  9,   5,  -4 }, {  9,   5,  -4 }, {  9,   5,  -4 }, {  9,   5,  -4 }, {  9,   5,  -4 },
+    /* 2224 */ {  9,  -5,   4 }, {  9,  -5,   4 }, {  9,  -5,   4 }, {  9,  -5,   4 }, {  9,  -5,   4 }, {  9,  -5,   4 }, {  9,  -5,   4 }, {  9,  -5,   4 },
+    /* 2232 */ {  9,  -5,  -4 }, {  9,  -5,  -4 }, {  9,  -5,  -4 }, {  9,  -5,  -4 }, {  9,  -5,  -4 }, {  9,  -5,  -4 }, {  9,  -5,  -4 }, {  9,  -5,  -4 },
+    /* 2240 */ { 10,   4,   5 }, { 10,   4,   5 }, { 10,   4,   5 }, { 10,   4,   5 }, { 10,   4,  -5 }, { 10,   4,  -5 }, { 10,   4,  -5 }, { 10,   4,  -5 },
+    /* 2248 */ { 10,  -4,   5 }, { 10,  -4,   5 }, { 10,  -4,   5 }, { 10,  -4,   5 }, { 10,  -4,  -5 }, { 10,  -4,  -5 }, { 10,  -4,  -5 }, { 10,  -4,  -5 },
+    /* 2256 */ { 10,   6,   2 }, { 10,   6,   2 }, { 10,   6,   2 }, { 10,   6,   2 }, { 10,   6,  -2 }, { 10,   6,  -2 }, { 10,   6,  -2 }, { 10,   6,  -2 },
+    /* 2264 */ { 10,  -6,   2 }, { 10,  -6,   2 }, { 10,  -6,   2 }, { 10,  -6,   2 }, { 10,  -6,  -2 }, { 10,  -6,  -2 }, { 10,  -6,  -2 }, { 10,  -6,  -2 },
+    /* 2272 */ { 10,   2,   6 }, { 10,   2,   6 }, { 10,   2,   6 }, { 10,   2,   6 }, { 10,   2,  -6 }, { 10,   2,  -6 }, { 10,   2,  -6 }, { 10,   2,  -6 },
+    /* 2280 */ { 10,  -2,   6 }, { 10,  -2,   6 }, { 10,  -2,   6 }, { 10,  -2,   6 }, { 10,  -2,  -6 }, { 10,  -2,  -6 }, { 10,  -2,  -6 }, { 10,  -2,  -6 },
+    /* 2288 */ { 10,   6,   1 }, { 10,   6,   1 }, { 10,   6,   1 }, { 10,   6,   1 }, { 10,   6,  -1 }, { 10,   6,  -1 }, { 10,   6,  -1 }, { 10,   6,  -1 },
+    /* 2296 */ { 10,  -6,   1 }, { 10,  -6,   1 }, { 10,  -6,   1 }, { 10,  -6,   1 }, { 10,  -6,  -1 }, { 10,  -6,  -1 }, { 10,  -6,  -1 }, { 10,  -6,  -1 },
+    /* 2304 */ { 10,   6,   3 }, { 10,   6,   3 }, { 10,   6,   3 }, { 10,   6,   3 }, { 10,   6,  -3 }, { 10,   6,  -3 }, { 10,   6,  -3 }, { 10,   6,  -3 },
+    /* 2312 */ { 10,  -6,   3 }, { 10,  -6,   3 }, { 10,  -6,   3 }, { 10,  -6,   3 }, { 10,  -6,  -3 }, { 10,  -6,  -3 }, { 10,  -6,  -3 }, { 10,  -6,  -3 },
+    /* 2320 */ { 10,   3,   6 }, { 10,   3,   6 }, { 10,   3,   6 }, { 10,   3,   6 }, { 10,   3,  -6 }, { 10,   3,  -6 }, { 10,   3,  -6 }, { 10,   3,  -6 },
+    /* 2328 */ { 10,  -3,   6 }, { 10,  -3,   6 }, { 10,  -3,   6 }, { 10,  -3,   6 }, { 10,  -3,  -6 }, { 10,  -3,  -6 }, { 10,  -3,  -6 }, { 10,  -3,  -6 },
+    /* 2336 */ { 10,   1,   6 }, { 10,   1,   6 }, { 10,   1,   6 }, { 10,   1,   6 }, { 10,   1,  -6 }, { 10,   1,  -6 }, { 10,   1,  -6 }, { 10,   1,  -6 },
+    /* 2344 */ { 10,  -1,   6 }, { 10,  -1,   6 }, { 10,  -1,   6 }, { 10,  -1,   6 }, { 10,  -1,  -6 }, { 10,  -1,  -6 }, { 10,  -1,  -6 }, { 10,  -1,  -6 },
+    /* 2352 */ { 10,   4,  16 }, { 10,   4,  16 }, { 10,   4,  16 }, { 10,   4,  16 }, { 10,   4, -16 }, { 10,   4, -16 }, { 10,   4, -16 }, { 10,   4, -16 },
+    /* 2360 */ { 10,  -4,  16 }, { 10,  -4,  16 }, { 10,  -4,  16 }, { 10,  -4,  16 }, { 10,  -4, -16 }, { 10,  -4, -16 }, { 10,  -4, -16 }, { 10,  -4, -16 },
+    /* 2368 */ { 10,   3,  16 }, { 10,   3,  16 }, { 10,   3,  16 }, { 10,   3,  16 }, { 10,   3, -16 }, { 10,   3, -16 }, { 10,   3, -16 }, { 10,   3, -16 },
+    /* 2376 */ { 10,  -3,  16 }, { 10,  -3,  16 }, { 10,  -3,  16 }, { 10,  -3,  16 }, { 10,  -3, -16 }, { 10,  -3, -16 }, { 10,  -3, -16 }, { 10,  -3, -16 },
+    /* 2384 */ { 10,  16,   5 }, { 10,  16,   5 }, { 10,  16,   5 }, { 10,  16,   5 }, { 10,  16,  -5 }, { 10,  16,  -5 }, { 10,  16,  -5 }, { 10,  16,  -5 },
+    /* 2392 */ { 10, -16,   5 }, { 10, -16,   5 }, { 10, -16,   5 }, { 10, -16,   5 }, { 10, -16,  -5 }, { 10, -16,  -5 }, { 10, -16,  -5 }, { 10, -16,  -5 },
+    /* 2400 */ { 10,  16,   3 }, { 10,  16,   3 }, { 10,  16,   3 }, { 10,  16,   3 }, { 10,  16,  -3 }, { 10,  16,  -3 }, { 10,  16,  -3 }, { 10,  16,  -3 },
+    /* 2408 */ { 10, -16,   3 }, { 10, -16,   3 }, { 10, -16,   3 }, { 10, -16,   3 }, { 10, -16,  -3 }, { 10, -16,  -3 }, { 10, -16,  -3 }, { 10, -16,  -3 },
+    /* 2416 */ { 10,  16,   4 }, { 10,  16,   4 }, { 10,  16,   4 }, { 10,  16,   4 }, { 10,  16,  -4 }, { 10,  16,  -4 }, { 10,  16,  -4 }, { 10,  16,  -4 },
+    /* 2424 */ { 10, -16,   4 }, { 10, -16,   4 }, { 10, -16,   4 }, { 10, -16,   4 }, { 10, -16,  -4 }, { 10, -16,  -4 }, { 10, -16,  -4 }, { 10, -16,  -4 },
+    /* 2432 */ { 10,   6,   4 }, { 10,   6,   4 }, { 10,   6,   4 }, { 10,   6,   4 }, { 10,   6,  -4 }, { 10,   6,  -4 }, { 10,   6,  -4 }, { 10,   6,  -4 },
+    /* 2440 */ { 10,  -6,   4 }, { 10,  -6,   4 }, { 10,  -6,   4 }, { 10,  -6,   4 }, { 10,  -6,  -4 }, { 10,  -6,  -4 }, { 10,  -6,  -4 }, { 10,  -6,  -4 },
+    /* 2448 */ { 10,  16,   6 }, { 10,  16,   6 }, { 10,  16,   6 }, { 10,  16,   6 }, { 10,  16,  -6 }, { 10,  16,  -6 }, { 10,  16,  -6 }, { 10,  16,  -6 },
+    /* 2456 */ { 10, -16,   6 }, { 10, -16,   6 }, { 10, -16,   6 }, { 10, -16,   6 }, { 10, -16,  -6 }, { 10, -16,  -6 }, { 10, -16,  -6 }, { 10, -16,  -6 },
+    /* 2464 */ {  9,   4,   0 }, {  9,   4,   0 }, {  9,   4,   0 }, {  9,   4,   0 }, {  9,   4,   0 }, {  9,   4,   0 }, {  9,   4,   0 }, {  9,   4,   0 },
+    /* 2472 */ {  9,  -4,   0 }, {  9,  -4,   0 }, {  9,  -4,   0 }, {  9,  -4,   0 }, {  9,  -4,   0 }, {  9,  -4,   0 }, {  9,  -4,   0 }, {  9,  -4,   0 },
+    /* 2480 */ { 10,   4,   6 }, { 10,   4,   6 }, { 10,   4,   6 }, { 10,   4,   6 }, { 10,   4,  -6 }, { 10,   4,  -6 }, { 10,   4,  -6 }, { 10,   4,  -6 },
+    /* 2488 */ { 10,  -4,   6 }, { 10,  -4,   6 }, { 10,  -4,   6 }, { 10,  -4,   6 }, { 10,  -4,  -6 }, { 10,  -4,  -6 }, { 10,  -4,  -6 }, { 10,  -4,  -6 },
+    /* 2496 */ {  9,   0,   4 }, {  9,   0,   4 }, {  9,   0,   4 }, {  9,   0,   4 }, {  9,   0,   4 }, {  9,   0,   4 }, {  9,   0,   4 }, {  9,   0,   4 },
+    /* 2504 */ {  9,   0,  -4 }, {  9,   0,  -4 }, {  9,   0,  -4 }, {  9,   0,  -4 }, {  9,   0,  -4 }, {  9,   0,  -4 }, {  9,   0,  -4 }, {  9,   0,  -4 },
+    /* 2512 */ { 10,   2,  16 }, { 10,   2,  16 }, { 10,   2,  16 }, { 10,   2,  16 }, { 10,   2, -16 }, { 10,   2, -16 }, { 10,   2, -16 }, { 10,   2, -16 },
+    /* 2520 */ { 10,  -2,  16 }, { 10,  -2,  16 }, { 10,  -2,  16 }, { 10,  -2,  16 }, { 10,  -2, -16 }, { 10,  -2, -16 }, { 10,  -2, -16 }, { 10,  -2, -16 },
+    /* 2528 */ { 10,   5,   5 }, { 10,   5,   5 }, { 10,   5,   5 }, { 10,   5,   5 }, { 10,   5,  -5 }, { 10,   5,  -5 }, { 10,   5,  -5 }, { 10,   5,  -5 },
+    /* 2536 */ { 10,  -5,   5 }, { 10,  -5,   5 }, { 10,  -5,   5 }, { 10,  -5,   5 }, { 10,  -5,  -5 }, { 10,  -5,  -5 }, { 10,  -5,  -5 }, { 10,  -5,  -5 },
+    /* 2544 */ { 10,   5,  16 }, { 10,   5,  16 }, { 10,   5,  16 }, { 10,   5,  16 }, { 10,   5, -16 }, { 10,   5, -16 }, { 10,   5, -16 }, { 10,   5, -16 },
+    /* 2552 */ { 10,  -5,  16 }, { 10,  -5,  16 }, { 10,  -5,  16 }, { 10,  -5,  16 }, { 10,  -5, -16 }, { 10,  -5, -16 }, { 10,  -5, -16 }, { 10,  -5, -16 },
+    /* 2560 */ { 10,  16,   7 }, { 10,  16,   7 }, { 10,  16,   7 }, { 10,  16,   7 }, { 10,  16,  -7 }, { 10,  16,  -7 }, { 10,  16,  -7 }, { 10,  16,  -7 },
+    /* 2568 */ { 10, -16,   7 }, { 10, -16,   7 }, { 10, -16,   7 }, { 10, -16,   7 }, { 10, -16,  -7 }, { 10, -16,  -7 }, { 10, -16,  -7 }, { 10, -16,  -7 },
+    /* 2576 */ { 10,  16,   2 }, { 10,  16,   2 }, { 10,  16,   2 }, { 10,  16,   2 }, { 10,  16,  -2 }, { 10,  16,  -2 }, { 10,  16,  -2 }, { 10,  16,  -2 },
+    /* 2584 */ { 10, -16,   2 }, { 10, -16,   2 }, { 10, -16,   2 }, { 10, -16,   2 }, { 10, -16,  -2 }, { 10, -16,  -2 }, { 10, -16,  -2 }, { 10, -16,  -2 },
+    /* 2592 */ { 10,  16,   8 }, { 10,  16,   8 }, { 10,  16,   8 }, { 10,  16,   8 }, { 10,  16,  -8 }, { 10,  16,  -8 }, { 10,  16,  -8 }, { 10,  16,  -8 },
+    /* 2600 */ { 10, -16,   8 }, { 10, -16,   8 }, { 10, -16,   8 }, { 10, -16,   8 }, { 10, -16,  -8 }, { 10, -16,  -8 }, { 10, -16,  -8 }, { 10, -16,  -8 },
+    /* 2608 */ { 10,   2,   7 }, { 10,   2,   7 }, { 10,   2,   7 }, { 10,   2,   7 }, { 10,   2,  -7 }, { 10,   2,  -7 }, { 10,   2,  -7 }, { 10,   2,  -7 },
+    /* 2616 */ { 10,  -2,   7 }, { 10,  -2,   7 }, { 10,  -2,   7 }, { 10,  -2,   7 }, { 10,  -2,  -7 }, { 10,  -2,  -7 }, { 10,  -2,  -7 }, { 10,  -2,  -7 },
+    /* 2624 */ { 10,   7,   2 }, { 10,   7,   2 }, { 10,   7,   2 }, { 10,   7,   2 }, { 10,   7,  -2 }, { 10,   7,  -2 }, { 10,   7,  -2 }, { 10,   7,  -2 },
+    /* 2632 */ { 10,  -7,   2 }, { 10,  -7,   2 }, { 10,  -7,   2 }, { 10,  -7,   2 }, { 10,  -7,  -2 }, { 10,  -7,  -2 }, { 10,  -7,  -2 }, { 10,  -7,  -2 },
+    /* 2640 */ { 10,   3,   7 }, { 10,   3,   7 }, { 10,   3,   7 }, { 10,   3,   7 }, { 10,   3,  -7 }, { 10,   3,  -7 }, { 10,   3,  -7 }, { 10,   3,  -7 },
+    /* 2648 */ { 10,  -3,   7 }, { 10,  -3,   7 }, { 10,  -3,   7 }, { 10,  -3,   7 }, { 10,  -3,  -7 }, { 10,  -3,  -7 }, { 10,  -3,  -7 }, { 10,  -3,  -7 },
+    /* 2656 */ { 10,   6,   5 }, { 10,   6,   5 }, { 10,   6,   5 }, { 10,   6,   5 }, { 10,   6,  -5 }, { 10,   6,  -5 }, { 10,   6,  -5 }, { 10,   6,  -5 },
+    /* 2664 */ { 10,  -6,   5 }, { 10,  -6,   5 }, { 10,  -6,   5 }, { 10,  -6,   5 }, { 10,  -6,  -5 }, { 10,  -6,  -5 }, { 10,  -6,  -5 }, { 10,  -6,  -5 },
+    /* 2672 */ { 10,   5,   6 }, { 10,   5,   6 }, { 10,   5,   6 }, { 10,   5,   6 }, { 10,   5,  -6 }, { 10,   5,  -6 }, { 10,   5,  -6 }, { 10,   5,  -6 },
+    /* 2680 */ { 10,  -5,   6 }, { 10,  -5,   6 }, { 10,  -5,   6 }, { 10,  -5,   6 }, { 10,  -5,  -6 }, { 10,  -5,  -6 }, { 10,  -5,  -6 }, { 10,  -5,  -6 },
+    /* 2688 */ { 10,   6,  16 }, { 10,   6,  16 }, { 10,   6,  16 }, { 10,   6,  16 }, { 10,   6, -16 }, { 10,   6, -16 }, { 10,   6, -16 }, { 10,   6, -16 },
+    /* 2696 */ { 10,  -6,  16 }, { 10,  -6,  16 }, { 10,  -6,  16 }, { 10,  -6,  16 }, { 10,  -6, -16 }, { 10,  -6, -16 }, { 10,  -6, -16 }, { 10,  -6, -16 },
+    /* 2704 */ { 10,  16,  10 }, { 10,  16,  10 }, { 10,  16,  10 }, { 10,  16,  10 }, { 10,  16, -10 }, { 10,  16, -10 }, { 10,  16, -10 }, { 10,  16, -10 },
+    /* 2712 */ { 10, -16,  10 }, { 10, -16,  10 }, { 10, -16,  10 }, { 10, -16,  10 }, { 10, -16, -10 }, { 10, -16, -10 }, { 10, -16, -10 }, { 10, -16, -10 },
+    /* 2720 */ { 10,   7,   3 }, { 10,   7,   3 }, { 10,   7,   3 }, { 10,   7,   3 }, { 10,   7,  -3 }, { 10,   7,  -3 }, { 10,   7,  -3 }, { 10,   7,  -3 },
+    /* 2728 */ { 10,  -7,   3 }, { 10,  -7,   3 }, { 10,  -7,   3 }, { 10,  -7,   3 }, { 10,  -7,  -3 }, { 10,  -7,  -3 }, { 10,  -7,  -3 }, { 10,  -7,  -3 },
+    /* 2736 */ { 10,   7,   1 }, { 10,   7,   1 }, { 10,   7,   1 }, { 10,   7,   1 }, { 10,   7,  -1 }, { 10,   7,  -1 }, { 10,   7,  -1 }, { 10,   7,  -1 },
+    /* 2744 */ { 10,  -7,   1 }, { 10,  -7,   1 }, { 10,  -7,   1 }, { 10,  -7,   1 }, { 10,  -7,  -1 }, { 10,  -7,  -1 }, { 10,  -7,  -1 }, { 10,  -7,  -1 },
+    /* 2752 */ { 10,  16,   9 }, { 10,  16,   9 }, { 10,  16,   9 }, { 10,  16,   9 }, { 10,  16,  -9 }, { 10,  16,  -9 }, { 10,  16,  -9 }, { 10,  16,  -9 },
+    /* 2760 */ { 10, -16,   9 }, { 10, -16,   9 }, { 10, -16,   9 }, { 10, -16,   9 }, { 10, -16,  -9 }, { 10, -16,  -9 }, { 10, -16,  -9 }, { 10, -16,  -9 },
+    /* 2768 */ { 10,   7,  16 }, { 10,   7,  16 }, { 10,   7,  16 }, { 10,   7,  16 }, { 10,   7, -16 }, { 10,   7, -16 }, { 10,   7, -16 }, { 10,   7, -16 },
+    /* 2776 */ { 10,  -7,  16 }, { 10,  -7,  16 }, { 10,  -7,  16 }, { 10,  -7,  16 }, { 10,  -7, -16 }, { 10,  -7, -16 }, { 10,  -7, -16 }, { 10,  -7, -16 },
+    /* 2784 */ { 10,   1,  16 }, { 10,   1,  16 }, { 10,   1,  16 }, { 10,   1,  16 }, { 10,   1, -16 }, { 10,   1, -16 }, { 10,   1, -16 }, { 10,   1, -16 },
+    /* 2792 */ { 10,  -1,  16 }, { 10,  -1,  16 }, { 10,  -1,  16 }, { 10,  -1,  16 }, { 10,  -1, -16 }, { 10,  -1, -16 }, { 10,  -1, -16 }, { 10,  -1, -16 },
+    /* 2800 */ { 10,   1,   7 }, { 10,   1,   7 }, { 10,   1,   7 }, { 10,   1,   7 }, { 10,   1,  -7 }, { 10,   1,  -7 }, { 10,   1,  -7 }, { 10,   1,  -7 },
+    /* 2808 */ { 10,  -1,   7 }, { 10,  -1,   7 }, { 10,  -1,   7 }, { 10,  -1,   7 }, { 10,  -1,  -7 }, { 10,  -1,  -7 }, { 10,  -1,  -7 }, { 10,  -1,  -7 },
+    /* 2816 */ { 10,   4,   7 }, { 10,   4,   7 }, { 10,   4,   7 }, { 10,   4,   7 }, { 10,   4,  -7 }, { 10,   4,  -7 }, { 10,   4,  -7 }, { 10,   4,  -7 },
+    /* 2824 */ { 10,  -4,   7 }, { 10,  -4,   7 }, { 10,  -4,   7 }, { 10,  -4,   7 }, { 10,  -4,  -7 }, { 10,  -4,  -7 }, { 10,  -4,  -7 }, { 10,  -4,  -7 },
+    /* 2832 */ { 10,  16,  11 }, { 10,  16,  11 }, { 10,  16,  11 }, { 10,  16,  11 }, { 10,  16, -11 }, { 10,  16, -11 }, { 10,  16, -11 }, { 10,  16, -11 },
+    /* 2840 */ { 10, -16,  11 }, { 10, -16,  11 }, { 10, -16,  11 }, { 10, -16,  11 }, { 10, -16, -11 }, { 10, -16, -11 }, { 10, -16, -11 }, { 10, -16, -11 },
+    /* 2848 */ { 10,   7,   4 }, { 10,   7,   4 }, { 10,   7,   4 }, { 10,   7,   4 }, { 10,   7,  -4 }, { 10,   7,  -4 }, { 10,   7,  -4 }, { 10,   7,  -4 },
+    /* 2856 */ { 10,  -7,   4 }, { 10,  -7,   4 }, { 10,  -7,   4 }, { 10,  -7,   4 }, { 10,  -7,  -4 }, { 10,  -7,  -4 }, { 10,  -7,  -4 }, { 10,  -7,  -4 },
+    /* 2864 */ { 10,  16,  12 }, { 10,  16,  12 }, { 10,  16,  12 }, { 10,  16,  12 }, { 10,  16, -12 }, { 10,  16, -12 }, { 10,  16, -12 }, { 10,  16, -12 },
+    /* 2872 */ { 10, -16,  12 }, { 10, -16,  12 }, { 10, -16,  12 }, { 10, -16,  12 }, { 10, -16, -12 }, { 10, -16, -12 }, { 10, -16, -12 }, { 10, -16, -12 },
+    /* 2880 */ { 10,   8,  16 }, { 10,   8,  16 }, { 10,   8,  16 }, { 10,   8,  16 }, { 10,   8, -16 }, { 10,   8, -16 }, { 10,   8, -16 }, { 10,   8, -16 },
+    /* 2888 */ { 10,  -8,  16 }, { 10,  -8,  16 }, { 10,  -8,  16 }, { 10,  -8,  16 }, { 10,  -8, -16 }, { 10,  -8, -16 }, { 10,  -8, -16 }, { 10,  -8, -16 },
+    /* 2896 */ { 10,  16,   1 }, { 10,  16,   1 }, { 10,  16,   1 }, { 10,  16,   1 }, { 10,  16,  -1 }, { 10,  16,  -1 }, { 10,  16,  -1 }, { 10,  16,  -1 },
+    /* 2904 */ { 10, -16,   1 }, { 10, -16,   1 }, { 10, -16,   1 }, { 10, -16,   1 }, { 10, -16,  -1 }, { 10, -16,  -1 }, { 10, -16,  -1 }, { 10, -16,  -1 },
+    /* 2912 */ { 10,   6,   6 }, { 10,   6,   6 }, { 10,   6,   6 }, { 10,   6,   6 }, { 10,   6,  -6 }, { 10,   6,  -6 }, { 10,   6,  -6 }, { 10,   6,  -6 },
+    /* 2920 */ { 10,  -6,   6 }, { 10,  -6,   6 }, { 10,  -6,   6 }, { 10,  -6,   6 }, { 10,  -6,  -6 }, { 10,  -6,  -6 }, { 10,  -6,  -6 }, { 10,  -6,  -6 },
+    /* 2928 */ { 10,   9,  16 }, { 10,   9,  16 }, { 10,   9,  16 }, { 10,   9,  16 }, { 10,   9, -16 }, { 10,   9, -16 }, { 10,   9, -16 }, { 10,   9, -16 },
+    /* 2936 */ { 10,  -9,  16 }, { 10,  -9,  16 }, { 10,  -9,  16 }, { 10,  -9,  16 }, { 10,  -9, -16 }, { 10,  -9, -16 }, { 10,  -9, -16 }, { 10,  -9, -16 },
+    /* 2944 */ { 10,   2,   8 }, { 10,   2,   8 }, { 10,   2,   8 }, { 10,   2,   8 }, { 10,   2,  -8 }, { 10,   2,  -8 }, { 10,   2,  -8 }, { 10,   2,  -8 },
+    /* 2952 */ { 10,  -2,   8 }, { 10,  -2,   8 }, { 10,  -2,   8 }, { 10,  -2,   8 }, { 10,  -2,  -8 }, { 10,  -2,  -8 }, { 10,  -2,  -8 }, { 10,  -2,  -8 },
+    /* 2960 */ { 10,   5,   7 }, { 10,   5,   7 }, { 10,   5,   7 }, { 10,   5,   7 }, { 10,   5,  -7 }, { 10,   5,  -7 }, { 10,   5,  -7 }, { 10,   5,  -7 },
+    /* 2968 */ { 10,  -5,   7 }, { 10,  -5,   7 }, { 10,  -5,   7 }, { 10,  -5,   7 }, { 10,  -5,  -7 }, { 10,  -5,  -7 }, { 10,  -5,  -7 }, { 10,  -5,  -7 },
+    /* 2976 */ { 10,  10,  16 }, { 10,  10,  16 }, { 10,  10,  16 }, { 10,  10,  16 }, { 10,  10, -16 }, { 10,  10, -16 }, { 10,  10, -16 }, { 10,  10, -16 },
+    /* 2984 */ { 10, -10,  16 }, { 10, -10,  16 }, { 10, -10,  16 }, { 10, -10,  16 }, { 10, -10, -16 }, { 10, -10, -16 }, { 10, -10, -16 }, { 10, -10, -16 },
+    /* 2992 */ { 10,  16,  13 }, { 10,  16,  13 }, { 10,  16,  13 }, { 10,  16,  13 }, { 10,  16, -13 }, { 10,  16, -13 }, { 10,  16, -13 }, { 10,  16, -13 },
+    /* 3000 */ { 10, -16,  13 }, { 10, -16,  13 }, { 10, -16,  13 }, { 10, -16,  13 }, { 10, -16, -13 }, { 10, -16, -13 }, { 10, -16, -13 }, { 10, -16, -13 },
+    /* 3008 */ { 10,   8,   3 }, { 10,   8,   3 }, { 10,   8,   3 }, { 10,   8,   3 }, { 10,   8,  -3 }, { 10,   8,  -3 }, { 10,   8,  -3 }, { 10,   8,  -3 },
+    /* 3016 */ { 10,  -8,   3 }, { 10,  -8,   3 }, { 10,  -8,   3 }, { 10,  -8,   3 }, { 10,  -8,  -3 }, { 10,  -8,  -3 }, { 10,  -8,  -3 }, { 10,  -8,  -3 },
+    /* 3024 */ { 10,   8,   2 }, { 10,   8,   2 }, { 10,   8,   2 }, { 10,   8,   2 }, { 10,   8,  -2 }, { 10,   8,  -2 }, { 10,   8,  -2 }, { 10,   8,  -2 },
+    /* 3032 */ { 10,  -8,   2 }, { 10,  -8,   2 }, { 10,  -8,   2 }, { 10,  -8,   2 }, { 10,  -8,  -2 }, { 10,  -8,  -2 }, { 10,  -8,  -2 }, { 10,  -8,  -2 },
+    /* 3040 */ { 10,   3,   8 }, { 10,   3,   8 }, { 10,   3,   8 }, { 10,   3,   8 }, { 10,   3,  -8 }, { 10,   3,  -8 }, { 10,   3,  -8 }, { 10,   3,  -8 },
+    /* 3048 */ { 10,  -3,   8 }, { 10,  -3,   8 }, { 10,  -3,   8 }, { 10,  -3,   8 }, { 10,  -3,  -8 }, { 10,  -3,  -8 }, { 10,  -3,  -8 }, { 10,  -3,  -8 },
+    /* 3056 */ {  9,   5,   0 }, {  9,   5,   0 }, {  9,   5,   0 }, {  9,   5,   0 }, {  9,   5,   0 }, {  9,   5,   0 }, {  9,   5,   0 }, {  9,   5,   0 },
+    /* 3064 */ {  9,  -5,   0 }, {  9,  -5,   0 }, {  9,  -5,   0 }, {  9,  -5,   0 }, {  9,  -5,   0 }, {  9,  -5,   0 }, {  9,  -5,   0 }, {  9,  -5,   0 },
+    /* 3072 */ { 10,  16,  14 }, { 10,  16,  14 }, { 10,  16,  14 }, { 10,  16,  14 }, { 10,  16, -14 }, { 10,  16, -14 }, { 10,  16, -14 }, { 10,  16, -14 },
+    /* 3080 */ { 10, -16,  14 }, { 10, -16,  14 }, { 10, -16,  14 }, { 10, -16,  14 }, { 10, -16, -14 }, { 10, -16, -14 }, { 10, -16, -14 }, { 10, -16, -14 },
+    /* 3088 */ { 10,  11,  16 }, { 10,  11,  16 }, { 10,  11,  16 }, { 10,  11,  16 }, { 10,  11, -16 }, { 10,  11, -16 }, { 10,  11, -16 }, { 10,  11, -16 },
+    /* 3096 */ { 10, -11,  16 }, { 10, -11,  16 }, { 10, -11,  16 }, { 10, -11,  16 }, { 10, -11, -16 }, { 10, -11, -16 }, { 10, -11, -16 }, { 10, -11, -16 },
+    /* 3104 */ { 10,   7,   5 }, { 10,   7,   5 }, { 10,   7,   5 }, { 10,   7,   5 }, { 10,   7,  -5 }, { 10,   7,  -5 }, { 10,   7,  -5 }, { 10,   7,  -5 },
+    /* 3112 */ { 10,  -7,   5 }, { 10,  -7,   5 }, { 10,  -7,   5 }, { 10,  -7,   5 }, { 10,  -7,  -5 }, { 10,  -7,  -5 }, { 10,  -7,  -5 }, { 10,  -7,  -5 },
+    /* 3120 */ { 10,   4,   8 }, { 10,   4,   8 }, { 10,   4,   8 }, { 10,   4,   8 }, { 10,   4,  -8 }, { 10,   4,  -8 }, { 10,   4,  -8 }, { 10,   4,  -8 },
+    /* 3128 */ { 10,  -4,   8 }, { 10,  -4,   8 }, { 10,  -4,   8 }, { 10,  -4,   8 }, { 10,  -4,  -8 }, { 10,  -4,  -8 }, { 10,  -4,  -8 }, { 10,  -4,  -8 },
+    /* 3136 */ { 10,   6,   7 }, { 10,   6,   7 }, { 10,   6,   7 }, { 10,   6,   7 }, { 10,   6,  -7 }, { 10,   6,  -7 }, { 10,   6,  -7 }, { 10,   6,  -7 },
+    /* 3144 */ { 10,  -6,   7 }, { 10,  -6,   7 }, { 10,  -6,   7 }, { 10,  -6,   7 }, { 10,  -6,  -7 }, { 10,  -6,  -7 }, { 10,  -6,  -7 }, { 10,  -6,  -7 },
+    /* 3152 */ { 10,   7,   6 }, { 10,   7,   6 }, { 10,   7,   6 }, { 10,   7,   6 }, { 10,   7,  -6 }, { 10,   7,  -6 }, { 10,   7,  -6 }, { 10,   7,  -6 },
+    /* 3160 */ { 10,  -7,   6 }, { 10,  -7,   6 }, { 10,  -7,   6 }, { 10,  -7,   6 }, { 10,  -7,  -6 }, { 10,  -7,  -6 }, { 10,  -7,  -6 }, { 10,  -7,  -6 },
+    /* 3168 */ {  9,   0,   5 }, {  9,   0,   5 }, {  9,   0,   5 }, {  9,   0,   5 }, {  9,   0,   5 }, {  9,   0,   5 }, {  9,   0,   5 }, {  9,   0,   5 },
+    /* 3176 */ {  9,   0,  -5 }, {  9,   0,  -5 }, {  9,   0,  -5 }, {  9,   0,  -5 }, {  9,   0,  -5 }, {  9,   0,  -5 }, {  9,   0,  -5 }, {  9,   0,  -5 },
+    /* 3184 */ { 11,   8,   4 }, { 11,   8,   4 }, { 11,   8,  -4 }, { 11,   8,  -4 }, { 11,  -8,   4 }, { 11,  -8,   4 }, { 11,  -8,  -4 }, { 11,  -8,  -4 },
+    /* 3192 */ { 11,  16,  15 }, { 11,  16,  15 }, { 11,  16, -15 }, { 11,  16, -15 }, { 11, -16,  15 }, { 11, -16,  15 }, { 11, -16, -15 }, { 11, -16, -15 },
+    /* 3200 */ { 11,  12,  16 }, { 11,  12,  16 }, { 11,  12, -16 }, { 11,  12, -16 }, { 11, -12,  16 }, { 11, -12,  16 }, { 11, -12, -16 }, { 11, -12, -16 },
+    /* 3208 */ { 11,   1,   8 }, { 11,   1,   8 }, { 11,   1,  -8 }, { 11,   1,  -8 }, { 11,  -1,   8 }, { 11,  -1,   8 }, { 11,  -1,  -8 }, { 11,  -1,  -8 },
+    /* 3216 */ { 11,   8,   1 }, { 11,   8,   1 }, { 11,   8,  -1 }, { 11,   8,  -1 }, { 11,  -8,   1 }, { 11,  -8,   1 }, { 11,  -8,  -1 }, { 11,  -8,  -1 },
+    /* 3224 */ { 11,  14,  16 }, { 11,  14,  16 }, { 11,  14, -16 }, { 11,  14, -16 }, { 11, -14,  16 }, { 11, -14,  16 }, { 11, -14, -16 }, { 11, -14, -16 },
+    /* 3232 */ { 11,   5,   8 }, { 11,   5,   8 }, { 11,   5,  -8 }, { 11,   5,  -8 }, { 11,  -5,   8 }, { 11,  -5,   8 }, { 11,  -5,  -8 }, { 11,  -5,  -8 },
+    /* 3240 */ { 11,  13,  16 }, { 11,  13,  16 }, { 11,  13, -16 }, { 11,  13, -16 }, { 11, -13,  16 }, { 11, -13,  16 }, { 11, -13, -16 }, { 11, -13, -16 },
+    /* 3248 */ { 11,   3,   9 }, { 11,   3,   9 }, { 11,   3,  -9 }, { 11,   3,  -9 }, { 11,  -3,   9 }, { 11,  -3,   9 }, { 11,  -3,  -9 }, { 11,  -3,  -9 },
+    /* 3256 */ { 11,   8,   5 }, { 11,   8,   5 }, { 11,   8,  -5 }, { 11,   8,  -5 }, { 11,  -8,   5 }, { 11,  -8,   5 }, { 11,  -8,  -5 }, { 11,  -8,  -5 },
+    /* 3264 */ { 11,   7,   7 }, { 11,   7,   7 }, { 11,   7,  -7 }, { 11,   7,  -7 }, { 11,  -7,   7 }, { 11,  -7,   7 }, { 11,  -7,  -7 }, { 11,  -7,  -7 },
+    /* 3272 */ { 11,   2,   9 }, { 11,   2,   9 }, { 11,   2,  -9 }, { 11,   2,  -9 }, { 11,  -2,   9 }, { 11,  -2,   9 }, { 11,  -2,  -9 }, { 11,  -2,  -9 },
+    /* 3280 */ { 11,   8,   6 }, { 11,   8,   6 }, { 11,   8,  -6 }, { 11,   8,  -6 }, { 11,  -8,   6 }, { 11,  -8,   6 }, { 11,  -8,  -6 }, { 11,  -8,  -6 },
+    /* 3288 */ { 11,   9,   2 }, { 11,   9,   2 }, { 11,   9,  -2 }, { 11,   9,  -2 }, { 11,  -9,   2 }, { 11,  -9,   2 }, { 11,  -9,  -2 }, { 11,  -9,  -2 },
+    /* 3296 */ { 11,   9,   3 }, { 11,   9,   3 }, { 11,   9,  -3 }, { 11,   9,  -3 }, { 11,  -9,   3 }, { 11,  -9,   3 }, { 11,  -9,  -3 }, { 11,  -9,  -3 },
+    /* 3304 */ { 11,  15,  16 }, { 11,  15,  16 }, { 11,  15, -16 }, { 11,  15, -16 }, { 11, -15,  16 }, { 11, -15,  16 }, { 11, -15, -16 }, { 11, -15, -16 },
+    /* 3312 */ { 11,   4,   9 }, { 11,   4,   9 }, { 11,   4,  -9 }, { 11,   4,  -9 }, { 11,  -4,   9 }, { 11,  -4,   9 }, { 11,  -4,  -9 }, { 11,  -4,  -9 },
+    /* 3320 */ { 11,   6,   8 }, { 11,   6,   8 }, { 11,   6,  -8 }, { 11,   6,  -8 }, { 11,  -6,   8 }, { 11,  -6,   8 }, { 11,  -6,  -8 }, { 11,  -6,  -8 },
+    /* 3328 */ { 10,   6,   0 }, { 10,   6,   0 }, { 10,   6,   0 }, { 10,   6,   0 }, { 10,  -6,   0 }, { 10,  -6,   0 }, { 10,  -6,   0 }, { 10,  -6,   0 },
+    /* 3336 */ { 11,   9,   4 }, { 11,   9,   4 }, { 11,   9,  -4 }, { 11,   9,  -4 }, { 11,  -9,   4 }, { 11,  -9,   4 }, { 11,  -9,  -4 }, { 11,  -9,  -4 },
+    /* 3344 */ { 11,   5,   9 }, { 11,   5,   9 }, { 11,   5,  -9 }, { 11,   5,  -9 }, { 11,  -5,   9 }, { 11,  -5,   9 }, { 11,  -5,  -9 }, { 11,  -5,  -9 },
+    /* 3352 */ { 11,   8,   7 }, { 11,   8,   7 }, { 11,   8,  -7 }, { 11,   8,  -7 }, { 11,  -8,   7 }, { 11,  -8,   7 }, { 11,  -8,  -7 }, { 11,  -8,  -7 },
+    /* 3360 */ { 11,   7,   8 }, { 11,   7,   8 }, { 11,   7,  -8 }, { 11,   7,  -8 }, { 11,  -7,   8 }, { 11,  -7,   8 }, { 11,  -7,  -8 }, { 11,  -7,  -8 },
+    /* 3368 */ { 11,   1,   9 }, { 11,   1,   9 }, { 11,   1,  -9 }, { 11,   1,  -9 }, { 11,  -1,   9 }, { 11,  -1,   9 }, { 11,  -1,  -9 }, { 11,  -1,  -9 },
+    /* 3376 */ { 11,  10,   3 }, { 11,  10,   3 }, { 11,  10,  -3 }, { 11,  10,  -3 }, { 11, -10,   3 }, { 11, -10,   3 }, { 11, -10,  -3 }, { 11, -10,  -3 },
+    /* 3384 */ { 10,   0,   6 }, { 10,   0,   6 }, { 10,   0,   6 }, { 10,   0,   6 }, { 10,   0,  -6 }, { 10,   0,  -6 }, { 10,   0,  -6 }, { 10,   0,  -6 },
+    /* 3392 */ { 11,  10,   2 }, { 11,  10,   2 }, { 11,  10,  -2 }, { 11,  10,  -2 }, { 11, -10,   2 }, { 11, -10,   2 }, { 11, -10,  -2 }, { 11, -10,  -2 },
+    /* 3400 */ { 11,   9,   1 }, { 11,   9,   1 }, { 11,   9,  -1 }, { 11,   9,  -1 }, { 11,  -9,   1 }, { 11,  -9,   1 }, { 11,  -9,  -1 }, { 11,  -9,  -1 },
+    /* 3408 */ { 11,   9,   5 }, { 11,   9,   5 }, { 11,   9,  -5 }, { 11,   9,  -5 }, { 11,  -9,   5 }, { 11,  -9,   5 }, { 11,  -9,  -5 }, { 11,  -9,  -5 },
+    /* 3416 */ { 11,   4,  10 }, { 11,   4,  10 }, { 11,   4, -10 }, { 11,   4, -10 }, { 11,  -4,  10 }, { 11,  -4,  10 }, { 11,  -4, -10 }, { 11,  -4, -10 },
+    /* 3424 */ { 11,   2,  10 }, { 11,   2,  10 }, { 11,   2, -10 }, { 11,   2, -10 }, { 11,  -2,  10 }, { 11,  -2,  10 }, { 11,  -2, -10 }, { 11,  -2, -10 },
+    /* 3432 */ { 11,   9,   6 }, { 11,   9,   6 }, { 11,   9,  -6 }, { 11,   9,  -6 }, { 11,  -9,   6 }, { 11,  -9,   6 }, { 11,  -9,  -6 }, { 11,  -9,  -6 },
+    /* 3440 */ { 11,   3,  10 }, { 11,   3,  10 }, { 11,   3, -10 }, { 11,   3, -10 }, { 11,  -3,  10 }, { 11,  -3,  10 }, { 11,  -3, -10 }, { 11,  -3, -10 },
+    /* 3448 */ { 11,   6,   9 }, { 11,   6,   9 }, { 11,   6,  -9 }, { 11,   6,  -9 }, { 11,  -6,   9 }, { 11,  -6,   9 }, { 11,  -6,  -9 }, { 11,  -6,  -9 },
+    /* 3456 */ { 11,  10,   4 }, { 11,  10,   4 }, { 11,  10,  -4 }, { 11,  10,  -4 }, { 11, -10,   4 }, { 11, -10,   4 }, { 11, -10,  -4 }, { 11, -10,  -4 },
+    /* 3464 */ { 11,   8,   8 }, { 11,   8,   8 }, { 11,   8,  -8 }, { 11,   8,  -8 }, { 11,  -8,   8 }, { 11,  -8,   8 }, { 11,  -8,  -8 }, { 11,  -8,  -8 },
+    /* 3472 */ { 11,  10,   5 }, { 11,  10,   5 }, { 11,  10,  -5 }, { 11,  10,  -5 }, { 11, -10,   5 }, { 11, -10,   5 }, { 11, -10,  -5 }, { 11, -10,  -5 },
+    /* 3480 */ { 11,   9,   7 }, { 11,   9,   7 }, { 11,   9,  -7 }, { 11,   9,  -7 }, { 11,  -9,   7 }, { 11,  -9,   7 }, { 11,  -9,  -7 }, { 11,  -9,  -7 },
+    /* 3488 */ { 11,  11,   3 }, { 11,  11,   3 }, { 11,  11,  -3 }, { 11,  11,  -3 }, { 11, -11,   3 }, { 11, -11,   3 }, { 11, -11,  -3 }, { 11, -11,  -3 },
+    /* 3496 */ { 11,   1,  10 }, { 11,   1,  10 }, { 11,   1, -10 }, { 11,   1, -10 }, { 11,  -1,  10 }, { 11,  -1,  10 }, { 11,  -1, -10 }, { 11,  -1, -10 },
+    /* 3504 */ { 10,   7,   0 }, { 10,   7,   0 }, { 10,   7,   0 }, { 10,   7,   0 }, { 10,  -7,   0 }, { 10,  -7,   0 }, { 10,  -7,   0 }, { 10,  -7,   0 },
+    /* 3512 */ { 11,  10,   6 }, { 11,  10,   6 }, { 11,  10,  -6 }, { 11,  10,  -6 }, { 11, -10,   6 }, { 11, -10,   6 }, { 11, -10,  -6 }, { 11, -10,  -6 },
+    /* 3520 */ { 11,   7,   9 }, { 11,   7,   9 }, { 11,   7,  -9 }, { 11,   7,  -9 }, { 11,  -7,   9 }, { 11,  -7,   9 }, { 11,  -7,  -9 }, { 11,  -7,  -9 },
+    /* 3528 */ { 11,   3,  11 }, { 11,   3,  11 }, { 11,   3, -11 }, { 11,   3, -11 }, { 11,  -3,  11 }, { 11,  -3,  11 }, { 11,  -3, -11 }, { 11,  -3, -11 },
+    /* 3536 */ { 11,   5,  10 }, { 11,   5,  10 }, { 11,   5, -10 }, { 11,   5, -10 }, { 11,  -5,  10 }, { 11,  -5,  10 }, { 11,  -5, -10 }, { 11,  -5, -10 },
+    /* 3544 */ { 11,  10,   1 }, { 11,  10,   1 }, { 11,  10,  -1 }, { 11,  10,  -1 }, { 11, -10,   1 }, { 11, -10,   1 }, { 11, -10,  -1 }, { 11, -10,  -1 },
+    /* 3552 */ { 11,   4,  11 }, { 11,   4,  11 }, { 11,   4, -11 }, { 11,   4, -11 }, { 11,  -4,  11 }, { 11,  -4,  11 }, { 11,  -4, -11 }, { 11,  -4, -11 },
+    /* 3560 */ { 11,  11,   2 }, { 11,  11,   2 }, { 11,  11,  -2 }, { 11,  11,  -2 }, { 11, -11,   2 }, { 11, -11,   2 }, { 11, -11,  -2 }, { 11, -11,  -2 },
+    /* 3568 */ { 11,  13,   2 }, { 11,  13,   2 }, { 11,  13,  -2 }, { 11,  13,  -2 }, { 11, -13,   2 }, { 11, -13,   2 }, { 11, -13,  -2 }, { 11, -13,  -2 },
+    /* 3576 */ { 11,   6,  10 }, { 11,   6,  10 }, { 11,   6, -10 }, { 11,   6, -10 }, { 11,  -6,  10 }, { 11,  -6,  10 }, { 11,  -6, -10 }, { 11,  -6, -10 },
+    /* 3584 */ { 11,  13,   3 }, { 11,  13,   3 }, { 11,  13,  -3 }, { 11,  13,  -3 }, { 11, -13,   3 }, { 11, -13,   3 }, { 11, -13,  -3 }, { 11, -13,  -3 },
+    /* 3592 */ { 11,   2,  11 }, { 11,   2,  11 }, { 11,   2, -11 }, { 11,   2, -11 }, { 11,  -2,  11 }, { 11,  -2,  11 }, { 11,  -2, -11 }, { 11,  -2, -11 },
+    /* 3600 */ { 10,  16,   0 }, { 10,  16,   0 }, { 10,  16,   0 }, { 10,  16,   0 }, { 10, -16,   0 }, { 10, -16,   0 }, { 10, -16,   0 }, { 10, -16,   0 },
+    /* 3608 */ { 11,   5,  11 }, { 11,   5,  11 }, { 11,   5, -11 }, { 11,   5, -11 }, { 11,  -5,  11 }, { 11,  -5,  11 }, { 11,  -5, -11 }, { 11,  -5, -11 },
+    /* 3616 */ { 11,  11,   5 }, { 11,  11,   5 }, { 11,  11,  -5 }, { 11,  11,  -5 }, { 11, -11,   5 }, { 11, -11,   5 }, { 11, -11,  -5 }, { 11, -11,  -5 },
+    /* 3624 */ { 12,  11,   4 }, { 12,  11,  -4 }, { 12, -11,   4 }, { 12, -11,  -4 }, { 12,   9,   8 }, { 12,   9,  -8 }, { 12,  -9,   8 }, { 12,  -9,  -8 },
+    /* 3632 */ { 12,   7,  10 }, { 12,   7, -10 }, { 12,  -7,  10 }, { 12,  -7, -10 }, { 12,   8,   9 }, { 12,   8,  -9 }, { 12,  -8,   9 }, { 12,  -8,  -9 },
+    /* 3640 */ { 11,   0,  16 }, { 11,   0,  16 }, { 11,   0, -16 }, { 11,   0, -16 }, { 12,   4,  13 }, { 12,   4, -13 }, { 12,  -4,  13 }, { 12,  -4, -13 },
+    /* 3648 */ { 11,   0,   7 }, { 11,   0,   7 }, { 11,   0,  -7 }, { 11,   0,  -7 }, { 12,   3,  13 }, { 12,   3, -13 }, { 12,  -3,  13 }, { 12,  -3, -13 },
+    /* 3656 */ { 12,  11,   6 }, { 12,  11,  -6 }, { 12, -11,   6 }, { 12, -11,  -6 }, { 12,  13,   1 }, { 12,  13,  -1 }, { 12, -13,   1 }, { 12, -13,  -1 },
+    /* 3664 */ { 12,  13,   4 }, { 12,  13,  -4 }, { 12, -13,   4 }, { 12, -13,  -4 }, { 12,  12,   3 }, { 12,  12,  -3 }, { 12, -12,   3 }, { 12, -12,  -3 },
+    /* 3672 */ { 12,   2,  13 }, { 12,   2, -13 }, { 12,  -2,  13 }, { 12,  -2, -13 }, { 12,  13,   5 }, { 12,  13,  -5 }, { 12, -13,   5 }, { 12, -13,  -5 },
+    /* 3680 */ { 12,   8,  10 }, { 12,   8, -10 }, { 12,  -8,  10 }, { 12,  -8, -10 }, { 12,   6,  11 }, { 12,   6, -11 }, { 12,  -6,  11 }, { 12,  -6, -11 },
+    /* 3688 */ { 12,  10,   8 }, { 12,  10,  -8 }, { 12, -10,   8 }, { 12, -10,  -8 }, { 12,  10,   7 }, { 12,  10,  -7 }, { 12, -10,   7 }, { 12, -10,  -7 },
+    /* 3696 */ { 12,  14,   2 }, { 12,  14,  -2 }, { 12, -14,   2 }, { 12, -14,  -2 }, { 12,  12,   4 }, { 12,  12,  -4 }, { 12, -12,   4 }, { 12, -12,  -4 },
+    /* 3704 */ { 12,   1,  11 }, { 12,   1, -11 }, { 12,  -1,  11 }, { 12,  -1, -11 }, { 12,   4,  12 }, { 12,   4, -12 }, { 12,  -4,  12 }, { 12,  -4, -12 },
+    /* 3712 */ { 12,  11,   1 }, { 12,  11,  -1 }, { 12, -11,   1 }, { 12, -11,  -1 }, { 12,   3,  12 }, { 12,   3, -12 }, { 12,  -3,  12 }, { 12,  -3, -12 },
+    /* 3720 */ { 12,   1,  13 }, { 12,   1, -13 }, { 12,  -1,  13 }, { 12,  -1, -13 }, { 12,  12,   2 }, { 12,  12,  -2 }, { 12, -12,   2 }, { 12, -12,  -2 },
+    /* 3728 */ { 12,   7,  11 }, { 12,   7, -11 }, { 12,  -7,  11 }, { 12,  -7, -11 }, { 12,   3,  14 }, { 12,   3, -14 }, { 12,  -3,  14 }, { 12,  -3, -14 },
+    /* 3736 */ { 12,   5,  12 }, { 12,   5, -12 }, { 12,  -5,  12 }, { 12,  -5, -12 }, { 12,   5,  13 }, { 12,   5, -13 }, { 12,  -5,  13 }, { 12,  -5, -13 },
+    /* 3744 */ { 12,  14,   4 }, { 12,  14,  -4 }, { 12, -14,   4 }, { 12, -14,  -4 }, { 12,   4,  14 }, { 12,   4, -14 }, { 12,  -4,  14 }, { 12,  -4, -14 },
+    /* 3752 */ { 12,  11,   7 }, { 12,  11,  -7 }, { 12, -11,   7 }, { 12, -11,  -7 }, { 12,  14,   3 }, { 12,  14,  -3 }, { 12, -14,   3 }, { 12, -14,  -3 },
+    /* 3760 */ { 12,  12,   5 }, { 12,  12,  -5 }, { 12, -12,   5 }, { 12, -12,  -5 }, { 12,  13,   6 }, { 12,  13,  -6 }, { 12, -13,   6 }, { 12, -13,  -6 },
+    /* 3768 */ { 12,  12,   6 }, { 12,  12,  -6 }, { 12, -12,   6 }, { 12, -12,  -6 }, { 11,   8,   0 }, { 11,   8,   0 }, { 11,  -8,   0 }, { 11,  -8,   0 },
+    /* 3776 */ { 12,  11,   8 }, { 12,  11,  -8 }, { 12, -11,   8 }, { 12, -11,  -8 }, { 12,   2,  12 }, { 12,   2, -12 }, { 12,  -2,  12 }, { 12,  -2, -12 },
+    /* 3784 */ { 12,   9,   9 }, { 12,   9,  -9 }, { 12,  -9,   9 }, { 12,  -9,  -9 }, { 12,  14,   5 }, { 12,  14,  -5 }, { 12, -14,   5 }, { 12, -14,  -5 },
+    /* 3792 */ { 12,   6,  13 }, { 12,   6, -13 }, { 12,  -6,  13 }, { 12,  -6, -13 }, { 12,  10,  10 }, { 12,  10, -10 }, { 12, -10,  10 }, { 12, -10, -10 },
+    /* 3800 */ { 12,  15,   2 }, { 12,  15,  -2 }, { 12, -15,   2 }, { 12, -15,  -2 }, { 12,   8,  11 }, { 12,   8, -11 }, { 12,  -8,  11 }, { 12,  -8, -11 },
+    /* 3808 */ { 12,   9,  10 }, { 12,   9, -10 }, { 12,  -9,  10 }, { 12,  -9, -10 }, { 12,  14,   6 }, { 12,  14,  -6 }, { 12, -14,   6 }, { 12, -14,  -6 },
+    /* 3816 */ { 12,  10,   9 }, { 12,  10,  -9 }, { 12, -10,   9 }, { 12, -10,  -9 }, { 12,   5,  14 }, { 12,   5, -14 }, { 12,  -5,  14 }, { 12,  -5, -14 },
+    /* 3824 */ { 12,  11,   9 }, { 12,  11,  -9 }, { 12, -11,   9 }, { 12, -11,  -9 }, { 12,  14,   1 }, { 12,  14,  -1 }, { 12, -14,   1 }, { 12, -14,  -1 },
+    /* 3832 */ { 12,   2,  14 }, { 12,   2, -14 }, { 12,  -2,  14 }, { 12,  -2, -14 }, { 12,   6,  12 }, { 12,   6, -12 }, { 12,  -6,  12 }, { 12,  -6, -12 },
+    /* 3840 */ { 12,   1,  12 }, { 12,   1, -12 }, { 12,  -1,  12 }, { 12,  -1, -12 }, { 12,  13,   8 }, { 12,  13,  -8 }, { 12, -13,   8 }, { 12, -13,  -8 },
+    /* 3848 */ { 11,   0,   8 }, { 11,   0,   8 }, { 11,   0,  -8 }, { 11,   0,  -8 }, { 12,  13,   7 }, { 12,  13,  -7 }, { 12, -13,   7 }, { 12, -13,  -7 },
+    /* 3856 */ { 12,   7,  12 }, { 12,   7, -12 }, { 12,  -7,  12 }, { 12,  -7, -12 }, { 12,  12,   7 }, { 12,  12,  -7 }, { 12, -12,   7 }, { 12, -12,  -7 },
+    /* 3864 */ { 12,   7,  13 }, { 12,   7, -13 }, { 12,  -7,  13 }, { 12,  -7, -13 }, { 12,  15,   3 }, { 12,  15,  -3 }, { 12, -15,   3 }, { 12, -15,  -3 },
+    /* 3872 */ { 12,  12,   1 }, { 12,  12,  -1 }, { 12, -12,   1 }, { 12, -12,  -1 }, { 12,   6,  14 }, { 12,   6, -14 }, { 12,  -6,  14 }, { 12,  -6, -14 },
+    /* 3880 */ { 12,   2,  15 }, { 12,   2, -15 }, { 12,  -2,  15 }, { 12,  -2, -15 }, { 12,  15,   5 }, { 12,  15,  -5 }, { 12, -15,   5 }, { 12, -15,  -5 },
+    /* 3888 */ { 12,  15,   4 }, { 12,  15,  -4 }, { 12, -15,   4 }, { 12, -15,  -4 }, { 12,   1,  14 }, { 12,   1, -14 }, { 12,  -1,  14 }, { 12,  -1, -14 },
+    /* 3896 */ { 12,   9,  11 }, { 12,   9, -11 }, { 12,  -9,  11 }, { 12,  -9, -11 }, { 12,   4,  15 }, { 12,   4, -15 }, { 12,  -4,  15 }, { 12,  -4, -15 },
+    /* 3904 */ { 12,  14,   7 }, { 12,  14,  -7 }, { 12, -14,   7 }, { 12, -14,  -7 }, { 12,   8,  13 }, { 12,   8, -13 }, { 12,  -8,  13 }, { 12,  -8, -13 },
+    /* 3912 */ { 12,  13,   9 }, { 12,  13,  -9 }, { 12, -13,   9 }, { 12, -13,  -9 }, { 12,   8,  12 }, { 12,   8, -12 }, { 12,  -8,  12 }, { 12,  -8, -12 },
+    /* 3920 */ { 12,   5,  15 }, { 12,   5, -15 }, { 12,  -5,  15 }, { 12,  -5, -15 }, { 12,   3,  15 }, { 12,   3, -15 }, { 12,  -3,  15 }, { 12,  -3, -15 },
+    /* 3928 */ { 12,  10,  11 }, { 12,  10, -11 }, { 12, -10,  11 }, { 12, -10, -11 }, { 12,  11,  10 }, { 12,  11, -10 }, { 12, -11,  10 }, { 12, -11, -10 },
+    /* 3936 */ { 12,  12,   8 }, { 12,  12,  -8 }, { 12, -12,   8 }, { 12, -12,  -8 }, { 12,  15,   6 }, { 12,  15,  -6 }, { 12, -15,   6 }, { 12, -15,  -6 },
+    /* 3944 */ { 12,  15,   7 }, { 12,  15,  -7 }, { 12, -15,   7 }, { 12, -15,  -7 }, { 12,   8,  14 }, { 12,   8, -14 }, { 12,  -8,  14 }, { 12,  -8, -14 },
+    /* 3952 */ { 12,  15,   1 }, { 12,  15,  -1 }, { 12, -15,   1 }, { 12, -15,  -1 }, { 12,   7,  14 }, { 12,   7, -14 }, { 12,  -7,  14 }, { 12,  -7, -14 },
+    /* 3960 */ { 11,   9,   0 }, { 11,   9,   0 }, { 11,  -9,   0 }, { 11,  -9,   0 }, { 11,   0,   9 }, { 11,   0,   9 }, { 11,   0,  -9 }, { 11,   0,  -9 },
+    /* 3968 */ { 12,   9,  13 }, { 12,   9, -13 }, { 12,  -9,  13 }, { 12,  -9, -13 }, { 12,   9,  12 }, { 12,   9, -12 }, { 12,  -9,  12 }, { 12,  -9, -12 },
+    /* 3976 */ { 12,  12,   9 }, { 12,  12,  -9 }, { 12, -12,   9 }, { 12, -12,  -9 }, { 12,  14,   8 }, { 12,  14,  -8 }, { 12, -14,   8 }, { 12, -14,  -8 },
+    /* 3984 */ { 12,  10,  13 }, { 12,  10, -13 }, { 12, -10,  13 }, { 12, -10, -13 }, { 12,  14,   9 }, { 12,  14,  -9 }, { 12, -14,   9 }, { 12, -14,  -9 },
+    /* 3992 */ { 12,  12,  10 }, { 12,  12, -10 }, { 12, -12,  10 }, { 12, -12, -10 }, { 12,   6,  15 }, { 12,   6, -15 }, { 12,  -6,  15 }, { 12,  -6, -15 },
+    /* 4000 */ { 12,   7,  15 }, { 12,   7, -15 }, { 12,  -7,  15 }, { 12,  -7, -15 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 4008 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 4016 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 4024 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 4032 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, { 12,  10,   0 }, { 12, -10,   0 },
+    /* 4040 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, { 12,   0,  10 }, { 12,   0, -10 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 4048 */ { 12,  11,   0 }, { 12, -11,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 4056 */ { 12,   0,  13 }, { 12,   0, -13 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 4064 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, { 12,  13,   0 }, { 12, -13,   0 }, { 12,   0,  11 }, { 12,   0, -11 },
+    /* 4072 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 },
+    /* 4080 */ { 12,  14,   0 }, { 12, -14,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, { 12,  12,   0 }, { 12, -12,   0 },
+    /* 4088 */ {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }, {  0,   0,   0 }
+};
+
@@ -134,6 +134,17 @@ extern "C" {
 # endif
 #endif // FIXED_POINT
 
+/* Use SSE2 (x86) or NEON (ARM) for the hot loops when the compiler
+   targets them. Define NO_SIMD to get the plain C versions only */
+//#define NO_SIMD
+#if !defined(NO_SIMD) && !defined(FIXED_POINT) && !defined(USE_DOUBLE_PRECISION)
+# if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define SSE2_DEC
+# elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  define NEON_DEC
+# endif
+#endif
+
 #ifdef DRM
 # ifndef ALLOW_SMALL_FRAMELENGTH
 #  define ALLOW_SMALL_FRAMELENGTH
@@ -44,6 +44,9 @@
 #include "kbd_win.h"
 #include "sine_win.h"
 #include "mdct.h"
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+#include "simd.h"
+#endif
 
 
 fb_info *filter_bank_init(uint16_t frame_len)
@@ -110,27 +113,91 @@ void filter_bank_end(fb_info *fb)
     }
 }
 
-static INLINE void imdct_long(fb_info *fb, real_t *in_data, real_t *out_data, uint16_t len)
+static INLINE mdct_info *mdct_long(fb_info *fb, uint16_t len)
 {
 #ifdef LD_DEC
-    mdct_info *mdct = NULL;
-
     switch (len)
     {
-    case 2048:
-    case 1920:
-        mdct = fb->mdct2048;
-        break;
     case 1024:
     case 960:
-        mdct = fb->mdct1024;
-        break;
+        return fb->mdct1024;
     }
+#endif
+    return fb->mdct2048;
+}
 
-    faad_imdct(mdct, in_data, out_data);
-#else
-    faad_imdct(fb->mdct2048, in_data, out_data);
+static INLINE void imdct_long(fb_info *fb, real_t *in_data, real_t *out_data, uint16_t len)
+{
+    faad_imdct(mdct_long(fb, len), in_data, out_data);
+}
+
+/* windowing and overlap-add kernels, vectorised where there is SIMD. A
+   window given as w_rev is read backwards, w_rev[0], w_rev[-1] and on */
+
+/* out[i] = add[i] + x[i]*w[i], or add[i] + x[i] without w */
+static INLINE void window_add(real_t *out, const real_t *add, const real_t *x,
+                              const real_t *w, uint16_t n)
+{
+    uint16_t i = 0;
+
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+    if (w != NULL)
+    {
+        for (; i + 4 <= n; i += 4)
+            vec_store(out + i, vec_add(vec_load(add + i), vec_mul(vec_load(x + i), vec_load(w + i))));
+    } else {
+        for (; i + 4 <= n; i += 4)
+            vec_store(out + i, vec_add(vec_load(add + i), vec_load(x + i)));
+    }
 #endif
+    if (w != NULL)
+    {
+        for (; i < n; i++)
+            out[i] = add[i] + MUL_F(x[i], w[i]);
+    } else {
+        for (; i < n; i++)
+            out[i] = add[i] + x[i];
+    }
+}
+
+/* out[i] = x[i]*w_rev[-i], out may be x */
+static INLINE void window_rev(real_t *out, const real_t *x, const real_t *w_rev, uint16_t n)
+{
+    uint16_t i = 0;
+
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+    for (; i + 4 <= n; i += 4)
+        vec_store(out + i, vec_mul(vec_load(x + i), vec_reverse(vec_load(w_rev - i - 3))));
+#endif
+    for (; i < n; i++)
+        out[i] = MUL_F(x[i], w_rev[-i]);
+}
+
+/* the overlapping short blocks, out[i] = add[i] + x1[i]*w_rev[-i] + x2[i]*w[i],
+   without add[i] if add is NULL */
+static INLINE void window_add2(real_t *out, const real_t *add, const real_t *x1, const real_t *x2,
+                               const real_t *w, const real_t *w_rev, uint16_t n)
+{
+    uint16_t i = 0;
+
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+    for (; i + 4 <= n; i += 4)
+    {
+        vec4_t a = vec_mul(vec_load(x1 + i), vec_reverse(vec_load(w_rev - i - 3)));
+        vec4_t b = vec_mul(vec_load(x2 + i), vec_load(w + i));
+
+        if (add != NULL)
+            a = vec_add(vec_load(add + i), a);
+        vec_store(out + i, vec_add(a, b));
+    }
+#endif
+    for (; i < n; i++)
+    {
+        if (add != NULL)
+            out[i] = add[i] + MUL_F(x1[i], w_rev[-i]) + MUL_F(x2[i], w[i]);
+        else
+            out[i] = MUL_F(x1[i], w_rev[-i]) + MUL_F(x2[i], w[i]);
+    }
 }
 
 
@@ -167,7 +234,9 @@ void ifilter_bank(fb_info *fb, uint8_t window_sequence, uint8_t window_shape,
                   uint8_t object_type, uint16_t frame_len)
 {
     int16_t i;
-    ALIGN real_t transf_buf[2*1024] = {0};
+    /* only the short and the stop windows use it, and they write all of
+       what they read, so it is not cleared */
+    ALIGN real_t transf_buf[2*1024];
 
     const real_t *window_long = NULL;
     const real_t *window_long_prev = NULL;
@@ -214,49 +283,23 @@ void ifilter_bank(fb_info *fb, uint8_t window_sequence, uint8_t window_shape,
     switch (window_sequence)
     {
     case ONLY_LONG_SEQUENCE:
-        /* perform iMDCT */
-        imdct_long(fb, freq_in, transf_buf, 2*nlong);
-
-        /* add second half output of previous frame to windowed output of current frame */
-        for (i = 0; i < nlong; i+=4)
-        {
-            time_out[i]   = overlap[i]   + MUL_F(transf_buf[i],window_long_prev[i]);
-            time_out[i+1] = overlap[i+1] + MUL_F(transf_buf[i+1],window_long_prev[i+1]);
-            time_out[i+2] = overlap[i+2] + MUL_F(transf_buf[i+2],window_long_prev[i+2]);
-            time_out[i+3] = overlap[i+3] + MUL_F(transf_buf[i+3],window_long_prev[i+3]);
-        }
-
-        /* window the second half and save as overlap for next frame */
-        for (i = 0; i < nlong; i+=4)
-        {
-            overlap[i]   = MUL_F(transf_buf[nlong+i],window_long[nlong-1-i]);
-            overlap[i+1] = MUL_F(transf_buf[nlong+i+1],window_long[nlong-2-i]);
-            overlap[i+2] = MUL_F(transf_buf[nlong+i+2],window_long[nlong-3-i]);
-            overlap[i+3] = MUL_F(transf_buf[nlong+i+3],window_long[nlong-4-i]);
-        }
+        /* perform iMDCT, add second half output of previous frame to windowed
+           output of current frame and window the second half and save as
+           overlap for next frame */
+        faad_imdct_ola(mdct_long(fb, 2*nlong), freq_in, window_long_prev, window_long,
+            overlap, time_out);
         break;
 
     case LONG_START_SEQUENCE:
-        /* perform iMDCT */
-        imdct_long(fb, freq_in, transf_buf, 2*nlong);
-
-        /* add second half output of previous frame to windowed output of current frame */
-        for (i = 0; i < nlong; i+=4)
-        {
-            time_out[i]   = overlap[i]   + MUL_F(transf_buf[i],window_long_prev[i]);
-            time_out[i+1] = overlap[i+1] + MUL_F(transf_buf[i+1],window_long_prev[i+1]);
-            time_out[i+2] = overlap[i+2] + MUL_F(transf_buf[i+2],window_long_prev[i+2]);
-            time_out[i+3] = overlap[i+3] + MUL_F(transf_buf[i+3],window_long_prev[i+3]);
-        }
+        /* perform iMDCT, add second half output of previous frame to windowed
+           output of current frame and save the second half as overlap */
+        faad_imdct_ola(mdct_long(fb, 2*nlong), freq_in, window_long_prev, NULL,
+            overlap, time_out);
 
-        /* window the second half and save as overlap for next frame */
+        /* window the second half of the overlap */
         /* construct second half window using padding with 1's and 0's */
-        for (i = 0; i < nflat_ls; i++)
-            overlap[i] = transf_buf[nlong+i];
-        for (i = 0; i < nshort; i++)
-            overlap[nflat_ls+i] = MUL_F(transf_buf[nlong+nflat_ls+i],window_short[nshort-i-1]);
-        for (i = 0; i < nflat_ls; i++)
-            overlap[nflat_ls+nshort+i] = 0;
+        window_rev(overlap+nflat_ls, overlap+nflat_ls, window_short+nshort-1, nshort);
+        memset(overlap+nflat_ls+nshort, 0, nflat_ls*sizeof(real_t));
         break;
 
     case EIGHT_SHORT_SEQUENCE:
@@ -271,30 +314,30 @@ void ifilter_bank(fb_info *fb, uint8_t window_sequence, uint8_t window_shape,
         faad_imdct(fb->mdct256, freq_in+7*nshort, transf_buf+2*nshort*7);
 
         /* add second half output of previous frame to windowed output of current frame */
-        for (i = 0; i < nflat_ls; i++)
-            time_out[i] = overlap[i];
-        for(i = 0; i < nshort; i++)
+        memcpy(time_out, overlap, nflat_ls*sizeof(real_t));
+        window_add(time_out+nflat_ls, overlap+nflat_ls, transf_buf, window_short_prev, nshort);
+        for (i = 1; i < 4; i++)
         {
-            time_out[nflat_ls+         i] = overlap[nflat_ls+         i] + MUL_F(transf_buf[nshort*0+i],window_short_prev[i]);
-            time_out[nflat_ls+1*nshort+i] = overlap[nflat_ls+nshort*1+i] + MUL_F(transf_buf[nshort*1+i],window_short[nshort-1-i]) + MUL_F(transf_buf[nshort*2+i],window_short[i]);
-            time_out[nflat_ls+2*nshort+i] = overlap[nflat_ls+nshort*2+i] + MUL_F(transf_buf[nshort*3+i],window_short[nshort-1-i]) + MUL_F(transf_buf[nshort*4+i],window_short[i]);
-            time_out[nflat_ls+3*nshort+i] = overlap[nflat_ls+nshort*3+i] + MUL_F(transf_buf[nshort*5+i],window_short[nshort-1-i]) + MUL_F(transf_buf[nshort*6+i],window_short[i]);
-            if (i < trans)
-                time_out[nflat_ls+4*nshort+i] = overlap[nflat_ls+nshort*4+i] + MUL_F(transf_buf[nshort*7+i],window_short[nshort-1-i]) + MUL_F(transf_buf[nshort*8+i],window_short[i]);
+            window_add2(time_out+nflat_ls+i*nshort, overlap+nflat_ls+i*nshort,
+                transf_buf+nshort*(2*i-1), transf_buf+nshort*2*i,
+                window_short, window_short+nshort-1, nshort);
         }
+        window_add2(time_out+nflat_ls+4*nshort, overlap+nflat_ls+4*nshort,
+            transf_buf+nshort*7, transf_buf+nshort*8,
+            window_short, window_short+nshort-1, trans);
 
         /* window the second half and save as overlap for next frame */
-        for(i = 0; i < nshort; i++)
+        window_add2(overlap+nflat_ls+4*nshort+trans-nlong, NULL,
+            transf_buf+nshort*7+trans, transf_buf+nshort*8+trans,
+            window_short+trans, window_short+nshort-1-trans, nshort-trans);
+        for (i = 5; i < 8; i++)
         {
-            if (i >= trans)
-                overlap[nflat_ls+4*nshort+i-nlong] = MUL_F(transf_buf[nshort*7+i],window_short[nshort-1-i]) + MUL_F(transf_buf[nshort*8+i],window_short[i]);
-            overlap[nflat_ls+5*nshort+i-nlong] = MUL_F(transf_buf[nshort*9+i],window_short[nshort-1-i]) + MUL_F(transf_buf[nshort*10+i],window_short[i]);
-            overlap[nflat_ls+6*nshort+i-nlong] = MUL_F(transf_buf[nshort*11+i],window_short[nshort-1-i]) + MUL_F(transf_buf[nshort*12+i],window_short[i]);
-            overlap[nflat_ls+7*nshort+i-nlong] = MUL_F(transf_buf[nshort*13+i],window_short[nshort-1-i]) + MUL_F(transf_buf[nshort*14+i],window_short[i]);
-            overlap[nflat_ls+8*nshort+i-nlong] = MUL_F(transf_buf[nshort*15+i],window_short[nshort-1-i]);
+            window_add2(overlap+nflat_ls+i*nshort-nlong, NULL,
+                transf_buf+nshort*(2*i-1), transf_buf+nshort*2*i,
+                window_short, window_short+nshort-1, nshort);
         }
-        for (i = 0; i < nflat_ls; i++)
-            overlap[nflat_ls+nshort+i] = 0;
+        window_rev(overlap+nflat_ls+8*nshort-nlong, transf_buf+nshort*15, window_short+nshort-1, nshort);
+        memset(overlap+nflat_ls+nshort, 0, nflat_ls*sizeof(real_t));
         break;
 
     case LONG_STOP_SEQUENCE:
@@ -303,16 +346,12 @@ void ifilter_bank(fb_info *fb, uint8_t window_sequence, uint8_t window_shape,
 
         /* add second half output of previous frame to windowed output of current frame */
         /* construct first half window using padding with 1's and 0's */
-        for (i = 0; i < nflat_ls; i++)
-            time_out[i] = overlap[i];
-        for (i = 0; i < nshort; i++)
-            time_out[nflat_ls+i] = overlap[nflat_ls+i] + MUL_F(transf_buf[nflat_ls+i],window_short_prev[i]);
-        for (i = 0; i < nflat_ls; i++)
-            time_out[nflat_ls+nshort+i] = overlap[nflat_ls+nshort+i] + transf_buf[nflat_ls+nshort+i];
+        memcpy(time_out, overlap, nflat_ls*sizeof(real_t));
+        window_add(time_out+nflat_ls, overlap+nflat_ls, transf_buf+nflat_ls, window_short_prev, nshort);
+        window_add(time_out+nflat_ls+nshort, overlap+nflat_ls+nshort, transf_buf+nflat_ls+nshort, NULL, nflat_ls);
 
         /* window the second half and save as overlap for next frame */
-        for (i = 0; i < nlong; i++)
-            overlap[i] = MUL_F(transf_buf[nlong+i],window_long[nlong-1-i]);
+        window_rev(overlap, transf_buf+nlong, window_long+nlong-1, nlong);
 		break;
     }
 
@@ -52,6 +52,8 @@ static uint8_t huffman_binary_quad(uint8_t cb, bitfile *ld, int16_t *sp);
 static uint8_t huffman_binary_quad_sign(uint8_t cb, bitfile *ld, int16_t *sp);
 static uint8_t huffman_binary_pair(uint8_t cb, bitfile *ld, int16_t *sp);
 static uint8_t huffman_binary_pair_sign(uint8_t cb, bitfile *ld, int16_t *sp);
+static INLINE uint8_t huffman_fast_quad(uint8_t cb, bitfile *ld, int16_t *sp);
+static INLINE uint8_t huffman_fast_pair(uint8_t cb, bitfile *ld, int16_t *sp);
 static int16_t huffman_codebook(uint8_t i);
 static void vcb11_check_LAV(uint8_t cb, int16_t *sp);
 
@@ -104,6 +106,16 @@ int hcb_2_quad_table_size[] = { 0, 114, 86, 0, 185, 0, 0, 0, 0, 0, 0, 0 };
 int hcb_2_pair_table_size[] = { 0, 0, 0, 0, 0, 0, 126, 0, 83, 0, 210, 373 };
 int hcb_bin_table_size[] = { 0, 0, 0, 161, 0, 161, 0, 127, 0, 337, 0, 0 };
 
+hcb_2_quad *hcb_fast_quad_table[] = {
+    0, hcb1_fast, hcb2_fast, hcb3_fast, hcb4_fast, 0, 0, 0, 0, 0, 0, 0
+};
+
+hcb_2_pair *hcb_fast_pair_table[] = {
+    0, 0, 0, 0, 0, hcb5_fast, hcb6_fast, hcb7_fast, hcb8_fast, hcb9_fast, hcb10_fast, hcb11_fast
+};
+
+uint8_t hcb_fast_bits[] = { 0, 9, 9, 11, 11, 9, 9, 10, 10, 11, 11, 12 };
+
 static INLINE void huffman_sign_bits(bitfile *ld, int16_t *sp, uint8_t len)
 {
     uint8_t i;
@@ -307,6 +319,40 @@ static uint8_t huffman_binary_pair_sign(uint8_t cb, bitfile *ld, int16_t *sp)
     return err;
 }
 
+/* the codeword and its sign bits in one lookup, returns 0 without reading
+   anything if they are longer than the table */
+static INLINE uint8_t huffman_fast_quad(uint8_t cb, bitfile *ld, int16_t *sp)
+{
+    hcb_2_quad *e = &hcb_fast_quad_table[cb][faad_showbits(ld, hcb_fast_bits[cb])];
+
+    if (!e->bits)
+        return 0;
+
+    faad_flushbits(ld, e->bits);
+
+    sp[0] = e->x;
+    sp[1] = e->y;
+    sp[2] = e->v;
+    sp[3] = e->w;
+
+    return 1;
+}
+
+static INLINE uint8_t huffman_fast_pair(uint8_t cb, bitfile *ld, int16_t *sp)
+{
+    hcb_2_pair *e = &hcb_fast_pair_table[cb][faad_showbits(ld, hcb_fast_bits[cb])];
+
+    if (!e->bits)
+        return 0;
+
+    faad_flushbits(ld, e->bits);
+
+    sp[0] = e->x;
+    sp[1] = e->y;
+
+    return 1;
+}
+
 static int16_t huffman_codebook(uint8_t i)
 {
     static const uint32_t data = 16428320;
@@ -336,24 +382,40 @@ static void vcb11_check_LAV(uint8_t cb, int16_t *sp)
 
 uint8_t huffman_spectral_data(uint8_t cb, bitfile *ld, int16_t *sp)
 {
+    /* most codewords are short enough for the single lookup tables, the
+       rest go through the 2-step or binary search tables */
     switch (cb)
     {
     case 1: /* 2-step method for data quadruples */
     case 2:
+        if (huffman_fast_quad(cb, ld, sp))
+            return 0;
         return huffman_2step_quad(cb, ld, sp);
     case 3: /* binary search for data quadruples */
+        if (huffman_fast_quad(cb, ld, sp))
+            return 0;
         return huffman_binary_quad_sign(cb, ld, sp);
     case 4: /* 2-step method for data quadruples */
+        if (huffman_fast_quad(cb, ld, sp))
+            return 0;
         return huffman_2step_quad_sign(cb, ld, sp);
     case 5: /* binary search for data pairs */
+        if (huffman_fast_pair(cb, ld, sp))
+            return 0;
         return huffman_binary_pair(cb, ld, sp);
     case 6: /* 2-step method for data pairs */
+        if (huffman_fast_pair(cb, ld, sp))
+            return 0;
         return huffman_2step_pair(cb, ld, sp);
     case 7: /* binary search for data pairs */
     case 9:
+        if (huffman_fast_pair(cb, ld, sp))
+            return 0;
         return huffman_binary_pair_sign(cb, ld, sp);
     case 8: /* 2-step method for data pairs */
     case 10:
+        if (huffman_fast_pair(cb, ld, sp))
+            return 0;
         return huffman_2step_pair_sign(cb, ld, sp);
     case 12: {
         uint8_t err = huffman_2step_pair(11, ld, sp);
@@ -361,7 +423,9 @@ uint8_t huffman_spectral_data(uint8_t cb, bitfile *ld, int16_t *sp)
         return err; }
     case 11:
     {
-        uint8_t err = huffman_2step_pair_sign(11, ld, sp);
+        uint8_t err = 0;
+        if (!huffman_fast_pair(11, ld, sp))
+            err = huffman_2step_pair_sign(11, ld, sp);
         sp[0] = huffman_getescape(ld, sp[0]);
         sp[1] = huffman_getescape(ld, sp[1]);
         return err;
@@ -371,7 +435,9 @@ uint8_t huffman_spectral_data(uint8_t cb, bitfile *ld, int16_t *sp)
     case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23:
     case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
     {
-        uint8_t err = huffman_2step_pair_sign(11, ld, sp);
+        uint8_t err = 0;
+        if (!huffman_fast_pair(11, ld, sp))
+            err = huffman_2step_pair_sign(11, ld, sp);
         sp[0] = huffman_getescape(ld, sp[0]);
         sp[1] = huffman_getescape(ld, sp[1]);
 
@@ -57,6 +57,9 @@
 #include "cfft.h"
 #include "mdct.h"
 #include "mdct_tab.h"
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+#include "simd.h"
+#endif
 
 
 mdct_info *faad_mdct_init(uint16_t N)
@@ -95,6 +98,11 @@ mdct_info *faad_mdct_init(uint16_t N)
 
     /* initialise fft */
     mdct->cfft = cffti(N/4);
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+    mdct->simd = (N % 64 == 0);
+#else
+    mdct->simd = 0;
+#endif
 
 #ifdef PROFILE
     mdct->cycles = 0;
@@ -119,6 +127,115 @@ void faad_mdct_end(mdct_info *mdct)
     }
 }
 
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+/* SIMD versions of the pre- and post-IFFT multiplications and the
+   reordering. The pre-twiddle takes four k at a time, the imaginary parts
+   are the even X_in from the front and the real parts the odd ones from
+   the back. The reordering is done for k and N8-1-k together: between
+   them they use Z1[k], Z1[N8-1-k], Z1[N8+k] and Z1[N4-1-k] for all four
+   quarters of the output, so every Z1 value is post-twiddled once and
+   written out right away. Needs N to be a multiple of 64 */
+
+static void imdct_pre_simd(mdct_info *mdct, real_t *X_in, complex_t *Z1)
+{
+    uint16_t k;
+    uint16_t N2 = mdct->N >> 1;
+    uint16_t N4 = mdct->N >> 2;
+    const real_t *sincos = (const real_t*)mdct->sincos;
+    real_t *z = (real_t*)Z1;
+
+    for (k = 0; k < N4; k += 4)
+    {
+        vec4_t im = vec_re(vec_load(X_in + 2*k), vec_load(X_in + 2*k + 4));
+        vec4_t re = vec_reverse(vec_im(vec_load(X_in + N2 - 8 - 2*k), vec_load(X_in + N2 - 4 - 2*k)));
+
+        vec_store(z + 2*k,     vec_cmul(vec_zip_lo(re, im), vec_load(sincos + 2*k)));
+        vec_store(z + 2*k + 4, vec_cmul(vec_zip_hi(re, im), vec_load(sincos + 2*k + 4)));
+    }
+}
+
+/* post-twiddles Z1[k] to Z1[k+3], split in real and imaginary parts */
+static INLINE void imdct_post4(const complex_t *Z1, const complex_t *sincos, uint16_t k,
+                               vec4_t *re, vec4_t *im)
+{
+    vec4_t a = vec_cmul(vec_load(&RE(Z1[k])),     vec_load(&RE(sincos[k])));
+    vec4_t b = vec_cmul(vec_load(&RE(Z1[k + 2])), vec_load(&RE(sincos[k + 2])));
+
+    *re = vec_re(a, b);
+    *im = vec_im(a, b);
+}
+
+/* the eight outputs from p on in each half, even and odd ones apart.
+   Without window the halves go to X_out, with it the first half is
+   windowed and added to overlap into time_out and the second half,
+   windowed backwards with window_next if there is one, replaces overlap */
+typedef struct
+{
+    real_t *X_out;
+    const real_t *window;
+    const real_t *window_next;
+    real_t *overlap;
+    real_t *time_out;
+    uint16_t N2;
+} imdct_out;
+
+static INLINE void imdct_store8(const imdct_out *out, uint16_t p,
+                                vec4_t even1, vec4_t odd1, vec4_t even2, vec4_t odd2)
+{
+    vec4_t x0 = vec_zip_lo(even1, odd1);
+    vec4_t x1 = vec_zip_hi(even1, odd1);
+    vec4_t y0 = vec_zip_lo(even2, odd2);
+    vec4_t y1 = vec_zip_hi(even2, odd2);
+
+    if (out->window == NULL)
+    {
+        vec_store(out->X_out + p,     x0);
+        vec_store(out->X_out + p + 4, x1);
+        vec_store(out->X_out + out->N2 + p,     y0);
+        vec_store(out->X_out + out->N2 + p + 4, y1);
+        return;
+    }
+
+    vec_store(out->time_out + p,     vec_add(vec_load(out->overlap + p),     vec_mul(x0, vec_load(out->window + p))));
+    vec_store(out->time_out + p + 4, vec_add(vec_load(out->overlap + p + 4), vec_mul(x1, vec_load(out->window + p + 4))));
+    if (out->window_next != NULL)
+    {
+        y0 = vec_mul(y0, vec_reverse(vec_load(out->window_next + out->N2 - 4 - p)));
+        y1 = vec_mul(y1, vec_reverse(vec_load(out->window_next + out->N2 - 8 - p)));
+    }
+    vec_store(out->overlap + p,     y0);
+    vec_store(out->overlap + p + 4, y1);
+}
+
+static void imdct_post_simd(mdct_info *mdct, complex_t *Z1, const imdct_out *out)
+{
+    uint16_t k;
+    complex_t *sincos = mdct->sincos;
+    uint16_t N4 = mdct->N >> 2;
+    uint16_t N8 = mdct->N >> 3;
+
+    for (k = 0; k < N8/2; k += 4)
+    {
+        /* A = Z1[N8+k..], B = Z1[N8-4-k..], C = Z1[k..], D = Z1[N4-4-k..] */
+        vec4_t a_re, a_im, b_re, b_im, c_re, c_im, d_re, d_im;
+
+        imdct_post4(Z1, sincos, N8 + k,     &a_re, &a_im);
+        imdct_post4(Z1, sincos, N8 - 4 - k, &b_re, &b_im);
+        imdct_post4(Z1, sincos, k,          &c_re, &c_im);
+        imdct_post4(Z1, sincos, N4 - 4 - k, &d_re, &d_im);
+
+        imdct_store8(out, 2*k,
+            a_im, vec_neg(vec_reverse(b_re)), a_re, vec_neg(vec_reverse(b_im)));
+        imdct_store8(out, N4 + 2*k,
+            c_re, vec_neg(vec_reverse(d_im)), vec_neg(c_im), vec_reverse(d_re));
+        imdct_store8(out, 2*(N8 - 4 - k),
+            d_im, vec_neg(vec_reverse(c_re)), d_re, vec_neg(vec_reverse(c_im)));
+        imdct_store8(out, N4 + 2*(N8 - 4 - k),
+            b_re, vec_neg(vec_reverse(a_im)), vec_neg(b_im), vec_reverse(a_re));
+    }
+}
+#endif
+
 void faad_imdct(mdct_info *mdct, real_t *X_in, real_t *X_out)
 {
     uint16_t k;
@@ -154,6 +271,29 @@ void faad_imdct(mdct_info *mdct, real_t *X_in, real_t *X_out)
 #endif
 #endif
 
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+    if (mdct->simd)
+    {
+        imdct_out out = { X_out, NULL, NULL, NULL, NULL, N2 };
+
+        imdct_pre_simd(mdct, X_in, Z1);
+#ifdef PROFILE
+        count1 = faad_get_ts();
+#endif
+        cfftb(mdct->cfft, Z1);
+#ifdef PROFILE
+        count1 = faad_get_ts() - count1;
+#endif
+        imdct_post_simd(mdct, Z1, &out);
+#ifdef PROFILE
+        count2 = faad_get_ts() - count2;
+        mdct->fft_cycles += count1;
+        mdct->cycles += (count2 - count1);
+#endif
+        return;
+    }
+#endif
+
     /* pre-IFFT complex multiplication */
     for (k = 0; k < N4; k++)
     {
@@ -227,6 +367,63 @@ void faad_imdct(mdct_info *mdct, real_t *X_in, real_t *X_out)
 #endif
 }
 
+/* faad_imdct followed by the windowing and overlap-add of a long block:
+   time_out[i] = overlap[i] + X_out[i]*window[i] and
+   overlap[i] = X_out[N/2+i]*window_next[N/2-1-i], or just X_out[N/2+i]
+   without window_next. With SIMD this is fused into the post-IFFT
+   multiplication so the output is written once, straight to where it goes */
+void faad_imdct_ola(mdct_info *mdct, real_t *X_in, const real_t *window,
+                    const real_t *window_next, real_t *overlap, real_t *time_out)
+{
+    uint16_t k;
+    uint16_t N2 = mdct->N >> 1;
+
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+    if (mdct->simd)
+    {
+        ALIGN complex_t Z1[512];
+        imdct_out out = { NULL, window, window_next, overlap, time_out, N2 };
+#ifdef PROFILE
+        int64_t count1, count2 = faad_get_ts();
+#endif
+
+        imdct_pre_simd(mdct, X_in, Z1);
+#ifdef PROFILE
+        count1 = faad_get_ts();
+#endif
+        cfftb(mdct->cfft, Z1);
+#ifdef PROFILE
+        count1 = faad_get_ts() - count1;
+#endif
+        imdct_post_simd(mdct, Z1, &out);
+#ifdef PROFILE
+        count2 = faad_get_ts() - count2;
+        mdct->fft_cycles += count1;
+        mdct->cycles += (count2 - count1);
+#endif
+        return;
+    }
+#endif
+
+    /* only the scalar path needs the whole IMDCT output on the stack */
+    {
+        ALIGN real_t X_out[2048];
+
+        faad_imdct(mdct, X_in, X_out);
+
+        for (k = 0; k < N2; k++)
+            time_out[k] = overlap[k] + MUL_F(X_out[k], window[k]);
+        if (window_next != NULL)
+        {
+            for (k = 0; k < N2; k++)
+                overlap[k] = MUL_F(X_out[N2+k], window_next[N2-1-k]);
+        } else {
+            for (k = 0; k < N2; k++)
+                overlap[k] = X_out[N2+k];
+        }
+    }
+}
+
 #ifdef LTP_DEC
 void faad_mdct(mdct_info *mdct, real_t *X_in, real_t *X_out)
 {
@@ -39,6 +39,8 @@ extern "C" {
 mdct_info *faad_mdct_init(uint16_t N);
 void faad_mdct_end(mdct_info *mdct);
 void faad_imdct(mdct_info *mdct, real_t *X_in, real_t *X_out);
+void faad_imdct_ola(mdct_info *mdct, real_t *X_in, const real_t *window,
+                    const real_t *window_next, real_t *overlap, real_t *time_out);
 void faad_mdct(mdct_info *mdct, real_t *X_in, real_t *X_out);
 
 
@@ -32,6 +32,9 @@
 #include "structs.h"
 
 #include "output.h"
+#if defined(SSE2_DEC) || defined(NEON_DEC)
+#include "simd.h"
+#endif
 
 #ifndef FIXED_POINT
 
@@ -86,20 +89,83 @@ if (sample >= 0.0f)            \
 
 #define CONV(a,b) ((a<<1)|(b&0x1))
 
+/* vector versions of get_sample, CLIP and lrintf for the 16 bit, 24 bit
+   and float output. They give the same samples as the scalar code, NaN
+   aside, which the decoder doesn't produce. Rounding like lrintf needs
+   vec_round, which ARMv7 NEON doesn't have */
+#if (defined(SSE2_DEC) || defined(NEON_DEC)) && (defined(HAS_VEC_ROUND) || !defined(HAS_LRINTF))
+#define PCM_SIMD
+
+static INLINE vec4_t get_samples(real_t **input, uint8_t channel, uint16_t sample,
+                                 uint8_t down_matrix, uint8_t *internal_channel)
+{
+    vec4_t rsqrt2 = vec_set1(RSQRT2);
+
+    if (!down_matrix)
+        return vec_load(input[internal_channel[channel]] + sample);
+
+    if (channel == 0)
+    {
+        return vec_mul(vec_set1(DM_MUL), vec_add(vec_add(
+            vec_load(input[internal_channel[1]] + sample),
+            vec_mul(vec_load(input[internal_channel[0]] + sample), rsqrt2)),
+            vec_mul(vec_load(input[internal_channel[3]] + sample), rsqrt2)));
+    } else {
+        return vec_mul(vec_set1(DM_MUL), vec_add(vec_add(
+            vec_load(input[internal_channel[2]] + sample),
+            vec_mul(vec_load(input[internal_channel[0]] + sample), rsqrt2)),
+            vec_mul(vec_load(input[internal_channel[4]] + sample), rsqrt2)));
+    }
+}
+
+static INLINE vec4i_t vec_clip_round(vec4_t sample, real_t max, real_t min)
+{
+#ifdef HAS_LRINTF
+    return vec_round(vec_clamp(sample, vec_set1(min), vec_set1(max)));
+#else
+    sample = vec_add(sample, vec_select_ge0(sample, vec_set1(0.5f), vec_set1(-0.5f)));
+    return vec_trunc(vec_clamp(sample, vec_set1(min), vec_set1(max)));
+#endif
+}
+
+/* eight samples, a and then b */
+static INLINE void store_pcm16(int16_t *out, vec4_t a, vec4_t b)
+{
+    vec_store_i16(out, vec_clip_round(a, 32767.0f, -32768.0f),
+                       vec_clip_round(b, 32767.0f, -32768.0f));
+}
+
+static INLINE void store_pcm24(int32_t *out, vec4_t a)
+{
+    a = vec_mul(a, vec_set1(256.0f));
+    vec_store_i32(out, vec_clip_round(a, 8388607.0f, -8388608.0f));
+}
+
+static INLINE void store_float(float32_t *out, vec4_t a)
+{
+    vec_store(out, vec_mul(a, vec_set1(FLOAT_SCALE)));
+}
+#endif
+
 static void to_PCM_16bit(NeAACDecStruct *hDecoder, real_t **input,
                          uint8_t channels, uint16_t frame_len,
                          int16_t **sample_buffer)
 {
     uint8_t ch, ch1;
-    uint16_t i;
+    uint16_t i = 0, j;
 
     switch (CONV(channels,hDecoder->downMatrix))
     {
     case CONV(1,0):
     case CONV(1,1):
-        for(i = 0; i < frame_len; i++)
+        ch = hDecoder->internal_channel[0];
+#ifdef PCM_SIMD
+        for(; i + 8 <= frame_len; i += 8)
+            store_pcm16(*sample_buffer + i, vec_load(input[ch] + i), vec_load(input[ch] + i + 4));
+#endif
+        for(; i < frame_len; i++)
         {
-            real_t inp = input[hDecoder->internal_channel[0]][i];
+            real_t inp = input[ch][i];
 
             CLIP(inp, 32767.0f, -32768.0f);
 
@@ -110,7 +176,14 @@ static void to_PCM_16bit(NeAACDecStruct *hDecoder, real_t **input,
         if (hDecoder->upMatrix)
         {
             ch  = hDecoder->internal_channel[0];
-            for(i = 0; i < frame_len; i++)
+#ifdef PCM_SIMD
+            for(; i + 4 <= frame_len; i += 4)
+            {
+                vec4_t inp0 = vec_load(input[ch] + i);
+                store_pcm16(*sample_buffer + i*2, vec_zip_lo(inp0, inp0), vec_zip_hi(inp0, inp0));
+            }
+#endif
+            for(; i < frame_len; i++)
             {
                 real_t inp0 = input[ch][i];
 
@@ -122,7 +195,15 @@ static void to_PCM_16bit(NeAACDecStruct *hDecoder, real_t **input,
         } else {
             ch  = hDecoder->internal_channel[0];
             ch1 = hDecoder->internal_channel[1];
-            for(i = 0; i < frame_len; i++)
+#ifdef PCM_SIMD
+            for(; i + 4 <= frame_len; i += 4)
+            {
+                vec4_t inp0 = vec_load(input[ch ] + i);
+                vec4_t inp1 = vec_load(input[ch1] + i);
+                store_pcm16(*sample_buffer + i*2, vec_zip_lo(inp0, inp1), vec_zip_hi(inp0, inp1));
+            }
+#endif
+            for(; i < frame_len; i++)
             {
                 real_t inp0 = input[ch ][i];
                 real_t inp1 = input[ch1][i];
@@ -136,15 +217,41 @@ static void to_PCM_16bit(NeAACDecStruct *hDecoder, real_t **input,
         }
         break;
     default:
+#ifdef PCM_SIMD
+        if (channels == 2)
+        {
+            /* downmixed */
+            for(; i + 4 <= frame_len; i += 4)
+            {
+                vec4_t inp0 = get_samples(input, 0, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                vec4_t inp1 = get_samples(input, 1, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                store_pcm16(*sample_buffer + i*2, vec_zip_lo(inp0, inp1), vec_zip_hi(inp0, inp1));
+            }
+        } else {
+            for(; i + 8 <= frame_len; i += 8)
+            {
+                ALIGN int16_t out[8];
+
+                for (ch = 0; ch < channels; ch++)
+                {
+                    store_pcm16(out,
+                        get_samples(input, ch, i, hDecoder->downMatrix, hDecoder->internal_channel),
+                        get_samples(input, ch, i + 4, hDecoder->downMatrix, hDecoder->internal_channel));
+                    for (j = 0; j < 8; j++)
+                        (*sample_buffer)[((i+j)*channels)+ch] = out[j];
+                }
+            }
+        }
+#endif
         for (ch = 0; ch < channels; ch++)
         {
-            for(i = 0; i < frame_len; i++)
+            for(j = i; j < frame_len; j++)
             {
-                real_t inp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                real_t inp = get_sample(input, ch, j, hDecoder->downMatrix, hDecoder->internal_channel);
 
                 CLIP(inp, 32767.0f, -32768.0f);
 
-                (*sample_buffer)[(i*channels)+ch] = (int16_t)lrintf(inp);
+                (*sample_buffer)[(j*channels)+ch] = (int16_t)lrintf(inp);
             }
         }
         break;
@@ -156,15 +263,20 @@ static void to_PCM_24bit(NeAACDecStruct *hDecoder, real_t **input,
                          int32_t **sample_buffer)
 {
     uint8_t ch, ch1;
-    uint16_t i;
+    uint16_t i = 0, j;
 
     switch (CONV(channels,hDecoder->downMatrix))
     {
     case CONV(1,0):
     case CONV(1,1):
-        for(i = 0; i < frame_len; i++)
+        ch = hDecoder->internal_channel[0];
+#ifdef PCM_SIMD
+        for(; i + 4 <= frame_len; i += 4)
+            store_pcm24(*sample_buffer + i, vec_load(input[ch] + i));
+#endif
+        for(; i < frame_len; i++)
         {
-            real_t inp = input[hDecoder->internal_channel[0]][i];
+            real_t inp = input[ch][i];
 
             inp *= 256.0f;
             CLIP(inp, 8388607.0f, -8388608.0f);
@@ -176,7 +288,15 @@ static void to_PCM_24bit(NeAACDecStruct *hDecoder, real_t **input,
         if (hDecoder->upMatrix)
         {
             ch = hDecoder->internal_channel[0];
-            for(i = 0; i < frame_len; i++)
+#ifdef PCM_SIMD
+            for(; i + 4 <= frame_len; i += 4)
+            {
+                vec4_t inp0 = vec_load(input[ch] + i);
+                store_pcm24(*sample_buffer + i*2,     vec_zip_lo(inp0, inp0));
+                store_pcm24(*sample_buffer + i*2 + 4, vec_zip_hi(inp0, inp0));
+            }
+#endif
+            for(; i < frame_len; i++)
             {
                 real_t inp0 = input[ch][i];
 
@@ -189,7 +309,16 @@ static void to_PCM_24bit(NeAACDecStruct *hDecoder, real_t **input,
         } else {
             ch  = hDecoder->internal_channel[0];
             ch1 = hDecoder->internal_channel[1];
-            for(i = 0; i < frame_len; i++)
+#ifdef PCM_SIMD
+            for(; i + 4 <= frame_len; i += 4)
+            {
+                vec4_t inp0 = vec_load(input[ch ] + i);
+                vec4_t inp1 = vec_load(input[ch1] + i);
+                store_pcm24(*sample_buffer + i*2,     vec_zip_lo(inp0, inp1));
+                store_pcm24(*sample_buffer + i*2 + 4, vec_zip_hi(inp0, inp1));
+            }
+#endif
+            for(; i < frame_len; i++)
             {
                 real_t inp0 = input[ch ][i];
                 real_t inp1 = input[ch1][i];
@@ -205,16 +334,41 @@ static void to_PCM_24bit(NeAACDecStruct *hDecoder, real_t **input,
         }
         break;
     default:
+#ifdef PCM_SIMD
+        if (channels == 2)
+        {
+            /* downmixed */
+            for(; i + 4 <= frame_len; i += 4)
+            {
+                vec4_t inp0 = get_samples(input, 0, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                vec4_t inp1 = get_samples(input, 1, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                store_pcm24(*sample_buffer + i*2,     vec_zip_lo(inp0, inp1));
+                store_pcm24(*sample_buffer + i*2 + 4, vec_zip_hi(inp0, inp1));
+            }
+        } else {
+            for(; i + 4 <= frame_len; i += 4)
+            {
+                ALIGN int32_t out[4];
+
+                for (ch = 0; ch < channels; ch++)
+                {
+                    store_pcm24(out, get_samples(input, ch, i, hDecoder->downMatrix, hDecoder->internal_channel));
+                    for (j = 0; j < 4; j++)
+                        (*sample_buffer)[((i+j)*channels)+ch] = out[j];
+                }
+            }
+        }
+#endif
         for (ch = 0; ch < channels; ch++)
         {
-            for(i = 0; i < frame_len; i++)
+            for(j = i; j < frame_len; j++)
             {
-                real_t inp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                real_t inp = get_sample(input, ch, j, hDecoder->downMatrix, hDecoder->internal_channel);
 
                 inp *= 256.0f;
                 CLIP(inp, 8388607.0f, -8388608.0f);
 
-                (*sample_buffer)[(i*channels)+ch] = (int32_t)lrintf(inp);
+                (*sample_buffer)[(j*channels)+ch] = (int32_t)lrintf(inp);
             }
         }
         break;
@@ -296,15 +450,20 @@ static void to_PCM_float(NeAACDecStruct *hDecoder, real_t **input,
                          float32_t **sample_buffer)
 {
     uint8_t ch, ch1;
-    uint16_t i;
+    uint16_t i = 0, j;
 
     switch (CONV(channels,hDecoder->downMatrix))
     {
     case CONV(1,0):
     case CONV(1,1):
-        for(i = 0; i < frame_len; i++)
+        ch = hDecoder->internal_channel[0];
+#ifdef PCM_SIMD
+        for(; i + 4 <= frame_len; i += 4)
+            store_float(*sample_buffer + i, vec_load(input[ch] + i));
+#endif
+        for(; i < frame_len; i++)
         {
-            real_t inp = input[hDecoder->internal_channel[0]][i];
+            real_t inp = input[ch][i];
             (*sample_buffer)[i] = inp*FLOAT_SCALE;
         }
         break;
@@ -312,7 +471,15 @@ static void to_PCM_float(NeAACDecStruct *hDecoder, real_t **input,
         if (hDecoder->upMatrix)
         {
             ch = hDecoder->internal_channel[0];
-            for(i = 0; i < frame_len; i++)
+#ifdef PCM_SIMD
+            for(; i + 4 <= frame_len; i += 4)
+            {
+                vec4_t inp0 = vec_load(input[ch] + i);
+                store_float(*sample_buffer + i*2,     vec_zip_lo(inp0, inp0));
+                store_float(*sample_buffer + i*2 + 4, vec_zip_hi(inp0, inp0));
+            }
+#endif
+            for(; i < frame_len; i++)
             {
                 real_t inp0 = input[ch][i];
                 (*sample_buffer)[(i*2)+0] = inp0*FLOAT_SCALE;
@@ -321,7 +488,16 @@ static void to_PCM_float(NeAACDecStruct *hDecoder, real_t **input,
         } else {
             ch  = hDecoder->internal_channel[0];
             ch1 = hDecoder->internal_channel[1];
-            for(i = 0; i < frame_len; i++)
+#ifdef PCM_SIMD
+            for(; i + 4 <= frame_len; i += 4)
+            {
+                vec4_t inp0 = vec_load(input[ch ] + i);
+                vec4_t inp1 = vec_load(input[ch1] + i);
+                store_float(*sample_buffer + i*2,     vec_zip_lo(inp0, inp1));
+                store_float(*sample_buffer + i*2 + 4, vec_zip_hi(inp0, inp1));
+            }
+#endif
+            for(; i < frame_len; i++)
             {
                 real_t inp0 = input[ch ][i];
                 real_t inp1 = input[ch1][i];
@@ -331,12 +507,37 @@ static void to_PCM_float(NeAACDecStruct *hDecoder, real_t **input,
         }
         break;
     default:
+#ifdef PCM_SIMD
+        if (channels == 2)
+        {
+            /* downmixed */
+            for(; i + 4 <= frame_len; i += 4)
+            {
+                vec4_t inp0 = get_samples(input, 0, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                vec4_t inp1 = get_samples(input, 1, i, hDecoder->downMatrix, hDecoder->internal_channel);
+                store_float(*sample_buffer + i*2,     vec_zip_lo(inp0, inp1));
+                store_float(*sample_buffer + i*2 + 4, vec_zip_hi(inp0, inp1));
+            }
+        } else {
+            for(; i + 4 <= frame_len; i += 4)
+            {
+                ALIGN float32_t out[4];
+
+                for (ch = 0; ch < channels; ch++)
+                {
+                    store_float(out, get_samples(input, ch, i, hDecoder->downMatrix, hDecoder->internal_channel));
+                    for (j = 0; j < 4; j++)
+                        (*sample_buffer)[((i+j)*channels)+ch] = out[j];
+                }
+            }
+        }
+#endif
         for (ch = 0; ch < channels; ch++)
         {
-            for(i = 0; i < frame_len; i++)
+            for(j = i; j < frame_len; j++)
             {
-                real_t inp = get_sample(input, ch, i, hDecoder->downMatrix, hDecoder->internal_channel);
-                (*sample_buffer)[(i*channels)+ch] = inp*FLOAT_SCALE;
+                real_t inp = get_sample(input, ch, j, hDecoder->downMatrix, hDecoder->internal_channel);
+                (*sample_buffer)[(j*channels)+ch] = inp*FLOAT_SCALE;
             }
         }
         break;
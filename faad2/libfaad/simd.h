@@ -0,0 +1,178 @@
+/*
+** FAAD2 - Freeware Advanced Audio (AAC) Decoder including SBR decoding
+** Copyright (C) 2003-2005 M. Bakker, Nero AG, http://www.nero.com
+**  
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+** 
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+** 
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software 
+** Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+**
+** Any non-GPL usage of this software or parts of this software is strictly
+** forbidden.
+**
+** The "appropriate copyright message" mentioned in section 2c of the GPLv2
+** must read: "Code from FAAD2 is copyright (c) Nero AG, www.nero.com"
+**
+** Commercial non-GPL licensing of this software is possible.
+** For more info contact Nero AG through Mpeg4AAClicense@nero.com.
+**
+** $Id: simd.h $
+**/
+
+#ifndef __SIMD_H__
+#define __SIMD_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Vector helpers for the SSE2 and NEON versions of the hot loops. A
+   vector holds four reals, or two complex_t as they lie in memory. Only
+   included when SSE2_DEC or NEON_DEC is defined, see common.h */
+
+#if defined(SSE2_DEC)
+
+#include <emmintrin.h>
+
+typedef __m128 vec4_t;
+
+static INLINE vec4_t vec_load(const real_t *p) { return _mm_loadu_ps(p); }
+static INLINE void vec_store(real_t *p, vec4_t a) { _mm_storeu_ps(p, a); }
+static INLINE vec4_t vec_add(vec4_t a, vec4_t b) { return _mm_add_ps(a, b); }
+static INLINE vec4_t vec_sub(vec4_t a, vec4_t b) { return _mm_sub_ps(a, b); }
+static INLINE vec4_t vec_mul(vec4_t a, vec4_t b) { return _mm_mul_ps(a, b); }
+
+/* flips the sign of the real parts */
+static INLINE vec4_t vec_neg_re(vec4_t a)
+{
+    return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set_epi32(0, (int)0x80000000, 0, (int)0x80000000)));
+}
+/* swaps the real and imaginary parts */
+static INLINE vec4_t vec_swap_re_im(vec4_t a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)); }
+static INLINE vec4_t vec_dup_re(vec4_t a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 0, 0)); }
+static INLINE vec4_t vec_dup_im(vec4_t a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 1, 1)); }
+/* the first and the second complex value of a and b */
+static INLINE vec4_t vec_lo(vec4_t a, vec4_t b) { return _mm_movelh_ps(a, b); }
+static INLINE vec4_t vec_hi(vec4_t a, vec4_t b) { return _mm_movehl_ps(b, a); }
+
+static INLINE vec4_t vec_neg(vec4_t a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+/* the lanes in reverse order */
+static INLINE vec4_t vec_reverse(vec4_t a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3)); }
+/* the real and the imaginary parts of the four complex values in a and b */
+static INLINE vec4_t vec_re(vec4_t a, vec4_t b) { return _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)); }
+static INLINE vec4_t vec_im(vec4_t a, vec4_t b) { return _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)); }
+/* interleaves the first and the last two lanes of a and b, the inverse
+   of vec_re and vec_im */
+static INLINE vec4_t vec_zip_lo(vec4_t a, vec4_t b) { return _mm_unpacklo_ps(a, b); }
+static INLINE vec4_t vec_zip_hi(vec4_t a, vec4_t b) { return _mm_unpackhi_ps(a, b); }
+
+static INLINE vec4_t vec_set1(real_t a) { return _mm_set1_ps(a); }
+/* limits a to [lo, hi], NaN stays NaN */
+static INLINE vec4_t vec_clamp(vec4_t a, vec4_t lo, vec4_t hi) { return _mm_max_ps(lo, _mm_min_ps(hi, a)); }
+/* b where a >= 0, c elsewhere (NaN included) */
+static INLINE vec4_t vec_select_ge0(vec4_t a, vec4_t b, vec4_t c)
+{
+    __m128 mask = _mm_cmpge_ps(a, _mm_setzero_ps());
+    return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, c));
+}
+
+/* four int32_t */
+typedef __m128i vec4i_t;
+
+#define HAS_VEC_ROUND
+/* to integers, rounded to nearest as lrintf does and towards zero as a cast does */
+static INLINE vec4i_t vec_round(vec4_t a) { return _mm_cvtps_epi32(a); }
+static INLINE vec4i_t vec_trunc(vec4_t a) { return _mm_cvttps_epi32(a); }
+static INLINE void vec_store_i32(int32_t *p, vec4i_t a) { _mm_storeu_si128((__m128i*)p, a); }
+/* stores the low 16 bits of a and then b, like a cast to int16_t */
+static INLINE void vec_store_i16(int16_t *p, vec4i_t a, vec4i_t b)
+{
+    a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+    b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+    _mm_storeu_si128((__m128i*)p, _mm_packs_epi32(a, b));
+}
+
+#elif defined(NEON_DEC)
+
+#include <arm_neon.h>
+
+typedef float32x4_t vec4_t;
+
+static INLINE vec4_t vec_load(const real_t *p) { return vld1q_f32(p); }
+static INLINE void vec_store(real_t *p, vec4_t a) { vst1q_f32(p, a); }
+static INLINE vec4_t vec_add(vec4_t a, vec4_t b) { return vaddq_f32(a, b); }
+static INLINE vec4_t vec_sub(vec4_t a, vec4_t b) { return vsubq_f32(a, b); }
+static INLINE vec4_t vec_mul(vec4_t a, vec4_t b) { return vmulq_f32(a, b); }
+
+static INLINE vec4_t vec_neg_re(vec4_t a)
+{
+    const uint32x4_t sign = vcombine_u32(vcreate_u32(0x80000000u), vcreate_u32(0x80000000u));
+    return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), sign));
+}
+static INLINE vec4_t vec_swap_re_im(vec4_t a) { return vrev64q_f32(a); }
+static INLINE vec4_t vec_dup_re(vec4_t a) { return vtrnq_f32(a, a).val[0]; }
+static INLINE vec4_t vec_dup_im(vec4_t a) { return vtrnq_f32(a, a).val[1]; }
+static INLINE vec4_t vec_lo(vec4_t a, vec4_t b) { return vcombine_f32(vget_low_f32(a), vget_low_f32(b)); }
+static INLINE vec4_t vec_hi(vec4_t a, vec4_t b) { return vcombine_f32(vget_high_f32(a), vget_high_f32(b)); }
+
+static INLINE vec4_t vec_neg(vec4_t a) { return vnegq_f32(a); }
+static INLINE vec4_t vec_reverse(vec4_t a)
+{
+    a = vrev64q_f32(a);
+    return vcombine_f32(vget_high_f32(a), vget_low_f32(a));
+}
+static INLINE vec4_t vec_re(vec4_t a, vec4_t b) { return vuzpq_f32(a, b).val[0]; }
+static INLINE vec4_t vec_im(vec4_t a, vec4_t b) { return vuzpq_f32(a, b).val[1]; }
+static INLINE vec4_t vec_zip_lo(vec4_t a, vec4_t b) { return vzipq_f32(a, b).val[0]; }
+static INLINE vec4_t vec_zip_hi(vec4_t a, vec4_t b) { return vzipq_f32(a, b).val[1]; }
+
+static INLINE vec4_t vec_set1(real_t a) { return vdupq_n_f32(a); }
+static INLINE vec4_t vec_clamp(vec4_t a, vec4_t lo, vec4_t hi) { return vmaxq_f32(lo, vminq_f32(hi, a)); }
+static INLINE vec4_t vec_select_ge0(vec4_t a, vec4_t b, vec4_t c)
+{
+    return vbslq_f32(vcgeq_f32(a, vdupq_n_f32(0.0f)), b, c);
+}
+
+typedef int32x4_t vec4i_t;
+
+/* there is no round to nearest conversion before ARMv8 */
+#if defined(__aarch64__) || defined(__ARM_FEATURE_DIRECTED_ROUNDING)
+#define HAS_VEC_ROUND
+static INLINE vec4i_t vec_round(vec4_t a) { return vcvtnq_s32_f32(a); }
+#endif
+static INLINE vec4i_t vec_trunc(vec4_t a) { return vcvtq_s32_f32(a); }
+static INLINE void vec_store_i32(int32_t *p, vec4i_t a) { vst1q_s32(p, a); }
+static INLINE void vec_store_i16(int16_t *p, vec4i_t a, vec4i_t b)
+{
+    vst1q_s16(p, vcombine_s16(vmovn_s32(a), vmovn_s32(b)));
+}
+
+#endif
+
+/* complex multiplication of each pair, a*b as ComplexMult computes it:
+   RE = RE(a)*RE(b) - IM(a)*IM(b), IM = IM(a)*RE(b) + RE(a)*IM(b) */
+static INLINE vec4_t vec_cmul(vec4_t a, vec4_t b)
+{
+    return vec_add(vec_mul(a, vec_dup_re(b)),
+                   vec_neg_re(vec_mul(vec_swap_re_im(a), vec_dup_im(b))));
+}
+
+/* a*i */
+static INLINE vec4_t vec_mul_i(vec4_t a)
+{
+    return vec_neg_re(vec_swap_re_im(a));
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -58,6 +58,8 @@ typedef struct {
     uint16_t N;
     cfft_info *cfft;
     complex_t *sincos;
+    /* faad_imdct uses the SIMD twiddles, set for N a multiple of 64 */
+    uint8_t simd;
 #ifdef PROFILE
     int64_t cycles;
     int64_t fft_cycles;